@@ -0,0 +1,63 @@
+#ifndef LIST_BENCH_H
+#define LIST_BENCH_H
+
+#include <stdint.h>
+#include <sys/resource.h>
+#include <time.h>
+#include "list.h"
+
+/**
+ * @brief Returns the current wall-clock time in nanoseconds for benchmarking.
+ */
+static inline uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief Prevents the compiler from optimizing away a computed value.
+ */
+static inline void bench_do_not_optimize(const void* p) {
+    __asm__ volatile("" : : "r"(p) : "memory");
+}
+
+/**
+ * @brief Returns the peak resident set size of the process in kilobytes.
+ */
+static inline long bench_peak_rss_kb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+static inline void* bench_counting_alloc(void* ctx, const size_t size) {
+    ++*(size_t*) ctx;
+    return malloc(size);
+}
+
+static inline void* bench_counting_realloc(
+    void* ctx, void* ptr, [[maybe_unused]] const size_t old_size, const size_t new_size) {
+    ++*(size_t*) ctx;
+    return realloc(ptr, new_size);
+}
+
+static inline void bench_counting_free([[maybe_unused]] void* ctx, void* ptr, [[maybe_unused]] const size_t size) {
+    free(ptr);
+}
+
+/**
+ * @brief Creates a `malloc`-backed allocator that counts allocations and reallocations.
+ *
+ * @param counter Incremented on every `alloc` and `realloc` call.
+ */
+static inline list_allocator bench_counting_allocator(size_t* counter) {
+    return (list_allocator) {
+        .alloc   = bench_counting_alloc,
+        .realloc = bench_counting_realloc,
+        .free    = bench_counting_free,
+        .ctx     = counter,
+    };
+}
+
+#endif //LIST_BENCH_H
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list.h"
+#include "bench.h"
+
+// Compares looped list_push against list_push_n and list_extend for bulk ingest.
+
+static constexpr int repetitions = 5;
+
+static double bench_push_loop(const uint8_t* records, const size_t count, const size_t elem_size) {
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < repetitions; r++) {
+        list lst;
+        list_init(&lst, elem_size);
+
+        const uint64_t start = bench_now_ns();
+        for (size_t i = 0; i < count; i++) {
+            list_push(&lst, records + i * elem_size);
+        }
+        const uint64_t elapsed = bench_now_ns() - start;
+
+        bench_do_not_optimize(lst.data);
+        list_destroy(&lst);
+        if (elapsed < best) best = elapsed;
+    }
+    return (double) best / (double) count;
+}
+
+static double bench_push_n(const uint8_t* records, const size_t count, const size_t elem_size) {
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < repetitions; r++) {
+        list lst;
+        list_init(&lst, elem_size);
+
+        const uint64_t start = bench_now_ns();
+        list_push_n(&lst, records, count);
+        const uint64_t elapsed = bench_now_ns() - start;
+
+        bench_do_not_optimize(lst.data);
+        list_destroy(&lst);
+        if (elapsed < best) best = elapsed;
+    }
+    return (double) best / (double) count;
+}
+
+static double bench_extend(const list* src) {
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < repetitions; r++) {
+        list lst;
+        list_init(&lst, src->elem_size);
+
+        const uint64_t start = bench_now_ns();
+        list_extend(&lst, src);
+        const uint64_t elapsed = bench_now_ns() - start;
+
+        bench_do_not_optimize(lst.data);
+        list_destroy(&lst);
+        if (elapsed < best) best = elapsed;
+    }
+    return (double) best / (double) src->size;
+}
+
+int main(void) {
+    const size_t elem_sizes[] = { 16, 64 };
+    const size_t counts[] = { 10000, 100000, 1000000 };
+
+    printf("%-10s %-10s %14s %14s %14s\n", "elem_size", "count", "push ns/op", "push_n ns/op", "extend ns/op");
+
+    for (size_t e = 0; e < sizeof elem_sizes / sizeof elem_sizes[0]; e++) {
+        for (size_t c = 0; c < sizeof counts / sizeof counts[0]; c++) {
+            const size_t elem_size = elem_sizes[e];
+            const size_t count = counts[c];
+
+            uint8_t* records = malloc(count * elem_size);
+            if (records == nullptr) {
+                fprintf(stderr, "Failed to allocate benchmark input.\n");
+                return 1;
+            }
+            memset(records, 0xab, count * elem_size);
+
+            list src;
+            if (list_init(&src, elem_size) != LIST_OK || list_push_n(&src, records, count) != LIST_OK) {
+                fprintf(stderr, "Failed to build source list.\n");
+                free(records);
+                return 1;
+            }
+
+            printf("%-10zu %-10zu %14.2f %14.2f %14.2f\n",
+                   elem_size, count,
+                   bench_push_loop(records, count, elem_size),
+                   bench_push_n(records, count, elem_size),
+                   bench_extend(&src));
+
+            list_destroy(&src);
+            free(records);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+#include "list.h"
+#include "list_concurrent.h"
+#include "bench.h"
+
+// Compares append throughput of a mutex-protected list against concurrent_list
+// as the number of producer threads grows. Output is CSV.
+// Usage: list_bench_concurrent [pushes_per_thread]
+
+enum { max_threads = 16 };
+
+typedef struct producer_args {
+    list*            lst;
+    mtx_t*           lock;
+    concurrent_list* cl;
+    size_t           pushes;
+} producer_args;
+
+static int mutex_producer(void* arg) {
+    const producer_args* args = arg;
+    for (size_t i = 0; i < args->pushes; i++) {
+        const uint64_t value = i;
+        mtx_lock(args->lock);
+        const list_status status = list_push(args->lst, &value);
+        mtx_unlock(args->lock);
+        if (status != LIST_OK) return 1;
+    }
+    return 0;
+}
+
+static int concurrent_producer(void* arg) {
+    const producer_args* args = arg;
+    for (size_t i = 0; i < args->pushes; i++) {
+        const uint64_t value = i;
+        if (concurrent_list_push(args->cl, &value) != LIST_OK) return 1;
+    }
+    return 0;
+}
+
+static int run_producers(const thrd_start_t fn, producer_args* args, const int threads, uint64_t* out_elapsed) {
+    thrd_t handles[max_threads];
+
+    const uint64_t start = bench_now_ns();
+    for (int t = 0; t < threads; t++) {
+        if (thrd_create(&handles[t], fn, args) != thrd_success) return 1;
+    }
+
+    int failed = 0;
+    for (int t = 0; t < threads; t++) {
+        int result = 0;
+        thrd_join(handles[t], &result);
+        failed |= result;
+    }
+    *out_elapsed = bench_now_ns() - start;
+
+    return failed;
+}
+
+int main(const int argc, char** argv) {
+    const size_t pushes = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    const int thread_counts[] = { 1, 2, 4, 8, 16 };
+
+    printf("variant,threads,pushes,ns_per_op,mops_per_sec\n");
+
+    for (size_t i = 0; i < sizeof thread_counts / sizeof thread_counts[0]; i++) {
+        const int threads = thread_counts[i];
+        const double total = (double) pushes * threads;
+
+        list lst;
+        mtx_t lock;
+        list_init(&lst, sizeof(uint64_t));
+        mtx_init(&lock, mtx_plain);
+
+        uint64_t elapsed = 0;
+        producer_args args = { .lst = &lst, .lock = &lock, .pushes = pushes };
+        if (run_producers(mutex_producer, &args, threads, &elapsed) != 0) {
+            fprintf(stderr, "mutex variant failed\n");
+            return 1;
+        }
+        printf("mutex_list,%d,%zu,%.3f,%.2f\n", threads, pushes, elapsed / total, total * 1e3 / elapsed);
+
+        mtx_destroy(&lock);
+        list_destroy(&lst);
+
+        concurrent_list cl;
+        concurrent_list_init(&cl, sizeof(uint64_t));
+
+        args = (producer_args) { .cl = &cl, .pushes = pushes };
+        if (run_producers(concurrent_producer, &args, threads, &elapsed) != 0) {
+            fprintf(stderr, "concurrent variant failed\n");
+            return 1;
+        }
+        printf("concurrent_list,%d,%zu,%.3f,%.2f\n", threads, pushes, elapsed / total, total * 1e3 / elapsed);
+
+        concurrent_list_destroy(&cl);
+    }
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "list_deque.h"
+#include "bench.h"
+
+// Runs a FIFO work queue that keeps `depth` items queued, taking items from
+// the front of a list with list_erase_at and of a list_deque with
+// list_deque_pop_front. Output is CSV.
+// Usage: list_bench_deque [operations] [depth]
+
+static void report(const char* variant, const size_t operations, const size_t depth, const uint64_t elapsed) {
+    printf("%s,%zu,%zu,%.3f,%.1f\n",
+           variant, operations, depth, (double) elapsed / 1e6, (double) elapsed / (double) operations);
+}
+
+int main(const int argc, char** argv) {
+    const size_t operations = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    const size_t depth = argc > 2 ? strtoull(argv[2], nullptr, 10) : 10000;
+    uint64_t checksum = 0;
+
+    printf("variant,operations,depth,ms,ns_per_op\n");
+
+    list lst;
+    list_init(&lst, sizeof(uint64_t));
+    for (uint64_t i = 0; i < depth; i++) list_push(&lst, &i);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < operations; i++) {
+        uint64_t item;
+        list_erase_at(&lst, 0, &item);
+        checksum += item;
+        const uint64_t next = depth + i;
+        list_push(&lst, &next);
+    }
+    report("list_erase_at", operations, depth, bench_now_ns() - start);
+    list_destroy(&lst);
+
+    list_deque dq;
+    list_deque_init(&dq, sizeof(uint64_t));
+    for (uint64_t i = 0; i < depth; i++) list_deque_push_back(&dq, &i);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < operations; i++) {
+        uint64_t item;
+        list_deque_pop_front(&dq, &item);
+        checksum += item;
+        const uint64_t next = depth + i;
+        list_deque_push_back(&dq, &next);
+    }
+    report("list_deque", operations, depth, bench_now_ns() - start);
+    list_deque_destroy(&dq);
+
+    bench_do_not_optimize(&checksum);
+    return 0;
+}
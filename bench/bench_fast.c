@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "bench.h"
+
+// Built with LIST_FAST: times push, get, set and pop loops over `count`
+// 8-byte elements through the inlined unchecked calls, and through the
+// validating library functions reached as (list_push) and friends.
+// Output is CSV.
+// Usage: list_bench_fast [count] [repetitions]
+
+static void report(const char* variant, const char* op, const size_t count, const uint64_t elapsed) {
+    printf("%s,%s,%zu,%.3f,%.2f\n", variant, op, count, (double) elapsed / 1e6, (double) elapsed / (double) count);
+}
+
+int main(const int argc, char** argv) {
+    const size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+    const size_t repetitions = argc > 2 ? strtoull(argv[2], nullptr, 10) : 5;
+    uint64_t checksum = 0;
+
+    printf("variant,op,count,ms,ns_per_op\n");
+
+    uint64_t best[2][4];
+    for (size_t v = 0; v < 2; v++) {
+        for (size_t op = 0; op < 4; op++) best[v][op] = UINT64_MAX;
+    }
+
+    for (size_t r = 0; r < repetitions; r++) {
+        for (size_t v = 0; v < 2; v++) {
+            const bool fast = v == 0;
+            uint64_t elapsed[4];
+
+            list lst;
+            list_init_with_capacity(&lst, count, sizeof(uint64_t));
+            list_set_shrink_policy(&lst, LIST_SHRINK_NEVER, 0);
+
+            uint64_t start = bench_now_ns();
+            if (fast) {
+                for (uint64_t i = 0; i < count; i++) list_push(&lst, &i);
+            } else {
+                for (uint64_t i = 0; i < count; i++) (list_push)(&lst, &i);
+            }
+            elapsed[0] = bench_now_ns() - start;
+
+            start = bench_now_ns();
+            if (fast) {
+                for (size_t i = 0; i < count; i++) {
+                    uint64_t value;
+                    list_get(&lst, i, &value);
+                    checksum += value;
+                }
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    uint64_t value;
+                    (list_get)(&lst, i, &value);
+                    checksum += value;
+                }
+            }
+            elapsed[1] = bench_now_ns() - start;
+
+            start = bench_now_ns();
+            if (fast) {
+                for (uint64_t i = 0; i < count; i++) list_set(&lst, i, &checksum);
+            } else {
+                for (uint64_t i = 0; i < count; i++) (list_set)(&lst, i, &checksum);
+            }
+            elapsed[2] = bench_now_ns() - start;
+            bench_do_not_optimize(lst.data);
+
+            start = bench_now_ns();
+            if (fast) {
+                for (size_t i = 0; i < count; i++) {
+                    uint64_t value;
+                    list_pop(&lst, &value);
+                    checksum ^= value;
+                }
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    uint64_t value;
+                    (list_pop)(&lst, &value);
+                    checksum ^= value;
+                }
+            }
+            elapsed[3] = bench_now_ns() - start;
+
+            list_destroy(&lst);
+            for (size_t op = 0; op < 4; op++) {
+                if (elapsed[op] < best[v][op]) best[v][op] = elapsed[op];
+            }
+        }
+    }
+
+    static const char* const ops[4] = { "push", "get", "set", "pop" };
+    for (size_t op = 0; op < 4; op++) report("checked", ops[op], count, best[1][op]);
+    for (size_t op = 0; op < 4; op++) report("fast", ops[op], count, best[0][op]);
+
+    bench_do_not_optimize(&checksum);
+    return 0;
+}
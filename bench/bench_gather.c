@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "bench.h"
+
+// Looks up `lookups` random indices in a list of `elements` 8-byte values,
+// once with a list_get per index and once with list_gather, then writes
+// them back with list_set and list_scatter. Output is CSV.
+// Usage: list_bench_gather [elements] [lookups]
+
+static void report(const char* variant, const size_t elements, const size_t lookups, const uint64_t elapsed) {
+    printf("%s,%zu,%zu,%.3f,%.2f\n",
+           variant, elements, lookups, (double) elapsed / 1e6, (double) elapsed / (double) lookups);
+}
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 16000000;
+    const size_t lookups = argc > 2 ? strtoull(argv[2], nullptr, 10) : 4000000;
+
+    printf("variant,elements,lookups,ms,ns_per_lookup\n");
+
+    list lst;
+    list_init_with_capacity(&lst, elements, sizeof(uint64_t));
+    for (uint64_t i = 0; i < elements; i++) list_push(&lst, &i);
+
+    size_t* indices = malloc(lookups * sizeof(size_t));
+    uint64_t* out = malloc(lookups * sizeof(uint64_t));
+    uint64_t state = 0x9e3779b97f4a7c15u;
+    for (size_t i = 0; i < lookups; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        indices[i] = (size_t) (state % elements);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < lookups; i++) list_get(&lst, indices[i], &out[i]);
+    report("list_get", elements, lookups, bench_now_ns() - start);
+    bench_do_not_optimize(out);
+
+    start = bench_now_ns();
+    list_gather(&lst, indices, lookups, out, nullptr);
+    report("list_gather", elements, lookups, bench_now_ns() - start);
+    bench_do_not_optimize(out);
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < lookups; i++) list_set(&lst, indices[i], &out[i]);
+    report("list_set", elements, lookups, bench_now_ns() - start);
+    bench_do_not_optimize(lst.data);
+
+    start = bench_now_ns();
+    list_scatter(&lst, indices, lookups, out, nullptr);
+    report("list_scatter", elements, lookups, bench_now_ns() - start);
+    bench_do_not_optimize(lst.data);
+
+    free(out);
+    free(indices);
+    list_destroy(&lst);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "list_iter.h"
+#include "bench.h"
+
+// Sums one field of `elements` records of `record_size` bytes, walking
+// forwards and backwards with an indexed list_get loop, with list_iter with
+// and without prefetching, and with list_iter spans. Output is CSV.
+// Usage: list_bench_iter [elements] [record_size]
+
+static void report(const char* variant, const size_t elements, const size_t record_size, const uint64_t elapsed) {
+    printf("%s,%zu,%zu,%.3f,%.2f\n",
+           variant, elements, record_size, (double) elapsed / 1e6, (double) elapsed / (double) elements);
+}
+
+static uint64_t walk(const list* lst, const unsigned flags, const size_t prefetch, uint64_t* checksum) {
+    const uint64_t start = bench_now_ns();
+
+    list_iter it;
+    list_iter_init(&it, lst, flags, prefetch);
+    uint64_t sum = 0;
+    for (const uint64_t* p; (p = list_iter_next(&it)) != nullptr;) sum += *p;
+
+    *checksum += sum;
+    return bench_now_ns() - start;
+}
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 2000000;
+    size_t record_size = argc > 2 ? strtoull(argv[2], nullptr, 10) : 64;
+    if (record_size < sizeof(uint64_t)) record_size = sizeof(uint64_t);
+
+    uint64_t checksum = 0;
+    uint8_t* record = calloc(1, record_size);
+
+    list lst;
+    list_init_with_capacity(&lst, elements, record_size);
+    for (uint64_t i = 0; i < elements; i++) {
+        *(uint64_t*) record = i;
+        list_push(&lst, record);
+    }
+
+    printf("variant,elements,record_size,ms,ns_per_element\n");
+
+    uint64_t start = bench_now_ns();
+    uint64_t sum = 0;
+    for (size_t i = 0; i < elements; i++) {
+        list_get(&lst, i, record);
+        sum += *(const uint64_t*) record;
+    }
+    checksum += sum;
+    report("list_get", elements, record_size, bench_now_ns() - start);
+
+    report("iter", elements, record_size, walk(&lst, LIST_ITER_FORWARD, 0, &checksum));
+    report("iter_prefetch", elements, record_size, walk(&lst, LIST_ITER_FORWARD, LIST_ITER_PREFETCH_DISTANCE, &checksum));
+    report("iter_reverse", elements, record_size, walk(&lst, LIST_ITER_REVERSE, 0, &checksum));
+    report("iter_reverse_prefetch", elements, record_size,
+           walk(&lst, LIST_ITER_REVERSE, LIST_ITER_PREFETCH_DISTANCE, &checksum));
+
+    start = bench_now_ns();
+    list_iter it = list_iter_begin(&lst);
+    uint8_t* span;
+    size_t n;
+    sum = 0;
+    while ((n = list_iter_next_span(&it, 4096, (void**) &span)) > 0) {
+        for (size_t i = 0; i < n; i++) sum += *(const uint64_t*) (span + i * record_size);
+    }
+    checksum += sum;
+    report("iter_span", elements, record_size, bench_now_ns() - start);
+
+    list_destroy(&lst);
+    free(record);
+    bench_do_not_optimize(&checksum);
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "list_packed.h"
+#include "bench.h"
+
+// Stores `elements` sorted 64-bit IDs with random gaps below `max_gap` as a
+// plain list and as a list_packed, then times building each, full scans
+// (list_data against list_packed_decode block by block) and random gets.
+// Output is CSV.
+// Usage: list_bench_packed [elements] [max_gap]
+
+static void report(
+    const char* variant,
+    const char* op,
+    const size_t elements,
+    const size_t bytes,
+    const size_t ops,
+    const uint64_t elapsed)
+{
+    printf("%s,%s,%zu,%zu,%.3f,%.2f\n",
+           variant, op, elements, bytes, (double) elapsed / 1e6, (double) elapsed / (double) ops);
+}
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 16000000;
+    const uint64_t max_gap = argc > 2 ? strtoull(argv[2], nullptr, 10) : 64;
+    const size_t passes = 5;
+    const size_t gets = 1000000;
+    uint64_t checksum = 0;
+
+    printf("variant,op,elements,bytes,ms,ns_per_elem\n");
+
+    list ids;
+    list_init(&ids, sizeof(uint64_t));
+
+    uint64_t state = 88172645463325252u;
+    uint64_t id = 1000000;
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < elements; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        id += 1 + state % max_gap;
+        list_push(&ids, &id);
+    }
+    report("list", "push", elements, list_capacity(&ids) * sizeof(uint64_t), elements, bench_now_ns() - start);
+
+    list_packed pk;
+    start = bench_now_ns();
+    list_packed_from_list(&pk, &ids);
+    list_packed_shrink_to_fit(&pk);
+    report("packed", "build", elements, list_packed_bytes(&pk), elements, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t pass = 0; pass < passes; pass++) {
+        const uint64_t* data = list_data(&ids);
+        uint64_t sum = 0;
+        for (size_t i = 0; i < elements; i++) sum += data[i];
+        checksum += sum;
+    }
+    report("list", "scan", elements, list_capacity(&ids) * sizeof(uint64_t), elements * passes, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t pass = 0; pass < passes; pass++) {
+        uint64_t block[LIST_PACKED_BLOCK];
+        uint64_t sum = 0;
+        for (size_t first = 0; first < elements; first += LIST_PACKED_BLOCK) {
+            const size_t count = elements - first < LIST_PACKED_BLOCK ? elements - first : LIST_PACKED_BLOCK;
+            list_packed_decode(&pk, first, count, block);
+            for (size_t i = 0; i < count; i++) sum += block[i];
+        }
+        checksum += sum;
+    }
+    report("packed", "scan", elements, list_packed_bytes(&pk), elements * passes, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t g = 0; g < gets; g++) {
+        uint64_t value;
+        list_get(&ids, (g * 2654435761u) % elements, &value);
+        checksum += value;
+    }
+    report("list", "get", elements, list_capacity(&ids) * sizeof(uint64_t), gets, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t g = 0; g < gets; g++) {
+        uint64_t value;
+        list_packed_get(&pk, (g * 2654435761u) % elements, &value);
+        checksum += value;
+    }
+    report("packed", "get", elements, list_packed_bytes(&pk), gets, bench_now_ns() - start);
+
+    bench_do_not_optimize(&checksum);
+    list_packed_destroy(&pk);
+    list_destroy(&ids);
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "list_pages.h"
+#include "bench.h"
+
+// Compares random list_get over a large list whose buffer comes from malloc
+// against list_pages buffers that are mapped, optionally on huge pages.
+// Also reports the time to grow the list by pushing, which shows the
+// cost of copying on realloc against mremap. Output is CSV.
+// Usage: list_bench_pages [elements] [lookups]
+
+typedef struct pages_case {
+    const char* name;
+    unsigned    flags;
+    bool        use_pages;
+} pages_case;
+
+static const pages_case pages_cases[] = {
+    { "malloc",            LIST_PAGES_NONE,     false },
+    { "pages_map",         LIST_PAGES_MAP,      true },
+    { "pages_hugepage",    LIST_PAGES_HUGEPAGE, true },
+    { "pages_hugetlb",     LIST_PAGES_HUGETLB,  true },
+};
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 32 * 1024 * 1024;
+    const size_t lookups = argc > 2 ? strtoull(argv[2], nullptr, 10) : 20000000;
+
+    if (elements == 0) return 0;
+
+    printf("variant,elements,push_ms,lookups,lookup_ns\n");
+
+    for (size_t c = 0; c < sizeof pages_cases / sizeof pages_cases[0]; c++) {
+        list_pages pages;
+        list_pages_init(&pages, LIST_CACHE_LINE_SIZE, 0, pages_cases[c].flags);
+
+        list lst;
+        const list_allocator* allocator = pages_cases[c].use_pages ? list_pages_allocator(&pages) : nullptr;
+        if (list_init_with_allocator(&lst, 0, sizeof(uint64_t), allocator) != LIST_OK) return 1;
+
+        uint64_t start = bench_now_ns();
+        for (uint64_t i = 0; i < elements; i++) {
+            if (list_push(&lst, &i) != LIST_OK) {
+                fprintf(stderr, "Failed to grow benchmark list.\n");
+                return 1;
+            }
+        }
+        const uint64_t push_ns = bench_now_ns() - start;
+
+        uint64_t state = 0x9e3779b97f4a7c15u;
+        uint64_t sum = 0;
+        start = bench_now_ns();
+        for (size_t i = 0; i < lookups; i++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            uint64_t value;
+            list_get(&lst, state % elements, &value);
+            sum += value;
+        }
+        const uint64_t lookup_ns = bench_now_ns() - start;
+        bench_do_not_optimize(&sum);
+
+        printf("%s,%zu,%.3f,%zu,%.2f\n",
+               pages_cases[c].name, elements, (double) push_ns / 1e6, lookups,
+               (double) lookup_ns / (double) lookups);
+        list_destroy(&lst);
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "list_parallel.h"
+#include "bench.h"
+
+// Measures how list_parallel_for and list_parallel_reduce scale with the
+// number of threads over one large list. Output is CSV.
+// Usage: list_bench_parallel [elements] [max_threads]
+
+enum { repeats = 5 };
+
+static void scale_range(void* elems, const size_t count, [[maybe_unused]] const size_t first_index, [[maybe_unused]] void* ctx) {
+    double* values = elems;
+    for (size_t i = 0; i < count; i++) values[i] = values[i] * 1.000001 + 0.5;
+}
+
+static void sum_range(const void* elems, const size_t count, void* accumulator, [[maybe_unused]] void* ctx) {
+    const double* values = elems;
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) sum += values[i];
+    *(double*) accumulator += sum;
+}
+
+static void sum_combine(void* accumulator, const void* other, [[maybe_unused]] void* ctx) {
+    *(double*) accumulator += *(const double*) other;
+}
+
+static uint64_t run_for(list* lst, const size_t threads) {
+    const uint64_t start = bench_now_ns();
+    for (int r = 0; r < repeats; r++) list_parallel_for(lst, scale_range, nullptr, threads);
+    return (bench_now_ns() - start) / repeats;
+}
+
+static uint64_t run_reduce(const list* lst, const size_t threads) {
+    double sum = 0.0;
+    const uint64_t start = bench_now_ns();
+    for (int r = 0; r < repeats; r++) {
+        sum = 0.0;
+        list_parallel_reduce(lst, sum_range, sum_combine, &sum, sizeof sum, nullptr, threads);
+    }
+    bench_do_not_optimize(&sum);
+    return (bench_now_ns() - start) / repeats;
+}
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 50000000;
+    size_t max_threads = argc > 2 ? strtoull(argv[2], nullptr, 10) : list_parallel_hardware_threads();
+    if (max_threads == 0) max_threads = 1;
+
+    list lst;
+    if (list_init_with_capacity(&lst, elements, sizeof(double)) != LIST_OK) {
+        fprintf(stderr, "Failed to allocate benchmark input.\n");
+        return 1;
+    }
+    for (size_t i = 0; i < elements; i++) {
+        const double value = (double) i;
+        list_push(&lst, &value);
+    }
+
+    printf("operation,threads,elements,ms,speedup,gb_per_sec\n");
+
+    uint64_t for_base = 0;
+    uint64_t reduce_base = 0;
+    for (size_t threads = 1;; threads *= 2) {
+        if (threads > max_threads) threads = max_threads;
+
+        const uint64_t for_ns = run_for(&lst, threads);
+        const uint64_t reduce_ns = run_reduce(&lst, threads);
+        if (threads == 1) {
+            for_base = for_ns;
+            reduce_base = reduce_ns;
+        }
+
+        const double bytes = (double) elements * sizeof(double);
+        printf("for,%zu,%zu,%.3f,%.2f,%.2f\n", threads, elements, (double) for_ns / 1e6,
+               (double) for_base / (double) for_ns, 2.0 * bytes / (double) for_ns);
+        printf("reduce,%zu,%zu,%.3f,%.2f,%.2f\n", threads, elements, (double) reduce_ns / 1e6,
+               (double) reduce_base / (double) reduce_ns, bytes / (double) reduce_ns);
+
+        if (threads == max_threads) break;
+    }
+
+    list_parallel_shutdown();
+    list_destroy(&lst);
+    return 0;
+}
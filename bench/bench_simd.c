@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list.h"
+#include "bench.h"
+
+// Compares list_find, list_count and list_fill against element-by-element
+// loops, for each element size with a vector kernel. Run with LIST_SIMD set
+// to compare tiers. Output is CSV.
+// Usage: list_bench_simd [elements] [repeats]
+
+static size_t naive_find(const list* lst, const void* value) {
+    for (size_t i = 0; i < lst->size; i++) {
+        if (memcmp((const uint8_t*) lst->data + i * lst->elem_size, value, lst->elem_size) == 0) return i;
+    }
+    return LIST_NOT_FOUND;
+}
+
+static size_t naive_count(const list* lst, const void* value) {
+    size_t matches = 0;
+    for (size_t i = 0; i < lst->size; i++) {
+        matches += memcmp((const uint8_t*) lst->data + i * lst->elem_size, value, lst->elem_size) == 0;
+    }
+    return matches;
+}
+
+static void report(const char* op, const char* variant, const size_t elem_size, const size_t elements,
+                   const uint64_t elapsed, const uint64_t base) {
+    printf("%s,%s,%s,%zu,%zu,%.3f,%.2f\n", op, variant, list_simd_backend(), elem_size, elements,
+           (double) elapsed / 1e6, (double) base / (double) elapsed);
+}
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 4000000;
+    const size_t repeats = argc > 2 ? strtoull(argv[2], nullptr, 10) : 10;
+    static const size_t elem_sizes[] = { 1, 2, 4, 8 };
+
+    printf("op,variant,backend,elem_size,elements,ms,speedup_vs_loop\n");
+
+    for (size_t s = 0; s < sizeof elem_sizes / sizeof elem_sizes[0]; s++) {
+        const size_t elem_size = elem_sizes[s];
+        const uint8_t zero[8] = { 0 };
+        const uint8_t needle[8] = { 1, 1, 1, 1, 1, 1, 1, 1 };
+
+        list lst;
+        if (list_init_with_capacity(&lst, elements, elem_size) != LIST_OK) {
+            fprintf(stderr, "Failed to allocate benchmark input.\n");
+            return 1;
+        }
+
+        // Fill: pushing one element at a time versus a single list_fill
+        uint64_t start = bench_now_ns();
+        for (size_t r = 0; r < repeats; r++) {
+            list_clear(&lst);
+            for (size_t i = 0; i < elements; i++) list_push(&lst, zero);
+        }
+        const uint64_t push_ns = bench_now_ns() - start;
+        report("fill", "push_loop", elem_size, elements, push_ns, push_ns);
+
+        start = bench_now_ns();
+        for (size_t r = 0; r < repeats; r++) {
+            list_clear(&lst);
+            list_fill(&lst, zero, elements);
+        }
+        report("fill", "list_fill", elem_size, elements, bench_now_ns() - start, push_ns);
+
+        // Search: the only match is the last element, so the whole list is scanned
+        list_set(&lst, elements - 1, needle);
+        size_t found = 0;
+
+        start = bench_now_ns();
+        for (size_t r = 0; r < repeats; r++) found += naive_find(&lst, needle);
+        const uint64_t find_ns = bench_now_ns() - start;
+        report("find", "loop", elem_size, elements, find_ns, find_ns);
+
+        start = bench_now_ns();
+        for (size_t r = 0; r < repeats; r++) found += list_find(&lst, needle);
+        report("find", "list_find", elem_size, elements, bench_now_ns() - start, find_ns);
+
+        start = bench_now_ns();
+        for (size_t r = 0; r < repeats; r++) found += naive_count(&lst, needle);
+        const uint64_t count_ns = bench_now_ns() - start;
+        report("count", "loop", elem_size, elements, count_ns, count_ns);
+
+        start = bench_now_ns();
+        for (size_t r = 0; r < repeats; r++) found += list_count(&lst, needle);
+        report("count", "list_count", elem_size, elements, bench_now_ns() - start, count_ns);
+
+        bench_do_not_optimize(&found);
+        list_destroy(&lst);
+    }
+
+    return 0;
+}
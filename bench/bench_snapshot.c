@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "list_segmented.h"
+#include "list_snapshot.h"
+#include "bench.h"
+
+// Times `copies` read-mostly copies of a list of `elements` 8-byte values:
+// a deep copy with list_extend against a list_snapshot, each followed by
+// one list_set, and the same for a list_segmented snapshot, where the write
+// copies only the chunk it lands in. Output is CSV.
+// Usage: list_bench_snapshot [elements] [copies]
+
+static void report(const char* variant, const size_t elements, const size_t copies, const uint64_t elapsed) {
+    printf("%s,%zu,%zu,%.3f,%.1f\n",
+           variant, elements, copies, (double) elapsed / 1e6, (double) elapsed / (double) copies);
+}
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 4000000;
+    const size_t copies = argc > 2 ? strtoull(argv[2], nullptr, 10) : 50;
+    uint64_t checksum = 0;
+
+    printf("variant,elements,copies,ms,ns_per_copy\n");
+
+    list source;
+    list_init_with_capacity(&source, elements, sizeof(uint64_t));
+    list_segmented seg;
+    list_segmented_init(&seg, sizeof(uint64_t));
+    for (uint64_t i = 0; i < elements; i++) {
+        list_push(&source, &i);
+        list_segmented_push(&seg, &i);
+    }
+
+    const uint64_t marker = UINT64_MAX;
+    const size_t target = elements / 2;
+
+    uint64_t start = bench_now_ns();
+    for (size_t c = 0; c < copies; c++) {
+        list copy;
+        list_init(&copy, sizeof(uint64_t));
+        list_extend(&copy, &source);
+        checksum += list_size(&copy);
+        list_destroy(&copy);
+    }
+    report("deep_copy", elements, copies, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t c = 0; c < copies; c++) {
+        list snap;
+        list_snapshot(&source, &snap);
+        checksum += list_size(&snap);
+        list_destroy(&snap);
+    }
+    report("snapshot", elements, copies, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t c = 0; c < copies; c++) {
+        list copy;
+        list_init(&copy, sizeof(uint64_t));
+        list_extend(&copy, &source);
+        list_set(&copy, target, &marker);
+        checksum += *(const uint64_t*) list_at(&copy, target);
+        list_destroy(&copy);
+    }
+    report("deep_copy_write", elements, copies, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t c = 0; c < copies; c++) {
+        list snap;
+        list_snapshot(&source, &snap);
+        list_set(&snap, target, &marker);
+        checksum += *(const uint64_t*) list_at(&snap, target);
+        list_destroy(&snap);
+    }
+    report("snapshot_write", elements, copies, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t c = 0; c < copies; c++) {
+        list_segmented snap;
+        list_segmented_snapshot(&seg, &snap);
+        list_segmented_set(&snap, 0, &marker);
+        checksum += *(const uint64_t*) list_segmented_at(&snap, 0);
+        list_segmented_destroy(&snap);
+    }
+    report("segmented_snapshot_write", elements, copies, bench_now_ns() - start);
+
+    bench_do_not_optimize(&checksum);
+    list_destroy(&source);
+    list_segmented_destroy(&seg);
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "list_soa.h"
+#include "bench.h"
+
+// Sums one 8-byte field of `rows` 32-byte records stored as a list of
+// structs (array of structs) and as a list_soa (struct of arrays), and
+// times filling each. Output is CSV.
+// Usage: list_bench_soa [rows] [passes]
+
+typedef struct record {
+    uint64_t id;
+    uint64_t timestamp;
+    double   value;
+    uint32_t flags;
+    uint32_t kind;
+} record;
+
+static void report(const char* variant, const char* op, const size_t rows, const size_t passes, const uint64_t elapsed) {
+    const double bytes = (double) rows * (double) passes * (double) sizeof(double);
+    printf("%s,%s,%zu,%zu,%.3f,%.2f\n",
+           variant, op, rows, passes, (double) elapsed / 1e6, bytes / (double) elapsed);
+}
+
+int main(const int argc, char** argv) {
+    const size_t rows = argc > 1 ? strtoull(argv[1], nullptr, 10) : 4000000;
+    const size_t passes = argc > 2 ? strtoull(argv[2], nullptr, 10) : 10;
+    double checksum = 0;
+
+    printf("variant,op,rows,passes,ms,useful_gb_per_s\n");
+
+    list aos;
+    list_init(&aos, sizeof(record));
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < rows; i++) {
+        const record row = { i, 1000 + i, (double) (i % 1000), (uint32_t) i, (uint32_t) (i % 7) };
+        list_push(&aos, &row);
+    }
+    report("aos", "push", rows, 1, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t pass = 0; pass < passes; pass++) {
+        const record* records = list_data(&aos);
+        double sum = 0;
+        for (size_t i = 0; i < rows; i++) sum += records[i].value;
+        checksum += sum;
+    }
+    report("aos", "scan", rows, passes, bench_now_ns() - start);
+    list_destroy(&aos);
+
+    const list_soa_field schema[] = {
+        LIST_SOA_FIELD(record, id), LIST_SOA_FIELD(record, timestamp), LIST_SOA_FIELD(record, value),
+        LIST_SOA_FIELD(record, flags), LIST_SOA_FIELD(record, kind),
+    };
+    list_soa soa;
+    list_soa_init(&soa, schema, sizeof(schema) / sizeof(schema[0]));
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < rows; i++) {
+        const record row = { i, 1000 + i, (double) (i % 1000), (uint32_t) i, (uint32_t) (i % 7) };
+        list_soa_push(&soa, &row);
+    }
+    report("soa", "push", rows, 1, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t pass = 0; pass < passes; pass++) {
+        const double* values = list_soa_column(&soa, 2);
+        double sum = 0;
+        for (size_t i = 0; i < rows; i++) sum += values[i];
+        checksum += sum;
+    }
+    report("soa", "scan", rows, passes, bench_now_ns() - start);
+    list_soa_destroy(&soa);
+
+    bench_do_not_optimize(&checksum);
+    return 0;
+}
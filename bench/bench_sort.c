@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list.h"
+#include "list_parallel.h"
+#include "list_sort.h"
+#include "bench.h"
+
+// Compares qsort on the raw buffer against list_sort, the radix fast path of
+// list_sort_keys and list_sort_parallel, on random keys. Output is CSV.
+// Usage: list_bench_sort [elements]
+
+static int compare_u32(const void* a, const void* b) {
+    const uint32_t x = *(const uint32_t*) a;
+    const uint32_t y = *(const uint32_t*) b;
+    return (x > y) - (x < y);
+}
+
+static int compare_u64(const void* a, const void* b) {
+    const uint64_t x = *(const uint64_t*) a;
+    const uint64_t y = *(const uint64_t*) b;
+    return (x > y) - (x < y);
+}
+
+static int compare_f64(const void* a, const void* b) {
+    const double x = *(const double*) a;
+    const double y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief One key type to benchmark.
+ */
+typedef struct sort_case {
+    const char*   name;
+    size_t        elem_size;
+    list_key_type key_type;
+    int         (*cmp)(const void* a, const void* b);
+} sort_case;
+
+static const sort_case sort_cases[] = {
+    { "u32", sizeof(uint32_t), LIST_KEY_U32, compare_u32 },
+    { "u64", sizeof(uint64_t), LIST_KEY_U64, compare_u64 },
+    { "f64", sizeof(double),   LIST_KEY_F64, compare_f64 },
+};
+
+static void fill_random(list* lst, const sort_case* c, const size_t elements) {
+    uint64_t state = 0x9e3779b97f4a7c15u;
+    list_clear(lst);
+    for (size_t i = 0; i < elements; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        uint8_t value[8];
+        if (c->key_type == LIST_KEY_F64) {
+            const double d = (double) (state >> 11) / 1e6 - 4e9;
+            memcpy(value, &d, sizeof d);
+        } else {
+            memcpy(value, &state, c->elem_size);
+        }
+        list_push(lst, value);
+    }
+}
+
+static void report(const char* variant, const sort_case* c, const size_t elements, const uint64_t elapsed, const uint64_t base) {
+    printf("%s,%s,%zu,%.3f,%.2f\n",
+           variant, c->name, elements, (double) elapsed / 1e6, (double) base / (double) elapsed);
+}
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+
+    printf("variant,key,elements,ms,speedup_vs_qsort\n");
+
+    for (size_t i = 0; i < sizeof sort_cases / sizeof sort_cases[0]; i++) {
+        const sort_case* c = &sort_cases[i];
+
+        list lst;
+        if (list_init_with_capacity(&lst, elements, c->elem_size) != LIST_OK) {
+            fprintf(stderr, "Failed to allocate benchmark input.\n");
+            return 1;
+        }
+
+        fill_random(&lst, c, elements);
+        uint64_t start = bench_now_ns();
+        qsort(lst.data, lst.size, lst.elem_size, c->cmp);
+        const uint64_t qsort_ns = bench_now_ns() - start;
+        report("qsort", c, elements, qsort_ns, qsort_ns);
+
+        fill_random(&lst, c, elements);
+        start = bench_now_ns();
+        list_sort(&lst, c->cmp);
+        report("list_sort", c, elements, bench_now_ns() - start, qsort_ns);
+
+        fill_random(&lst, c, elements);
+        start = bench_now_ns();
+        list_sort_keys(&lst, c->key_type);
+        report("list_sort_keys", c, elements, bench_now_ns() - start, qsort_ns);
+
+        fill_random(&lst, c, elements);
+        start = bench_now_ns();
+        list_sort_parallel(&lst, c->cmp, 0);
+        report("list_sort_parallel", c, elements, bench_now_ns() - start, qsort_ns);
+
+        list_destroy(&lst);
+    }
+
+    list_parallel_shutdown();
+    return 0;
+}
@@ -0,0 +1,182 @@
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+#include "list.h"
+#include "list_deque.h"
+#include "list_sort.h"
+#include "list_spsc.h"
+#include "bench.h"
+
+// Measures the latency of handing records from a producer thread to a
+// consumer thread through list_spsc, against a mutex-protected FIFO
+// (list_deque under mtx_t). "pingpong" keeps one record in flight, which
+// isolates the cost of a single handoff; "stream" pushes batches as fast as
+// the queue accepts them, so latency there includes queueing. Latency runs
+// from just before the push to just after the pop. Output is CSV.
+// Usage: list_bench_spsc [messages]
+
+enum { queue_capacity = 1024, spins_before_yield = 4096 };
+
+typedef struct record {
+    uint64_t seq;
+    uint64_t sent_ns;
+} record;
+
+typedef struct bench_queue {
+    bool         use_spsc;
+    list_spsc    spsc;
+    list_deque   locked;
+    mtx_t        lock;
+    atomic_ulong received;
+} bench_queue;
+
+typedef struct bench_run {
+    bench_queue* q;
+    size_t       messages;
+    size_t       batch;
+    bool         pingpong;
+    list*        latencies;
+} bench_run;
+
+static void spin(unsigned* spins) {
+    if (++*spins < spins_before_yield) return;
+    *spins = 0;
+    thrd_yield();
+}
+
+static size_t queue_push(bench_queue* q, const record* records, const size_t count) {
+    if (q->use_spsc) return list_spsc_push_n(&q->spsc, records, count);
+
+    size_t pushed = 0;
+    mtx_lock(&q->lock);
+    while (pushed < count && list_deque_size(&q->locked) < queue_capacity) {
+        list_deque_push_back(&q->locked, &records[pushed++]);
+    }
+    mtx_unlock(&q->lock);
+    return pushed;
+}
+
+static size_t queue_pop(bench_queue* q, record* records, const size_t max_count) {
+    if (q->use_spsc) return list_spsc_pop_n(&q->spsc, records, max_count);
+
+    size_t popped = 0;
+    mtx_lock(&q->lock);
+    while (popped < max_count && list_deque_pop_front(&q->locked, &records[popped]) == LIST_OK) popped++;
+    mtx_unlock(&q->lock);
+    return popped;
+}
+
+static int producer(void* arg) {
+    const bench_run* run = arg;
+    record batch[256];
+    size_t sent = 0;
+
+    while (sent < run->messages) {
+        const size_t want = run->messages - sent < run->batch ? run->messages - sent : run->batch;
+
+        unsigned spins = 0;
+        if (run->pingpong) {
+            while (atomic_load_explicit(&run->q->received, memory_order_acquire) < sent) spin(&spins);
+        }
+
+        const uint64_t now = bench_now_ns();
+        for (size_t i = 0; i < want; i++) batch[i] = (record) { sent + i, now };
+
+        size_t pushed = 0;
+        while (pushed < want) {
+            const size_t n = queue_push(run->q, batch + pushed, want - pushed);
+            if (n == 0) spin(&spins);
+            pushed += n;
+        }
+        sent += want;
+    }
+    return 0;
+}
+
+static void consume(const bench_run* run) {
+    record batch[256];
+    size_t received = 0;
+    unsigned spins = 0;
+
+    while (received < run->messages) {
+        const size_t n = queue_pop(run->q, batch, run->batch);
+        if (n == 0) {
+            spin(&spins);
+            continue;
+        }
+
+        const uint64_t now = bench_now_ns();
+        for (size_t i = 0; i < n; i++) {
+            const uint64_t latency = now - batch[i].sent_ns;
+            list_push(run->latencies, &latency);
+        }
+        received += n;
+        atomic_store_explicit(&run->q->received, received, memory_order_release);
+    }
+}
+
+static uint64_t percentile(const list* sorted, const double p) {
+    const size_t index = (size_t) ((double) (sorted->size - 1) * p);
+    return *(const uint64_t*) list_at(sorted, index);
+}
+
+static int run_case(const bool use_spsc, const bool pingpong, const size_t batch, const size_t messages) {
+    bench_queue q = { .use_spsc = use_spsc };
+    atomic_init(&q.received, 0);
+    if (use_spsc) {
+        if (list_spsc_init(&q.spsc, queue_capacity, sizeof(record)) != LIST_OK) return 1;
+    } else {
+        if (list_deque_init_with_capacity(&q.locked, queue_capacity, sizeof(record)) != LIST_OK) return 1;
+        mtx_init(&q.lock, mtx_plain);
+    }
+
+    list latencies;
+    if (list_init_with_capacity(&latencies, messages, sizeof(uint64_t)) != LIST_OK) return 1;
+
+    bench_run run = { &q, messages, batch, pingpong, &latencies };
+
+    thrd_t handle;
+    const uint64_t start = bench_now_ns();
+    if (thrd_create(&handle, producer, &run) != thrd_success) return 1;
+    consume(&run);
+    thrd_join(handle, nullptr);
+    const uint64_t elapsed = bench_now_ns() - start;
+
+    list_sort_keys(&latencies, LIST_KEY_U64);
+    printf("%s,%s,%zu,%zu,%llu,%llu,%.2f\n",
+           use_spsc ? "list_spsc" : "mutex_deque",
+           pingpong ? "pingpong" : "stream",
+           batch,
+           messages,
+           (unsigned long long) percentile(&latencies, 0.50),
+           (unsigned long long) percentile(&latencies, 0.99),
+           (double) messages * 1e3 / (double) elapsed);
+
+    list_destroy(&latencies);
+    if (use_spsc) {
+        list_spsc_destroy(&q.spsc);
+    } else {
+        list_deque_destroy(&q.locked);
+        mtx_destroy(&q.lock);
+    }
+    return 0;
+}
+
+int main(const int argc, char** argv) {
+    const size_t messages = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    static const size_t batches[] = { 1, 16, 256 };
+
+    if (messages == 0) return 0;
+
+    printf("variant,mode,batch,messages,p50_ns,p99_ns,mmsgs_per_sec\n");
+
+    for (int use_spsc = 0; use_spsc <= 1; use_spsc++) {
+        if (run_case(use_spsc, true, 1, messages / 10 + 1) != 0) return 1;
+        for (size_t b = 0; b < sizeof batches / sizeof batches[0]; b++) {
+            if (run_case(use_spsc, false, batches[b], messages) != 0) return 1;
+        }
+    }
+
+    return 0;
+}
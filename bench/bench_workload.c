@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+#include "list_deque.h"
+#include "list_soa.h"
+#include "list_sort.h"
+#include "bench.h"
+
+// A mixed workload over the hot calls of the other benchmarks: element-wise
+// push/get/set/pop, middle inserts and erases, find and count, gather,
+// sorting, a deque work queue and a struct-of-arrays scan. It is built
+// against list, list_lto (with LTO, so the library inlines into the caller)
+// and list_inline (amalgamated, without LTO), and it is the training run for
+// LIST_PGO=GENERATE (the list_pgo_train target). Output is CSV.
+// Usage: list_bench_workload [elements] [rounds]
+
+typedef struct sample {
+    uint64_t id;
+    double   value;
+    uint32_t flags;
+} sample;
+
+static void report(const char* phase, const size_t operations, const uint64_t elapsed) {
+    printf("%s,%zu,%.3f,%.2f\n", phase, operations, (double) elapsed / 1e6, (double) elapsed / (double) operations);
+}
+
+static uint64_t next_random(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static uint64_t run_elementwise(const size_t elements, uint64_t* checksum) {
+    const uint64_t start = bench_now_ns();
+
+    list lst;
+    list_init(&lst, sizeof(uint64_t));
+    for (uint64_t i = 0; i < elements; i++) list_push(&lst, &i);
+
+    for (size_t i = 0; i < elements; i++) {
+        uint64_t value = 0;
+        list_get(&lst, i, &value);
+        value = value * 3 + 1;
+        list_set(&lst, i, &value);
+    }
+
+    for (size_t i = 0; i < elements; i++) {
+        uint64_t value = 0;
+        list_pop(&lst, &value);
+        *checksum += value;
+    }
+
+    list_destroy(&lst);
+    return bench_now_ns() - start;
+}
+
+static uint64_t run_edits(const size_t elements, uint64_t* checksum) {
+    const size_t edits = elements / 64 + 1;
+    const uint64_t start = bench_now_ns();
+
+    list lst;
+    list_init(&lst, sizeof(uint32_t));
+    for (uint32_t i = 0; i < 1024; i++) list_push(&lst, &i);
+
+    uint64_t state = 0x2545f4914f6cdd1du;
+    for (size_t i = 0; i < edits; i++) {
+        const uint32_t value = (uint32_t) i;
+        list_insert_at(&lst, next_random(&state) % list_size(&lst), &value);
+        list_swap_remove(&lst, next_random(&state) % list_size(&lst), nullptr);
+        list_erase_at(&lst, next_random(&state) % list_size(&lst), nullptr);
+        list_push(&lst, &value);
+    }
+    *checksum += list_size(&lst);
+
+    list_destroy(&lst);
+    return bench_now_ns() - start;
+}
+
+static uint64_t run_search(const size_t elements, uint64_t* checksum) {
+    list lst;
+    list_init(&lst, sizeof(uint32_t));
+    for (uint32_t i = 0; i < elements; i++) {
+        const uint32_t value = i % 1000;
+        list_push(&lst, &value);
+    }
+
+    size_t* indices = malloc(elements * sizeof(size_t));
+    uint32_t* out = malloc(elements * sizeof(uint32_t));
+    uint64_t state = 0x9e3779b97f4a7c15u;
+    for (size_t i = 0; i < elements; i++) indices[i] = (size_t) (next_random(&state) % elements);
+
+    const uint64_t start = bench_now_ns();
+    for (uint32_t needle = 990; needle < 1000; needle++) {
+        *checksum += list_find(&lst, &needle) + list_count(&lst, &needle);
+    }
+    list_gather(&lst, indices, elements, out, nullptr);
+    *checksum += out[elements / 2];
+    list_sort_keys(&lst, LIST_KEY_U32);
+    *checksum += *(const uint32_t*) list_at(&lst, elements / 2);
+    const uint64_t elapsed = bench_now_ns() - start;
+
+    free(out);
+    free(indices);
+    list_destroy(&lst);
+    return elapsed;
+}
+
+static uint64_t run_queue(const size_t elements, uint64_t* checksum) {
+    const uint64_t start = bench_now_ns();
+
+    list_deque dq;
+    list_deque_init(&dq, sizeof(uint64_t));
+    for (uint64_t i = 0; i < 256; i++) list_deque_push_back(&dq, &i);
+
+    for (uint64_t i = 0; i < elements; i++) {
+        uint64_t item;
+        list_deque_pop_front(&dq, &item);
+        *checksum += item;
+        list_deque_push_back(&dq, &i);
+    }
+
+    list_deque_destroy(&dq);
+    return bench_now_ns() - start;
+}
+
+static uint64_t run_columns(const size_t elements, uint64_t* checksum) {
+    const uint64_t start = bench_now_ns();
+
+    const list_soa_field schema[] = {
+        LIST_SOA_FIELD(sample, id), LIST_SOA_FIELD(sample, value), LIST_SOA_FIELD(sample, flags),
+    };
+    list_soa soa;
+    list_soa_init(&soa, schema, 3);
+
+    for (uint64_t i = 0; i < elements; i++) {
+        const sample row = { i, (double) (i % 100), (uint32_t) i };
+        list_soa_push(&soa, &row);
+    }
+
+    const double* values = list_soa_column(&soa, 1);
+    double sum = 0;
+    for (size_t i = 0; i < list_soa_size(&soa); i++) sum += values[i];
+    *checksum += (uint64_t) sum;
+
+    list_soa_destroy(&soa);
+    return bench_now_ns() - start;
+}
+
+int main(const int argc, char** argv) {
+    const size_t elements = argc > 1 ? strtoull(argv[1], nullptr, 10) : 2000000;
+    const size_t rounds = argc > 2 ? strtoull(argv[2], nullptr, 10) : 3;
+    uint64_t checksum = 0;
+
+    typedef uint64_t (*phase_fn)(size_t elements, uint64_t* checksum);
+    static const char* const names[] = { "elementwise", "edits", "search", "queue", "columns" };
+    static const phase_fn phases[] = { run_elementwise, run_edits, run_search, run_queue, run_columns };
+    enum { phase_count = sizeof(phases) / sizeof(phases[0]) };
+
+    uint64_t best[phase_count];
+    for (size_t p = 0; p < phase_count; p++) best[p] = UINT64_MAX;
+
+    for (size_t r = 0; r < rounds; r++) {
+        for (size_t p = 0; p < phase_count; p++) {
+            const uint64_t elapsed = phases[p](elements, &checksum);
+            if (elapsed < best[p]) best[p] = elapsed;
+        }
+    }
+
+    printf("phase,elements,ms,ns_per_element\n");
+
+    uint64_t total = 0;
+    for (size_t p = 0; p < phase_count; p++) {
+        report(names[p], elements, best[p]);
+        total += best[p];
+    }
+    report("total", elements, total);
+
+    bench_do_not_optimize(&checksum);
+    return 0;
+}
@@ -0,0 +1,59 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "list.h"
+#include "bench.h"
+
+// Counts the minor page faults taken while growing a large list with and without
+// LIST_FLAG_ZERO_FILL. Usage: list_bench_zero_fill [element_count]
+
+static constexpr size_t batch_size = 4096;
+
+static long page_faults(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+}
+
+static int run(const char* name, const unsigned flags, const size_t count) {
+    uint64_t batch[batch_size];
+    for (size_t i = 0; i < batch_size; i++) batch[i] = i;
+
+    list lst;
+    if (list_init_with_flags(&lst, 0, sizeof(uint64_t), flags) != LIST_OK) return 1;
+
+    const long faults_before = page_faults();
+    const uint64_t start = bench_now_ns();
+
+    for (size_t pushed = 0; pushed < count; pushed += batch_size) {
+        const size_t n = count - pushed < batch_size ? count - pushed : batch_size;
+        if (list_push_n(&lst, batch, n) != LIST_OK) {
+            list_destroy(&lst);
+            return 1;
+        }
+    }
+
+    const uint64_t elapsed = bench_now_ns() - start;
+    const long faults = page_faults() - faults_before;
+
+    printf("%-10s %12zu %12zu %12ld %12.2f\n",
+           name, lst.size, lst.capacity, faults, (double) elapsed / 1e6);
+
+    list_destroy(&lst);
+    return 0;
+}
+
+int main(const int argc, char** argv) {
+    const size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 20u * 1000u * 1000u;
+
+    printf("%-10s %12s %12s %12s %12s\n", "mode", "size", "capacity", "minflt", "ms");
+
+    if (run("uninit", LIST_FLAG_NONE, count) != 0 || run("zero_fill", LIST_FLAG_ZERO_FILL, count) != 0) {
+        fprintf(stderr, "Allocation failed.\n");
+        return 1;
+    }
+
+    return 0;
+}
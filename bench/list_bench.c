@@ -0,0 +1,334 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "list.h"
+#include "bench.h"
+
+// Microbenchmark suite for the core list operations. Results are written as CSV
+// (default) or JSON lines so they can be tracked over time.
+// Usage: list_bench [--json] [--ops N]
+//
+// Timings use the default malloc/realloc path. Allocations are counted in a
+// second, untimed pass through a counting allocator, over the timed region
+// only. Every case runs in its own process, so peak RSS is per case.
+
+/**
+ * @brief Inputs shared by every benchmark case.
+ *
+ * `allocator` is `NULL` for the timed pass. In the counting pass it
+ * increments `*allocs`, and `bench_stop` stores the number of allocations
+ * made since `bench_start` in `*timed_allocs`.
+ */
+typedef struct bench_params {
+    size_t                elem_size;
+    size_t                ops;
+    size_t                working_set;
+    const list_allocator* allocator;
+    size_t*               allocs;
+    size_t*               timed_allocs;
+    const uint8_t*        value;
+    const size_t*         random_indices;
+} bench_params;
+
+/**
+ * @brief The start of a timed region, see `bench_start`.
+ */
+typedef struct bench_timer {
+    uint64_t start_ns;
+    size_t   start_allocs;
+} bench_timer;
+
+/**
+ * @brief A named benchmark. `run` returns the elapsed time in nanoseconds, or 0 on failure.
+ */
+typedef struct bench_case {
+    const char* name;
+    uint64_t (*run)(const bench_params* p);
+} bench_case;
+
+static constexpr size_t swing_depth = 4096;
+
+static bench_timer bench_start(const bench_params* p) {
+    bench_timer timer;
+    timer.start_allocs = p->allocs != nullptr ? *p->allocs : 0;
+    timer.start_ns = bench_now_ns();
+    return timer;
+}
+
+static uint64_t bench_stop(const bench_params* p, const bench_timer* timer) {
+    const uint64_t elapsed = bench_now_ns() - timer->start_ns;
+    if (p->allocs != nullptr) *p->timed_allocs = *p->allocs - timer->start_allocs;
+    return elapsed;
+}
+
+static bool fill_list(list* lst, const bench_params* p, const size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (list_push(lst, p->value) != LIST_OK) return false;
+    }
+    return true;
+}
+
+static uint64_t run_push_grow(const bench_params* p) {
+    list lst;
+    if (list_init_with_allocator(&lst, 0, p->elem_size, p->allocator) != LIST_OK) return 0;
+
+    const bench_timer timer = bench_start(p);
+    const bool ok = fill_list(&lst, p, p->ops);
+    const uint64_t elapsed = bench_stop(p, &timer);
+
+    list_destroy(&lst);
+    return ok ? elapsed : 0;
+}
+
+static uint64_t run_push_presized(const bench_params* p) {
+    list lst;
+    if (list_init_with_allocator(&lst, p->ops, p->elem_size, p->allocator) != LIST_OK) return 0;
+
+    const bench_timer timer = bench_start(p);
+    const bool ok = fill_list(&lst, p, p->ops);
+    const uint64_t elapsed = bench_stop(p, &timer);
+
+    list_destroy(&lst);
+    return ok ? elapsed : 0;
+}
+
+static uint64_t run_push_pop_swing_with_policy(const bench_params* p, const list_shrink_policy policy) {
+    list lst;
+    if (list_init_with_allocator(&lst, 0, p->elem_size, p->allocator) != LIST_OK) return 0;
+    list_set_shrink_policy(&lst, policy, 0);
+
+    bool ok = true;
+    const bench_timer timer = bench_start(p);
+    for (size_t done = 0; ok && done < p->ops; done += 2 * swing_depth) {
+        ok = fill_list(&lst, p, swing_depth);
+        for (size_t i = 0; ok && i < swing_depth; i++) {
+            ok = list_pop(&lst, nullptr) == LIST_OK;
+        }
+    }
+    const uint64_t elapsed = bench_stop(p, &timer);
+
+    list_destroy(&lst);
+    return ok ? elapsed : 0;
+}
+
+static uint64_t run_push_pop_swing(const bench_params* p) {
+    return run_push_pop_swing_with_policy(p, LIST_SHRINK_QUARTER);
+}
+
+static uint64_t run_push_pop_swing_noshrink(const bench_params* p) {
+    return run_push_pop_swing_with_policy(p, LIST_SHRINK_NEVER);
+}
+
+static uint64_t run_push_pop_threshold(const bench_params* p) {
+    list lst;
+    if (list_init_with_allocator(&lst, 0, p->elem_size, p->allocator) != LIST_OK) return 0;
+
+    // Sit exactly on the quarter-capacity boundary where list_pop starts shrinking
+    bool ok = fill_list(&lst, p, 1024);
+    while (ok && lst.size > 256) ok = list_pop(&lst, nullptr) == LIST_OK;
+
+    const bench_timer timer = bench_start(p);
+    for (size_t done = 0; ok && done < p->ops; done += 2) {
+        ok = list_pop(&lst, nullptr) == LIST_OK && list_push(&lst, p->value) == LIST_OK;
+    }
+    const uint64_t elapsed = bench_stop(p, &timer);
+
+    list_destroy(&lst);
+    return ok ? elapsed : 0;
+}
+
+static uint64_t run_get_with_indices(const bench_params* p, const size_t* indices) {
+    list lst;
+    if (list_init_with_allocator(&lst, p->working_set, p->elem_size, p->allocator) != LIST_OK) return 0;
+    if (!fill_list(&lst, p, p->working_set)) {
+        list_destroy(&lst);
+        return 0;
+    }
+
+    uint8_t* out = malloc(p->elem_size);
+    if (out == nullptr) {
+        list_destroy(&lst);
+        return 0;
+    }
+
+    const bench_timer timer = bench_start(p);
+    for (size_t i = 0; i < p->ops; i++) {
+        list_get(&lst, indices != nullptr ? indices[i] : i % p->working_set, out);
+        bench_do_not_optimize(out);
+    }
+    const uint64_t elapsed = bench_stop(p, &timer);
+
+    free(out);
+    list_destroy(&lst);
+    return elapsed;
+}
+
+static uint64_t run_get_sequential(const bench_params* p) {
+    return run_get_with_indices(p, nullptr);
+}
+
+static uint64_t run_get_random(const bench_params* p) {
+    return run_get_with_indices(p, p->random_indices);
+}
+
+static uint64_t run_set_random(const bench_params* p) {
+    list lst;
+    if (list_init_with_allocator(&lst, p->working_set, p->elem_size, p->allocator) != LIST_OK) return 0;
+    if (!fill_list(&lst, p, p->working_set)) {
+        list_destroy(&lst);
+        return 0;
+    }
+
+    const bench_timer timer = bench_start(p);
+    for (size_t i = 0; i < p->ops; i++) {
+        list_set(&lst, p->random_indices[i], p->value);
+    }
+    bench_do_not_optimize(lst.data);
+    const uint64_t elapsed = bench_stop(p, &timer);
+
+    list_destroy(&lst);
+    return elapsed;
+}
+
+static uint64_t run_clear_refill(const bench_params* p) {
+    list lst;
+    if (list_init_with_allocator(&lst, 0, p->elem_size, p->allocator) != LIST_OK) return 0;
+
+    bool ok = true;
+    const bench_timer timer = bench_start(p);
+    for (size_t done = 0; ok && done < p->ops; done += swing_depth) {
+        list_clear(&lst);
+        ok = fill_list(&lst, p, swing_depth);
+    }
+    const uint64_t elapsed = bench_stop(p, &timer);
+
+    list_destroy(&lst);
+    return ok ? elapsed : 0;
+}
+
+static const bench_case bench_cases[] = {
+    { "push_grow",               run_push_grow },
+    { "push_presized",           run_push_presized },
+    { "push_pop_swing",          run_push_pop_swing },
+    { "push_pop_swing_noshrink", run_push_pop_swing_noshrink },
+    { "push_pop_threshold",      run_push_pop_threshold },
+    { "get_sequential",          run_get_sequential },
+    { "get_random",              run_get_random },
+    { "set_random",              run_set_random },
+    { "clear_refill",            run_clear_refill },
+};
+
+/**
+ * @brief Runs one case at one element size and prints its row.
+ *
+ * Called in a fresh process, which builds its own inputs so that its peak
+ * RSS covers this case alone.
+ *
+ * @return 0 on success, 1 on failure.
+ */
+static int run_case(const bench_case* bc, const size_t elem_size, const size_t ops, const bool json) {
+    constexpr size_t working_set = 65536;
+
+    size_t* random_indices = malloc(ops * sizeof(size_t));
+    uint8_t* value = calloc(1, elem_size);
+    if (random_indices == nullptr || value == nullptr) {
+        fprintf(stderr, "Failed to allocate benchmark input.\n");
+        free(random_indices);
+        free(value);
+        return 1;
+    }
+
+    // xorshift64 keeps the index sequence identical across runs
+    uint64_t state = 0x9e3779b97f4a7c15u;
+    for (size_t i = 0; i < ops; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        random_indices[i] = (size_t) (state % working_set);
+    }
+
+    bench_params params = {
+        .elem_size      = elem_size,
+        .ops            = ops,
+        .working_set    = working_set,
+        .value          = value,
+        .random_indices = random_indices,
+    };
+    const uint64_t elapsed = bc->run(&params);
+
+    size_t allocs = 0;
+    size_t timed_allocs = 0;
+    const list_allocator allocator = bench_counting_allocator(&allocs);
+    params.allocator = &allocator;
+    params.allocs = &allocs;
+    params.timed_allocs = &timed_allocs;
+    const bool counted = elapsed != 0 && bc->run(&params) != 0;
+
+    free(random_indices);
+    free(value);
+
+    if (!counted) {
+        fprintf(stderr, "%s failed for elem_size %zu\n", bc->name, elem_size);
+        return 1;
+    }
+
+    const double ns_per_op = (double) elapsed / (double) ops;
+    const double allocs_per_op = (double) timed_allocs / (double) ops;
+    if (json) {
+        printf("{\"benchmark\":\"%s\",\"elem_size\":%zu,\"ops\":%zu,"
+               "\"ns_per_op\":%.3f,\"allocs_per_op\":%.6f,\"peak_rss_kb\":%ld}\n",
+               bc->name, elem_size, ops, ns_per_op, allocs_per_op, bench_peak_rss_kb());
+    } else {
+        printf("%s,%zu,%zu,%.3f,%.6f,%ld\n", bc->name, elem_size, ops, ns_per_op, allocs_per_op, bench_peak_rss_kb());
+    }
+    return 0;
+}
+
+int main(const int argc, char** argv) {
+    bool json = false;
+    size_t ops = 1000000;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (strcmp(argv[i], "--ops") == 0 && i + 1 < argc) {
+            ops = strtoull(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "Usage: %s [--json] [--ops N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (ops == 0) ops = 1;
+
+    const size_t elem_sizes[] = { 1, 4, 16, 64, 256 };
+
+    if (!json) printf("benchmark,elem_size,ops,ns_per_op,allocs_per_op,peak_rss_kb\n");
+
+    int status = 0;
+    for (size_t c = 0; c < sizeof bench_cases / sizeof bench_cases[0]; c++) {
+        for (size_t e = 0; e < sizeof elem_sizes / sizeof elem_sizes[0]; e++) {
+            // The child inherits unflushed output otherwise
+            fflush(stdout);
+
+            const pid_t pid = fork();
+            if (pid < 0) {
+                perror("fork");
+                return 1;
+            }
+            if (pid == 0) {
+                const int result = run_case(&bench_cases[c], elem_sizes[e], ops, json);
+                fflush(stdout);
+                _exit(result);
+            }
+
+            int child_status = 0;
+            if (waitpid(pid, &child_status, 0) < 0 || !WIFEXITED(child_status) || WEXITSTATUS(child_status) != 0) {
+                status = 1;
+            }
+        }
+    }
+
+    return status;
+}
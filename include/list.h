@@ -1,7 +1,195 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#ifdef LIST_ENABLE_STATS
+#include <stdatomic.h>
+#endif
+
+/**
+ * @brief A pluggable memory allocator for list buffers.
+ *
+ * A list created with `list_init_with_allocator` obtains, resizes and
+ * releases its buffer exclusively through these callbacks instead of the
+ * standard `malloc` family. Every callback receives the allocator's `ctx`
+ * pointer, and the resize and release callbacks also receive the size of
+ * the existing block, so simple allocators such as arenas and size-class
+ * pools do not need to track block sizes themselves.
+ *
+ * The allocator must outlive every list that uses it.
+ *
+ * @var list_allocator::alloc
+ *      Allocates `size` bytes aligned for any object type, or returns `NULL`
+ *      on failure. The memory does not need to be zeroed.
+ *
+ * @var list_allocator::realloc
+ *      Resizes the block at `ptr` from `old_size` to `new_size` bytes,
+ *      preserving its contents up to the smaller of the two sizes. Returns
+ *      the new block, or `NULL` on failure, leaving the original untouched.
+ *      `ptr` is never `NULL`; the list calls `alloc` for a first allocation.
+ *
+ * @var list_allocator::free
+ *      Releases the block at `ptr`, which is `size` bytes long.
+ *
+ * @var list_allocator::ctx
+ *      User data passed to every callback.
+ */
+typedef struct list_allocator {
+    void* (*alloc)(void* ctx, size_t size);
+    void* (*realloc)(void* ctx, void* ptr, size_t old_size, size_t new_size);
+    void  (*free)(void* ctx, void* ptr, size_t size);
+    void* ctx;
+} list_allocator;
+
+/**
+ * @enum list_shrink_policy
+ * @brief Controls how `list_pop` gives memory back as a list empties.
+ *
+ * @var LIST_SHRINK_QUARTER
+ *      Halve the capacity whenever the size drops below a quarter of it.
+ *      This is the default policy.
+ *
+ * @var LIST_SHRINK_NEVER
+ *      Never shrink from `list_pop`. Capacity is only released explicitly by
+ *      `list_shrink_to_fit` or `list_destroy`, which keeps `list_pop` free of
+ *      reallocations for lists whose size oscillates.
+ *
+ * @var LIST_SHRINK_RETAIN_MIN
+ *      Apply the quarter/half rule, but never shrink below the list's
+ *      `min_capacity`.
+ */
+typedef enum {
+    LIST_SHRINK_QUARTER    = 0,
+    LIST_SHRINK_NEVER      = 1,
+    LIST_SHRINK_RETAIN_MIN = 2,
+} list_shrink_policy;
+
+/**
+ * @enum list_flags
+ * @brief Optional behaviours that can be enabled on a list.
+ *
+ * Flags are combined with bitwise OR and passed to `list_init_with_flags`
+ * or `list_set_flags`.
+ *
+ * @var LIST_FLAG_NONE
+ *      No optional behaviour. Capacity reserved beyond the list's size is left
+ *      uninitialized, so the operating system can commit its pages lazily and
+ *      each page is touched only when an element is actually written to it.
+ *
+ * @var LIST_FLAG_ZERO_FILL
+ *      Zero every byte of newly reserved capacity, both at initialization and
+ *      whenever the list grows. Only needed by callers that read the buffer
+ *      beyond `size` through `list_data`.
+ */
+typedef enum {
+    LIST_FLAG_NONE      = 0,
+    LIST_FLAG_ZERO_FILL = 1u << 0,
+} list_flags;
+
+/**
+ * @enum list_capacity_rounding
+ * @brief Controls how the capacity chosen by the growth policy is rounded up.
+ *
+ * @var LIST_ROUND_NONE
+ *      Use the capacity computed from the growth factor as-is. This is the default.
+ *
+ * @var LIST_ROUND_USABLE_SIZE
+ *      After each growth, extend the capacity to cover all of the block the
+ *      allocator actually handed out (as reported by `malloc_usable_size`), so
+ *      the slack the allocator's size classes add is used rather than wasted.
+ *      Only effective with the standard allocator on glibc; elsewhere it
+ *      behaves like `LIST_ROUND_NONE`.
+ *
+ * @var LIST_ROUND_PAGE
+ *      Round buffers of at least `LIST_PAGE_ROUND_THRESHOLD` bytes up to a
+ *      multiple of `LIST_PAGE_SIZE`, matching how large allocations are
+ *      served by the operating system.
+ */
+typedef enum {
+    LIST_ROUND_NONE        = 0,
+    LIST_ROUND_USABLE_SIZE = 1,
+    LIST_ROUND_PAGE        = 2,
+} list_capacity_rounding;
+
+/**
+ * @brief Page size assumed by `LIST_ROUND_PAGE`.
+ */
+#define LIST_PAGE_SIZE 4096
+
+/**
+ * @brief Buffer size in bytes from which `LIST_ROUND_PAGE` rounds to page multiples.
+ */
+#define LIST_PAGE_ROUND_THRESHOLD (128 * 1024)
+
+/**
+ * @brief Number of distinct `list_status` codes, used to size per-status counters.
+ */
+#define LIST_STATUS_COUNT 5
+
+/**
+ * @brief Returned by `list_find` when no element matches.
+ */
+#define LIST_NOT_FOUND SIZE_MAX
+
+/**
+ * @brief Bytes of inline storage in every `list`, set through the build option of the same name.
+ *
+ * Buffers that fit are kept inside the list, so small lists with the
+ * standard allocator never touch the heap; larger ones spill to `malloc` as
+ * usual. 0 (the default) disables inline storage.
+ */
+#ifndef LIST_INLINE_BYTES
+#define LIST_INLINE_BYTES 0
+#endif
+
+/**
+ * @brief Allocation and resize counters for a list, or for all lists combined.
+ *
+ * Statistics are only collected when the library is built with
+ * `LIST_ENABLE_STATS` defined (the `LIST_ENABLE_STATS` CMake option). Without
+ * it, no counting code is compiled in and `list_stats_get` reports zeros.
+ *
+ * @var list_stats::resizes
+ *      Number of times the buffer was reallocated to a different capacity.
+ *
+ * @var list_stats::grows
+ *      Number of resizes that increased the capacity.
+ *
+ * @var list_stats::shrinks
+ *      Number of resizes that decreased the capacity, including releasing
+ *      the buffer entirely.
+ *
+ * @var list_stats::moves
+ *      Number of resizes that relocated the buffer to a new address.
+ *
+ * @var list_stats::bytes_copied
+ *      Bytes of existing buffer contents copied by relocating resizes.
+ *
+ * @var list_stats::bytes_zeroed
+ *      Bytes zero-filled because of `LIST_FLAG_ZERO_FILL`.
+ *
+ * @var list_stats::peak_capacity
+ *      Largest buffer size reached, in bytes. For the global statistics this
+ *      is the largest buffer of any single list.
+ *
+ * @var list_stats::failures
+ *      Number of failed operations, indexed by `list_status`. The
+ *      `LIST_OK` entry is always zero.
+ */
+typedef struct list_stats {
+    uint64_t resizes;
+    uint64_t grows;
+    uint64_t shrinks;
+    uint64_t moves;
+    uint64_t bytes_copied;
+    uint64_t bytes_zeroed;
+    uint64_t peak_capacity;
+    uint64_t failures[LIST_STATUS_COUNT];
+} list_stats;
 
 /**
  * @brief A dynamically-sized array implementation for generic data.
@@ -33,6 +221,43 @@
  *      The size of each element in bytes. This is determined at initialization
  *      and must match the size of the data being stored.
  *
+ * @var list::shrink_policy
+ *      Controls whether and how `list_pop` releases unused capacity. Defaults
+ *      to `LIST_SHRINK_QUARTER`; see `list_set_shrink_policy`.
+ *
+ * @var list::min_capacity
+ *      The capacity below which `list_pop` never shrinks the buffer when the
+ *      policy is `LIST_SHRINK_RETAIN_MIN`.
+ *
+ * @var list::allocator
+ *      The allocator that owns `data`, or `NULL` to use the standard
+ *      `malloc` family.
+ *
+ * @var list::flags
+ *      Bitwise OR of `list_flags` values enabled on the list.
+ *
+ * @var list::growth_factor
+ *      Factor by which the capacity is multiplied when the list must grow.
+ *      Defaults to 2.0; see `list_set_growth_policy`.
+ *
+ * @var list::rounding
+ *      How grown capacities are rounded up. Defaults to `LIST_ROUND_NONE`.
+ *
+ * @var list::stats
+ *      Counters for this list. Only present when built with `LIST_ENABLE_STATS`.
+ *      Its `failures` entries are unused; see `list::failure_counts`.
+ *
+ * @var list::failure_counts
+ *      Failed operations on this list, indexed by `list_status`. Atomic
+ *      because read-only calls such as `list_get` record into them too. Only
+ *      present when built with `LIST_ENABLE_STATS`.
+ *
+ * @var list::inline_data
+ *      Storage for buffers of up to `LIST_INLINE_BYTES` bytes, used instead of
+ *      the heap by lists with the standard allocator. Only present when built
+ *      with `LIST_INLINE_BYTES` greater than 0. Because `data` may point into
+ *      the list itself, such a list must not be copied with plain assignment.
+ *
  * ### Example Usage
  * @code
  * list my_list;
@@ -57,10 +282,23 @@
  * @endcode
  */
 typedef struct list {
-    void*  data;
-    size_t size;
-    size_t capacity;
-    size_t elem_size;
+    void*                  data;
+    size_t                 size;
+    size_t                 capacity;
+    size_t                 elem_size;
+    list_shrink_policy     shrink_policy;
+    size_t                 min_capacity;
+    const list_allocator*  allocator;
+    unsigned               flags;
+    double                 growth_factor;
+    list_capacity_rounding rounding;
+#ifdef LIST_ENABLE_STATS
+    list_stats             stats;
+    atomic_uint_fast64_t   failure_counts[LIST_STATUS_COUNT];
+#endif
+#if LIST_INLINE_BYTES > 0
+    alignas(max_align_t) unsigned char inline_data[LIST_INLINE_BYTES];
+#endif
 } list;
 
 /**
@@ -91,6 +329,10 @@ typedef struct list {
  *      `list_get` when accessing indices greater than or equal to the total
  *      number of elements in the list.
  *
+ * @var LIST_ERR_IO
+ *      Indicates that a file operation failed, for example while opening,
+ *      growing or syncing a memory-mapped list.
+ *
  * Example usage:
  * @code
  * list my_list;
@@ -109,6 +351,7 @@ typedef enum {
     LIST_ERR_ALLOC     = 1,
     LIST_ERR_INVALID   = 2,
     LIST_OUT_OF_BOUNDS = 3,
+    LIST_ERR_IO        = 4,
 } list_status;
 
 /**
@@ -130,6 +373,43 @@ list_status list_init(list* lst, size_t elem_size);
  */
 list_status list_init_with_capacity(list* lst, size_t capacity, size_t elem_size);
 
+/**
+ * @brief Initializes a list whose buffer is managed by a custom allocator.
+ *
+ * @param lst Pointer to the list to initialize.
+ * @param capacity Initial number of elements the list can hold.
+ * @param elem_size Size of each element in bytes.
+ * @param allocator Allocator used for every buffer operation, or `NULL` for the
+ *        standard `malloc` family. Must outlive the list.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if the allocator is missing a
+ *         callback, `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_init_with_allocator(list* lst, size_t capacity, size_t elem_size, const list_allocator* allocator);
+
+/**
+ * @brief Initializes a list with optional behaviours enabled.
+ *
+ * @param lst Pointer to the list to initialize.
+ * @param capacity Initial number of elements the list can hold.
+ * @param elem_size Size of each element in bytes.
+ * @param flags Bitwise OR of `list_flags` values.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if a flag is unknown,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_init_with_flags(list* lst, size_t capacity, size_t elem_size, unsigned flags);
+
+/**
+ * @brief Replaces the optional behaviours enabled on a list.
+ *
+ * Enabling `LIST_FLAG_ZERO_FILL` also zeroes any capacity already reserved
+ * beyond the list's size.
+ *
+ * @param lst Pointer to the list.
+ * @param flags Bitwise OR of `list_flags` values.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL` or a flag is unknown.
+ */
+list_status list_set_flags(list* lst, unsigned flags);
+
 /**
  * @brief Releases resources used by the list.
  *
@@ -137,6 +417,80 @@ list_status list_init_with_capacity(list* lst, size_t capacity, size_t elem_size
  */
 void list_destroy(list* lst);
 
+/**
+ * @brief Transfers the buffer and settings of `src` to `dst` without copying elements.
+ *
+ * `dst` is treated as uninitialized, so destroy it first if it holds a
+ * buffer. Afterwards `src` is a valid, empty list with its element size,
+ * allocator and policies intact. The move is O(1) except for a list whose
+ * elements sit in `inline_data`, which are copied into `dst`'s inline
+ * storage. A memory-mapped list stays attached to its file through `dst`,
+ * and `src` falls back to the standard allocator.
+ *
+ * @param dst Pointer to the list that receives the buffer.
+ * @param src Pointer to the list to move from.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`.
+ */
+list_status list_move(list* dst, list* src);
+
+/**
+ * @brief Exchanges the buffers and settings of two lists without copying elements.
+ *
+ * Inline and memory-mapped buffers are handled as described for `list_move`.
+ *
+ * @param a Pointer to the first list.
+ * @param b Pointer to the second list.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`.
+ */
+list_status list_swap(list* a, list* b);
+
+/**
+ * @brief Detaches the buffer from a list and hands ownership to the caller.
+ *
+ * The list is left valid and empty. The caller must release the buffer
+ * through the list's allocator, passing `capacity * elem_size` as the
+ * block size, or with `free` when the list uses the standard allocator.
+ * Elements held in `inline_data` are first copied to a `malloc` block of
+ * exactly `size` elements.
+ *
+ * @param lst Pointer to the list.
+ * @param out_size Receives the number of elements in the buffer (optional, can be `NULL`).
+ * @param out_capacity Receives the capacity of the buffer in elements (optional, can be `NULL`).
+ * @return The buffer, or `NULL` if the list had none, on `NULL` or memory-mapped
+ *         lists (whose buffer lives in the file mapping), or if copying inline
+ *         elements out fails.
+ */
+void* list_release(list* lst, size_t* out_size, size_t* out_capacity);
+
+/**
+ * @brief Initializes a list around an existing `malloc` block, taking ownership of it.
+ *
+ * @param lst Pointer to the list to initialize.
+ * @param buf Block of at least `capacity * elem_size` bytes, or `NULL` if `capacity` is 0.
+ * @param size Number of initialized elements at the start of `buf`.
+ * @param capacity Number of elements `buf` can hold.
+ * @param elem_size Size of each element in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`, `elem_size`
+ *         is 0, `size` exceeds `capacity` or `buf` does not match `capacity`.
+ */
+list_status list_adopt(list* lst, void* buf, size_t size, size_t capacity, size_t elem_size);
+
+/**
+ * @brief Initializes a list around a block obtained from `allocator`, taking ownership of it.
+ *
+ * @param lst Pointer to the list to initialize.
+ * @param buf Block of `capacity * elem_size` bytes from `allocator`, or `NULL` if `capacity` is 0.
+ * @param size Number of initialized elements at the start of `buf`.
+ * @param capacity Number of elements `buf` can hold.
+ * @param elem_size Size of each element in bytes.
+ * @param allocator Allocator that owns `buf`, or `NULL` for the standard `malloc`
+ *        family. Must outlive the list.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments as for
+ *         `list_adopt` or if the allocator is missing a callback.
+ */
+list_status list_adopt_with_allocator(
+    list* lst, void* buf, size_t size, size_t capacity, size_t elem_size, const list_allocator* allocator);
+
 /**
  * @brief Gets the current size of the list (number of elements stored).
  *
@@ -162,6 +516,50 @@ size_t list_capacity(const list* lst);
  */
 list_status list_push(list* lst, const void* value);
 
+/**
+ * @brief Appends `count` elements to the end of the list in a single operation.
+ *
+ * The required capacity is computed once, so the buffer is resized at most one
+ * time and the elements are copied with a single `memcpy`. This is considerably
+ * faster than calling `list_push` in a loop for large batches.
+ *
+ * @param lst Pointer to the list.
+ * @param values Pointer to `count` contiguous elements of `elem_size` bytes each.
+ *        Must not point into the list's own buffer.
+ * @param count Number of elements to append.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` or `values` is `NULL`,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_push_n(list* lst, const void* values, size_t count);
+
+/**
+ * @brief Appends all elements of `src` to the end of `dst`.
+ *
+ * Both lists must have the same element size. `dst` and `src` may refer to
+ * the same list, in which case its contents are duplicated.
+ *
+ * @param dst Pointer to the list to append to.
+ * @param src Pointer to the list whose elements are appended.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if either list is `NULL` or the
+ *         element sizes differ, `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_extend(list* dst, const list* src);
+
+/**
+ * @brief Appends `count` copies of one value to the end of the list.
+ *
+ * The buffer is resized at most once and filled with a vectorized kernel for
+ * element sizes of 1, 2, 4 and 8 bytes, which is much faster than pushing the
+ * same value in a loop.
+ *
+ * @param lst Pointer to the list.
+ * @param value Pointer to the value to append. Must not point into the list's own buffer.
+ * @param count Number of copies to append.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` or `value` is `NULL`,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_fill(list* lst, const void* value, size_t count);
+
 /**
  * @brief Removes the last element from the list and optionally retrieves its value.
  *
@@ -171,6 +569,177 @@ list_status list_push(list* lst, const void* value);
  */
 list_status list_pop(list* lst, void* out_value);
 
+/**
+ * @brief Inserts one element before the element at `index`.
+ *
+ * Later elements are shifted up by one with a single `memmove`.
+ *
+ * @param lst Pointer to the list.
+ * @param index Position of the new element; `list_size(lst)` appends.
+ * @param value Pointer to the value to insert. Must not point into the list's own buffer.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` or `value` is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if `index` is greater than the size,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_insert_at(list* lst, size_t index, const void* value);
+
+/**
+ * @brief Inserts `count` contiguous elements before the element at `index`.
+ *
+ * The buffer is resized at most once and later elements are shifted up
+ * with a single `memmove`.
+ *
+ * @param lst Pointer to the list.
+ * @param index Position of the first new element; `list_size(lst)` appends.
+ * @param values Pointer to the elements to insert. Must not point into the list's own buffer.
+ * @param count Number of elements to insert.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL` or `values` is `NULL`
+ *         with a non-zero `count`, `LIST_OUT_OF_BOUNDS` if `index` is greater than
+ *         the size, `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_insert_range(list* lst, size_t index, const void* values, size_t count);
+
+/**
+ * @brief Removes the element at `index`, keeping the order of the others.
+ *
+ * Later elements are shifted down by one with a single `memmove`. Capacity
+ * is released according to the shrink policy, as by `list_pop`.
+ *
+ * @param lst Pointer to the list.
+ * @param index Position of the element to remove.
+ * @param out_value Pointer to where the removed value will be stored (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if `index` is not less than the size.
+ */
+list_status list_erase_at(list* lst, size_t index, void* out_value);
+
+/**
+ * @brief Removes `count` contiguous elements starting at `first`, keeping the order of the others.
+ *
+ * Later elements are shifted down with a single `memmove`. Capacity is
+ * released according to the shrink policy, as by `list_pop`.
+ *
+ * @param lst Pointer to the list.
+ * @param first Position of the first element to remove.
+ * @param count Number of elements to remove.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if the range extends past the end of the list.
+ */
+list_status list_erase_range(list* lst, size_t first, size_t count);
+
+/**
+ * @brief Removes the element at `index` in constant time by moving the last element into its place.
+ *
+ * The order of the remaining elements is not preserved. Capacity is
+ * released according to the shrink policy, as by `list_pop`.
+ *
+ * @param lst Pointer to the list.
+ * @param index Position of the element to remove.
+ * @param out_value Pointer to where the removed value will be stored (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if `index` is not less than the size.
+ */
+list_status list_swap_remove(list* lst, size_t index, void* out_value);
+
+/**
+ * @brief Removes every element for which `pred` returns `true`, keeping the order of the others.
+ *
+ * Runs in a single pass: each kept run of elements is moved down once with
+ * one `memmove`, so the cost is linear however many elements are removed.
+ * Capacity is released according to the shrink policy, as by `list_pop`.
+ *
+ * A list sharing its buffer with a snapshot moves to a private copy only
+ * once an element matches. If that copy cannot be allocated, nothing is
+ * removed.
+ *
+ * @param lst Pointer to the list.
+ * @param pred Predicate called once per element, in order, with the element and `ctx`.
+ * @param ctx User data passed to `pred`.
+ * @param out_removed Receives the number of elements removed (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` or `pred` is `NULL`,
+ *         `LIST_ERR_ALLOC` if a shared buffer cannot be copied.
+ */
+list_status list_erase_if(list* lst, bool (*pred)(const void* elem, void* ctx), void* ctx, size_t* out_removed);
+
+/**
+ * @brief Sets the policy used by `list_pop` to release unused capacity.
+ *
+ * @param lst Pointer to the list.
+ * @param policy The shrink policy to apply to subsequent pops.
+ * @param min_capacity Capacity retained under `LIST_SHRINK_RETAIN_MIN`; ignored otherwise.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL` or the policy is unknown.
+ */
+list_status list_set_shrink_policy(list* lst, list_shrink_policy policy, size_t min_capacity);
+
+/**
+ * @brief Sets how the list's capacity grows when it runs out of space.
+ *
+ * A smaller factor such as 1.5 wastes less memory on large lists at the
+ * cost of more frequent reallocations. Every growth adds at least one
+ * element, whatever the factor.
+ *
+ * @param lst Pointer to the list.
+ * @param growth_factor Multiplier applied to the capacity on growth. Must be
+ *        greater than 1.0 and at most 16.0.
+ * @param rounding How grown capacities are rounded up.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL` or an argument is out of range.
+ */
+list_status list_set_growth_policy(list* lst, double growth_factor, list_capacity_rounding rounding);
+
+/**
+ * @brief Reduces the capacity of the list to match its size.
+ *
+ * An empty list releases its buffer entirely, except a memory-mapped one,
+ * which keeps its file and the first page of elements. This is the explicit
+ * counterpart to the automatic shrinking done by `list_pop`.
+ *
+ * @param lst Pointer to the list.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`,
+ *         `LIST_ERR_ALLOC` if reallocation fails.
+ */
+list_status list_shrink_to_fit(list* lst);
+
+/**
+ * @brief Ensures the list can hold at least `capacity` elements without reallocating.
+ *
+ * Never shrinks. The buffer is resized at most once, to the larger of
+ * `capacity` and what the growth policy would pick next, so reserving a
+ * little more before every batch keeps the amortized growth of `list_push`.
+ *
+ * @param lst Pointer to the list.
+ * @param capacity The number of elements the list must be able to hold.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_reserve(list* lst, size_t capacity);
+
+/**
+ * @brief Sets the number of elements, appending copies of `fill` or dropping elements from the end.
+ *
+ * Growing resizes the buffer at most once. Shrinking applies the list's
+ * shrink policy like `list_erase_range`.
+ *
+ * @param lst Pointer to the list.
+ * @param size The new number of elements.
+ * @param fill Pointer to the value for new elements, or `NULL` to zero them. Must not
+ *             point into the list's own buffer.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`,
+ *         `LIST_ERR_ALLOC` if allocation fails, in which case the list is unchanged.
+ */
+list_status list_resize_to(list* lst, size_t size, const void* fill);
+
+/**
+ * @brief Removes all elements and frees the buffer, keeping the list's settings.
+ *
+ * Unlike `list_clear`, which keeps the buffer for reuse, this returns the
+ * memory straight away; the list stays valid and grows again on the next push.
+ * A memory-mapped list stays attached to its file and keeps its first page
+ * of elements, as with `list_shrink_to_fit`.
+ *
+ * @param lst Pointer to the list.
+ */
+void list_clear_and_release(list* lst);
+
 /**
  * @brief Retrieves the value of the last element in the list without removing it.
  *
@@ -193,12 +762,241 @@ list_status list_get(const list* lst, size_t index, void* out_value);
 /**
  * @brief Sets the value of an element at a specified index.
  *
+ * Takes a non-const list because a list sharing its buffer with a
+ * snapshot first moves to a private copy.
+ *
  * @param lst Pointer to the list.
  * @param index Zero-based index of the element.
  * @param value Pointer to the value to set at the specified index.
- * @return `LIST_OK` on success, `LIST_OUT_OF_BOUNDS` if the index is invalid.
+ * @return `LIST_OK` on success, `LIST_OUT_OF_BOUNDS` if the index is invalid,
+ *         `LIST_ERR_ALLOC` if a shared buffer cannot be copied.
+ */
+list_status list_set(list* lst, size_t index, const void* value);
+
+/**
+ * @brief Copies the elements at `count` indices into a contiguous output array.
+ *
+ * Equivalent to calling `list_get(lst, indices[i], &out[i])` for every `i`,
+ * but the indices are range checked in one pass before anything is copied
+ * and the copy loop prefetches upcoming elements, so random lookups cost
+ * a fraction of a `list_get` call each.
+ *
+ * @param lst Pointer to the list.
+ * @param indices Array of `count` zero-based indices, in any order and possibly repeated.
+ * @param count Number of indices.
+ * @param out Array of `count` elements that receives the values.
+ * @param out_bad_index Receives the position in `indices` of the first index that is
+ *                      out of range (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if any index is not less than the size, in which case
+ *         nothing is copied.
+ */
+list_status list_gather(const list* lst, const size_t* indices, size_t count, void* out, size_t* out_bad_index);
+
+/**
+ * @brief Writes `count` values to the elements at the given indices.
+ *
+ * Equivalent to calling `list_set(lst, indices[i], &values[i])` for every
+ * `i`, with the same single-pass range check as `list_gather`. When an
+ * index is repeated, the last value written to it wins.
+ *
+ * @param lst Pointer to the list.
+ * @param indices Array of `count` zero-based indices.
+ * @param count Number of indices.
+ * @param values Array of `count` elements to write.
+ * @param out_bad_index Receives the position in `indices` of the first index that is
+ *                      out of range (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if any index is not less than the size, in which case
+ *         nothing is written.
+ */
+list_status list_scatter(list* lst, const size_t* indices, size_t count, const void* values, size_t* out_bad_index);
+
+/**
+ * @brief Gets a pointer to the element at a specified index.
+ *
+ * Unlike `list_get`, no data is copied; the element can be read or modified
+ * in place. The pointer is invalidated by any operation that resizes the list.
+ *
+ * @param lst Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @return Pointer to the element, or `NULL` if `lst` is `NULL` or the index is invalid.
+ */
+void* list_at(const list* lst, size_t index);
+
+/**
+ * @brief Gets a pointer to the element at a specified index without validation.
+ *
+ * The caller must guarantee that `lst` is a valid list and `index < list_size(lst)`.
+ *
+ * @param lst Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @return Pointer to the element.
+ */
+static inline void* list_at_unchecked(const list* lst, const size_t index) {
+    return (uint8_t*) lst->data + index * lst->elem_size;
+}
+
+/**
+ * @brief Gets a pointer to the first element of the list's contiguous buffer.
+ *
+ * Together with `list_end`, this allows iterating over the raw elements
+ * directly, e.g. `for (int* p = list_data(lst); p != list_end(lst); p++)`.
+ *
+ * @param lst Pointer to the list.
+ * @return Pointer to the first element, or `NULL` if the list has no buffer.
+ */
+static inline void* list_data(const list* lst) {
+    return lst != nullptr ? lst->data : nullptr;
+}
+
+/**
+ * @brief Gets a pointer one past the last element of the list's buffer.
+ *
+ * @param lst Pointer to the list.
+ * @return Pointer one past the last element, or `NULL` if the list has no buffer.
+ */
+static inline void* list_end(const list* lst) {
+    if (lst == nullptr || lst->data == nullptr) return nullptr;
+    return (uint8_t*) lst->data + lst->size * lst->elem_size;
+}
+
+/**
+ * @brief Copies one element of `size` bytes.
+ * @internal
+ *
+ * The common sizes become a single load and store once inlined, instead of
+ * a call to `memcpy` with a size only known at run time.
+ */
+static inline void list_copy_elem(void* dest, const void* src, const size_t size) {
+    switch (size) {
+        case 1:  memcpy(dest, src, 1); break;
+        case 2:  memcpy(dest, src, 2); break;
+        case 4:  memcpy(dest, src, 4); break;
+        case 8:  memcpy(dest, src, 8); break;
+        default: memcpy(dest, src, size); break;
+    }
+}
+
+/**
+ * @brief Allocation callback of the shared blocks behind `list_snapshot`.
+ * @internal
+ *
+ * Not part of the API. Declared here only so that `list_is_shared` can
+ * recognize a shared buffer by its allocator with one comparison.
  */
-list_status list_set(const list* lst, size_t index, const void* value);
+void* list_snapshot_alloc_cb_(void* ctx, size_t size);
+
+/**
+ * @brief Checks whether a list holds its buffer through a `list_snapshot` block.
+ * @internal
+ *
+ * A helper for the inline fast paths in this header and `list_typed.h`, not
+ * part of the API; use `list_shares_buffer` from `list_snapshot.h` instead.
+ * Unlike that call, this is also true once the other holders have let go,
+ * in which case `list_unshare` takes the buffer back without copying.
+ */
+static inline bool list_is_shared(const list* lst) {
+    return lst->allocator != nullptr && lst->allocator->alloc == list_snapshot_alloc_cb_;
+}
+
+/**
+ * @brief Appends an element, inlined, without validating the arguments.
+ *
+ * The caller must guarantee that `lst` is a valid list and `value` is not
+ * `NULL`; this is checked with `assert` only. When the list is full, or
+ * its buffer is shared with a snapshot, the call falls through to
+ * `list_push`.
+ *
+ * @param lst Pointer to the list.
+ * @param value Pointer to the value to append.
+ * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if the list cannot grow.
+ */
+static inline list_status list_push_unchecked(list* lst, const void* value) {
+    assert(lst != nullptr && value != nullptr);
+
+    if (lst->size >= lst->capacity || list_is_shared(lst)) return list_push(lst, value);
+
+    list_copy_elem((uint8_t*) lst->data + lst->size * lst->elem_size, value, lst->elem_size);
+    lst->size++;
+    return LIST_OK;
+}
+
+/**
+ * @brief Gets the value of an element, inlined, without validation.
+ *
+ * The caller must guarantee that `lst` is a valid list, `index < list_size(lst)`
+ * and `out_value` is not `NULL`; this is checked with `assert` only.
+ *
+ * @param lst Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @param out_value Pointer to where the value will be stored.
+ * @return `LIST_OK`.
+ */
+static inline list_status list_get_unchecked(const list* lst, const size_t index, void* out_value) {
+    assert(lst != nullptr && out_value != nullptr && index < lst->size);
+
+    list_copy_elem(out_value, (const uint8_t*) lst->data + index * lst->elem_size, lst->elem_size);
+    return LIST_OK;
+}
+
+/**
+ * @brief Sets the value of an element, inlined, without validation.
+ *
+ * The caller must guarantee that `lst` is a valid list, `index < list_size(lst)`
+ * and `value` is not `NULL`; this is checked with `assert` only. A list
+ * whose buffer is shared with a snapshot falls through to `list_set`.
+ *
+ * @param lst Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @param value Pointer to the value to set at the specified index.
+ * @return `LIST_OK`, or `LIST_ERR_ALLOC` if a shared buffer cannot be copied.
+ */
+static inline list_status list_set_unchecked(list* lst, const size_t index, const void* value) {
+    assert(lst != nullptr && value != nullptr && index < lst->size);
+
+    if (list_is_shared(lst)) return list_set(lst, index, value);
+
+    list_copy_elem((uint8_t*) lst->data + index * lst->elem_size, value, lst->elem_size);
+    return LIST_OK;
+}
+
+/**
+ * @brief Removes the last element, inlined, without validation.
+ *
+ * The caller must guarantee that `lst` is a valid, non-empty list; this is
+ * checked with `assert` only. A pop that would shrink the buffer falls
+ * through to `list_pop`.
+ *
+ * @param lst Pointer to the list.
+ * @param out_value Pointer to where the removed value will be stored (optional, can be `NULL`).
+ * @return `LIST_OK`, or the status of the shrink if one is attempted.
+ */
+static inline list_status list_pop_unchecked(list* lst, void* out_value) {
+    assert(lst != nullptr && lst->size > 0);
+
+    if (lst->shrink_policy != LIST_SHRINK_NEVER && lst->capacity > 1 && lst->size - 1 < lst->capacity / 4) {
+        return list_pop(lst, out_value);
+    }
+
+    lst->size--;
+    if (out_value != nullptr) {
+        list_copy_elem(out_value, (const uint8_t*) lst->data + lst->size * lst->elem_size, lst->elem_size);
+    }
+    return LIST_OK;
+}
+
+/**
+ * @brief Appends an uninitialized element and returns a pointer to it.
+ *
+ * This lets callers construct an element directly in the list's buffer
+ * instead of building it elsewhere and copying it in with `list_push`.
+ * The pointer is invalidated by any operation that resizes the list.
+ *
+ * @param lst Pointer to the list.
+ * @return Pointer to the new element, or `NULL` if `lst` is `NULL` or allocation fails.
+ */
+void* list_emplace_back(list* lst);
 
 /**
  * @brief Clears all elements from the list without freeing its memory buffer.
@@ -207,6 +1005,80 @@ list_status list_set(const list* lst, size_t index, const void* value);
  */
 void list_clear(list* lst);
 
+/**
+ * @brief Finds the first element that is bitwise equal to `value`.
+ *
+ * Elements are compared in place, without copying them out. Element sizes
+ * of 1, 2, 4 and 8 bytes use SIMD kernels chosen for the running CPU (see
+ * `list_simd_backend`); other sizes fall back to a scalar scan.
+ *
+ * @param lst Pointer to the list.
+ * @param value Pointer to the value to search for.
+ * @return Index of the first match, or `LIST_NOT_FOUND` if there is none or an argument is `NULL`.
+ */
+size_t list_find(const list* lst, const void* value);
+
+/**
+ * @brief Counts the elements that are bitwise equal to `value`.
+ *
+ * Uses the same kernels as `list_find`.
+ *
+ * @param lst Pointer to the list.
+ * @param value Pointer to the value to count.
+ * @return Number of matching elements, or 0 if an argument is `NULL`.
+ */
+size_t list_count(const list* lst, const void* value);
+
+/**
+ * @brief Checks whether any element is bitwise equal to `value`.
+ *
+ * @param lst Pointer to the list.
+ * @param value Pointer to the value to search for.
+ * @return `true` if the list contains the value.
+ */
+bool list_contains(const list* lst, const void* value);
+
+/**
+ * @brief Checks whether two lists hold the same elements, compared bitwise.
+ *
+ * Lists with different element sizes are never equal. Floating point
+ * elements compare by bit pattern, so `-0.0` differs from `0.0` and a NaN
+ * equals an identical NaN.
+ *
+ * @param a Pointer to the first list.
+ * @param b Pointer to the second list.
+ * @return `true` if both lists have the same size, element size and contents.
+ */
+bool list_equal(const list* a, const list* b);
+
+/**
+ * @brief Gets the name of the SIMD kernels used by `list_find`, `list_count` and `list_fill`.
+ *
+ * The best tier the CPU supports is picked on first use. Setting the
+ * `LIST_SIMD` environment variable to the name of another supported tier
+ * forces that tier instead, which is mainly useful for testing.
+ *
+ * @return `"avx2"`, `"sse2"`, `"neon"` or `"scalar"`.
+ */
+const char* list_simd_backend(void);
+
+/**
+ * @brief Retrieves allocation and resize statistics.
+ *
+ * @param lst Pointer to the list, or `NULL` for the totals across all lists.
+ * @param out_stats Pointer to where the statistics will be stored. Filled with
+ *        zeros when the library is built without `LIST_ENABLE_STATS`.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `out_stats` is `NULL`.
+ */
+list_status list_stats_get(const list* lst, list_stats* out_stats);
+
+/**
+ * @brief Resets allocation and resize statistics to zero.
+ *
+ * @param lst Pointer to the list, or `NULL` to reset the totals across all lists.
+ */
+void list_stats_reset(list* lst);
+
 /**
  * @brief Converts a `list_status` code to a human-readable string.
  *
@@ -215,4 +1087,20 @@ void list_clear(list* lst);
  */
 const char* list_error_to_string(list_status err);
 
+#if defined(LIST_FAST) && !defined(LIST_BUILDING_LIBRARY)
+
+/*
+ * Fast-path mode: a translation unit that defines LIST_FAST before including
+ * this header gets the inlined, assert-checked versions of the hot calls in
+ * place of the validating ones. Release builds (NDEBUG) drop the asserts.
+ * Headers that must reach the validating functions, such as list_typed.h,
+ * call them with parenthesized names, which these macros do not match.
+ */
+#define list_push(lst, value)            list_push_unchecked((lst), (value))
+#define list_get(lst, index, out_value)  list_get_unchecked((lst), (index), (out_value))
+#define list_set(lst, index, value)      list_set_unchecked((lst), (index), (value))
+#define list_pop(lst, out_value)         list_pop_unchecked((lst), (out_value))
+
+#endif
+
 #endif //LIST_H
@@ -0,0 +1,170 @@
+#ifndef LIST_ARENA_H
+#define LIST_ARENA_H
+
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief Number of size classes managed by a `list_pool`.
+ *
+ * Classes are powers of two from `LIST_POOL_MIN_BLOCK` bytes upward, so the
+ * largest pooled block is `LIST_POOL_MIN_BLOCK << (LIST_POOL_CLASS_COUNT - 1)`
+ * bytes. Larger requests are served directly by the underlying arena.
+ */
+#define LIST_POOL_CLASS_COUNT 13
+
+/**
+ * @brief Size in bytes of the smallest `list_pool` size class.
+ */
+#define LIST_POOL_MIN_BLOCK 16
+
+/**
+ * @brief Opaque block of memory owned by a `list_arena`.
+ */
+typedef struct list_arena_block list_arena_block;
+
+/**
+ * @brief A bump allocator that hands out memory from large blocks.
+ *
+ * Allocation is a pointer increment, individual frees are no-ops (except
+ * for the most recent allocation, which can be grown or rolled back in
+ * place), and every allocation is released at once by `list_arena_reset`
+ * or `list_arena_destroy`. This makes it well suited to the many
+ * short-lived lists created while handling a single request: lists that
+ * use the arena never need to be destroyed individually.
+ *
+ * Blocks are retained across resets and reused, so a steady-state workload
+ * stops calling `malloc` altogether.
+ *
+ * @var list_arena::first
+ *      The first block in the arena's chain.
+ *
+ * @var list_arena::current
+ *      The block allocations are currently served from.
+ *
+ * @var list_arena::block_size
+ *      The default size in bytes of each block.
+ *
+ * @var list_arena::allocator
+ *      A `list_allocator` bound to this arena, for use with
+ *      `list_init_with_allocator`.
+ *
+ * ### Example Usage
+ * @code
+ * list_arena arena;
+ * list_arena_init(&arena, 64 * 1024);
+ *
+ * for (;;) {
+ *     list ids;
+ *     list_init_with_allocator(&ids, 0, sizeof(int), list_arena_allocator(&arena));
+ *     // ... build and use many lists ...
+ *     list_arena_reset(&arena);  // Releases every list at once
+ * }
+ *
+ * list_arena_destroy(&arena);
+ * @endcode
+ */
+typedef struct list_arena {
+    list_arena_block* first;
+    list_arena_block* current;
+    size_t            block_size;
+    list_allocator    allocator;
+} list_arena;
+
+/**
+ * @brief A size-class free-list allocator layered on a `list_arena`.
+ *
+ * Blocks are rounded up to a power-of-two size class and recycled through
+ * per-class free lists, so lists that grow and shrink reuse each other's
+ * memory instead of leaving dead space in the arena. Everything the pool
+ * hands out still lives in the arena and is released by `list_pool_reset`.
+ *
+ * @var list_pool::arena
+ *      The arena the pool carves its blocks from.
+ *
+ * @var list_pool::free_lists
+ *      Singly-linked lists of released blocks, one per size class.
+ *
+ * @var list_pool::allocator
+ *      A `list_allocator` bound to this pool, for use with
+ *      `list_init_with_allocator`.
+ */
+typedef struct list_pool {
+    list_arena*    arena;
+    void*          free_lists[LIST_POOL_CLASS_COUNT];
+    list_allocator allocator;
+} list_pool;
+
+/**
+ * @brief Initializes an empty arena.
+ *
+ * No memory is allocated until the first allocation request.
+ *
+ * @param arena Pointer to the arena to initialize.
+ * @param block_size Default size in bytes of each block. Larger requests get a
+ *        dedicated block of their own.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `arena` is `NULL` or `block_size` is 0.
+ */
+list_status list_arena_init(list_arena* arena, size_t block_size);
+
+/**
+ * @brief Releases every block owned by the arena.
+ *
+ * Any list still using the arena's allocator must not be used afterwards.
+ *
+ * @param arena Pointer to the arena to destroy.
+ */
+void list_arena_destroy(list_arena* arena);
+
+/**
+ * @brief Releases every allocation made from the arena in O(1).
+ *
+ * Blocks are kept for reuse by later allocations. Any list still using
+ * the arena's allocator must not be used afterwards.
+ *
+ * @param arena Pointer to the arena to reset.
+ */
+void list_arena_reset(list_arena* arena);
+
+/**
+ * @brief Allocates `size` bytes from the arena.
+ *
+ * @param arena Pointer to the arena.
+ * @param size Number of bytes to allocate.
+ * @return Pointer to memory aligned for any object type, or `NULL` on failure.
+ */
+void* list_arena_alloc(list_arena* arena, size_t size);
+
+/**
+ * @brief Gets the `list_allocator` that serves allocations from the arena.
+ *
+ * @param arena Pointer to the arena.
+ * @return Pointer to the arena's allocator, valid for the lifetime of the arena.
+ */
+const list_allocator* list_arena_allocator(list_arena* arena);
+
+/**
+ * @brief Initializes a size-class pool on top of an arena.
+ *
+ * @param pool Pointer to the pool to initialize.
+ * @param arena Pointer to the arena to allocate from. Must outlive the pool.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if either pointer is `NULL`.
+ */
+list_status list_pool_init(list_pool* pool, list_arena* arena);
+
+/**
+ * @brief Releases every allocation made from the pool, along with its arena.
+ *
+ * @param pool Pointer to the pool to reset.
+ */
+void list_pool_reset(list_pool* pool);
+
+/**
+ * @brief Gets the `list_allocator` that serves allocations from the pool.
+ *
+ * @param pool Pointer to the pool.
+ * @return Pointer to the pool's allocator, valid for the lifetime of the pool.
+ */
+const list_allocator* list_pool_allocator(list_pool* pool);
+
+#endif //LIST_ARENA_H
@@ -0,0 +1,228 @@
+#ifndef LIST_CONCURRENT_H
+#define LIST_CONCURRENT_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief Maximum number of chunks a `concurrent_list` can allocate.
+ *
+ * Chunk `k` holds `first_chunk << k` elements, so even a first chunk of one
+ * element gives room for 2^48 - 1 elements.
+ */
+#define CONCURRENT_LIST_MAX_CHUNKS 48
+
+/**
+ * @brief Default number of elements in the first chunk of a `concurrent_list`.
+ */
+#define CONCURRENT_LIST_DEFAULT_CHUNK 256
+
+/**
+ * @brief Largest first chunk a `concurrent_list` accepts.
+ *
+ * The first chunk is capped to keep the size of the last of the
+ * `CONCURRENT_LIST_MAX_CHUNKS` chunks representable in a `size_t`
+ * (32768 elements with a 64-bit `size_t`).
+ */
+#define CONCURRENT_LIST_MAX_FIRST_CHUNK \
+    ((size_t) 1 << (SIZE_WIDTH > CONCURRENT_LIST_MAX_CHUNKS ? SIZE_WIDTH - 1 - CONCURRENT_LIST_MAX_CHUNKS : 0))
+
+/**
+ * @brief An append-only list that many threads can push to concurrently.
+ *
+ * Each `concurrent_list_push` reserves a slot with a single atomic
+ * fetch-and-add and then writes the element without taking any lock, so
+ * append throughput scales with the number of producer threads instead of
+ * serializing on a mutex.
+ *
+ * If a chunk cannot be allocated, the push that tried reports
+ * `LIST_ERR_ALLOC` and the chunk is marked dead: none of its slots are ever
+ * filled, later pushes reserve past it, and snapshots step over it. Its
+ * indices still count towards `concurrent_list_size` and a snapshot's size.
+ *
+ * Storage is a fixed index of geometrically growing chunks. Chunks are
+ * allocated on demand and never moved or freed until `concurrent_list_destroy`,
+ * so growth never invalidates readers and element pointers stay valid for
+ * the lifetime of the list.
+ *
+ * Readers take a `concurrent_list_snapshot`, which covers the longest prefix
+ * of fully written elements at that moment. A snapshot can be read while
+ * appends continue; it simply does not see elements pushed after it was taken.
+ *
+ * @var concurrent_list::chunks
+ *      Chunk pointers, published with release semantics once allocated.
+ *
+ * @var concurrent_list::reserved
+ *      Number of slots handed out to pushers so far.
+ *
+ * @var concurrent_list::published
+ *      A prefix length known to be fully written; advanced by snapshots.
+ *
+ * @var concurrent_list::elem_size
+ *      The size of each element in bytes.
+ *
+ * @var concurrent_list::first_chunk_shift
+ *      Base-2 logarithm of the number of elements in the first chunk.
+ *
+ * @var concurrent_list::allocator
+ *      Allocator used for the chunks, or `NULL` for the standard `malloc` family.
+ *
+ * ### Example Usage
+ * @code
+ * concurrent_list events;
+ * concurrent_list_init(&events, sizeof(event));
+ *
+ * // On any number of producer threads:
+ * concurrent_list_push(&events, &ev);
+ *
+ * // On a reader thread, while producers keep pushing:
+ * concurrent_list_snapshot snap;
+ * concurrent_list_snapshot_take(&events, &snap);
+ * for (size_t i = 0; i < snap.size; i++) {
+ *     const event* e = concurrent_list_snapshot_at(&snap, i);
+ * }
+ *
+ * concurrent_list_destroy(&events);  // Once all threads are done
+ * @endcode
+ */
+typedef struct concurrent_list {
+    _Atomic(uint8_t*)            chunks[CONCURRENT_LIST_MAX_CHUNKS];
+    alignas(64) atomic_size_t    reserved;
+    alignas(64) atomic_size_t    published;
+    size_t                       elem_size;
+    unsigned                     first_chunk_shift;
+    const list_allocator*        allocator;
+} concurrent_list;
+
+/**
+ * @brief A consistent, read-only view of a prefix of a `concurrent_list`.
+ *
+ * @var concurrent_list_snapshot::owner
+ *      The list the snapshot was taken from.
+ *
+ * @var concurrent_list_snapshot::size
+ *      Number of elements visible through the snapshot.
+ */
+typedef struct concurrent_list_snapshot {
+    const concurrent_list* owner;
+    size_t                 size;
+} concurrent_list_snapshot;
+
+/**
+ * @brief Initializes an empty concurrent list.
+ *
+ * @param cl Pointer to the list to initialize.
+ * @param elem_size Size of each element in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `cl` is `NULL` or `elem_size` is 0.
+ */
+list_status concurrent_list_init(concurrent_list* cl, size_t elem_size);
+
+/**
+ * @brief Initializes an empty concurrent list with a chosen first chunk size.
+ *
+ * @param cl Pointer to the list to initialize.
+ * @param capacity Number of elements in the first chunk, rounded up to a power of two.
+ *        At most `CONCURRENT_LIST_MAX_FIRST_CHUNK`.
+ * @param elem_size Size of each element in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments.
+ */
+list_status concurrent_list_init_with_capacity(concurrent_list* cl, size_t capacity, size_t elem_size);
+
+/**
+ * @brief Initializes an empty concurrent list whose chunks come from a custom allocator.
+ *
+ * @param cl Pointer to the list to initialize.
+ * @param capacity Number of elements in the first chunk, rounded up to a power of two.
+ *        At most `CONCURRENT_LIST_MAX_FIRST_CHUNK`.
+ * @param elem_size Size of each element in bytes.
+ * @param allocator Allocator used for every chunk, or `NULL` for the standard
+ *        `malloc` family. Called from the pushing threads, so it must be
+ *        thread-safe, and must outlive the list.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments.
+ */
+list_status concurrent_list_init_with_allocator(
+    concurrent_list* cl, size_t capacity, size_t elem_size, const list_allocator* allocator);
+
+/**
+ * @brief Releases every chunk owned by the list.
+ *
+ * Must not be called while other threads are still using the list.
+ *
+ * @param cl Pointer to the list to destroy.
+ */
+void concurrent_list_destroy(concurrent_list* cl);
+
+/**
+ * @brief Appends an element. Safe to call from any number of threads at once.
+ *
+ * @param cl Pointer to the list.
+ * @param value Pointer to the value to add.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_ERR_ALLOC` if a chunk could not be allocated, in which case
+ *         the value is not stored and the chunk's slots are left empty.
+ */
+list_status concurrent_list_push(concurrent_list* cl, const void* value);
+
+/**
+ * @brief Gets the number of slots reserved so far, including ones still being written
+ *        and the slots of chunks that could not be allocated.
+ *
+ * @param cl Pointer to the list.
+ * @return Number of reserved slots.
+ */
+size_t concurrent_list_size(const concurrent_list* cl);
+
+/**
+ * @brief Copies the value of a fully written element.
+ *
+ * Safe to call concurrently with pushes.
+ *
+ * @param cl Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @param out_value Pointer to where the value will be stored.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if the element does not exist or is still being written.
+ */
+list_status concurrent_list_get(const concurrent_list* cl, size_t index, void* out_value);
+
+/**
+ * @brief Takes a snapshot of the longest fully written prefix of the list.
+ *
+ * Safe to call concurrently with pushes.
+ *
+ * @param cl Pointer to the list.
+ * @param out_snapshot Pointer to where the snapshot will be stored.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`.
+ */
+list_status concurrent_list_snapshot_take(concurrent_list* cl, concurrent_list_snapshot* out_snapshot);
+
+/**
+ * @brief Gets a pointer to an element of a snapshot.
+ *
+ * @param snapshot Pointer to the snapshot.
+ * @param index Zero-based index of the element.
+ * @return Pointer to the element, or `NULL` if the index is outside the snapshot
+ *         or in a chunk that could not be allocated.
+ */
+const void* concurrent_list_snapshot_at(const concurrent_list_snapshot* snapshot, size_t index);
+
+/**
+ * @brief Calls `fn` on each contiguous run of elements in a snapshot.
+ *
+ * Runs follow chunk boundaries, so `fn` can process whole arrays without a
+ * per-element call. Chunks that could not be allocated are skipped, so
+ * `first_index` can jump past them.
+ *
+ * @param snapshot Pointer to the snapshot.
+ * @param fn Callback receiving a pointer to `count` contiguous elements, the
+ *        index of the first of them, and `ctx`.
+ * @param ctx User data passed to `fn`.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`.
+ */
+list_status concurrent_list_snapshot_for_each(
+    const concurrent_list_snapshot* snapshot,
+    void (*fn)(const void* elems, size_t count, size_t first_index, void* ctx),
+    void* ctx);
+
+#endif //LIST_CONCURRENT_H
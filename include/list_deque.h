@@ -0,0 +1,185 @@
+#ifndef LIST_DEQUE_H
+#define LIST_DEQUE_H
+
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief A double-ended queue stored in a circular `list` buffer.
+ *
+ * Elements can be pushed and popped at both ends in constant time, with no
+ * shifting: the contents start at `head` and wrap around the end of the
+ * buffer. Growth, allocators, growth policies and statistics are those of
+ * the underlying `list`, which owns the buffer; when it grows, only the
+ * shorter wrapped part is moved to keep the contents in ring order.
+ *
+ * Because the contents may wrap, the raw buffer is not a plain array of
+ * elements. Use the indexed accessors, or `list_deque_make_contiguous` to
+ * get a single span.
+ *
+ * @var list_deque::buf
+ *      The underlying list. `buf.size` is the number of elements and
+ *      `buf.capacity` the number of slots in the ring.
+ *
+ * @var list_deque::head
+ *      Slot of the first element.
+ */
+typedef struct list_deque {
+    list   buf;
+    size_t head;
+} list_deque;
+
+/**
+ * @brief Initializes an empty deque.
+ *
+ * @param dq Pointer to the deque to initialize.
+ * @param elem_size Size of each element in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `dq` is `NULL` or `elem_size` is 0,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_deque_init(list_deque* dq, size_t elem_size);
+
+/**
+ * @brief Initializes an empty deque with room for `capacity` elements.
+ *
+ * @param dq Pointer to the deque to initialize.
+ * @param capacity Initial number of elements the deque can hold.
+ * @param elem_size Size of each element in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_deque_init_with_capacity(list_deque* dq, size_t capacity, size_t elem_size);
+
+/**
+ * @brief Initializes an empty deque whose buffer is managed by a custom allocator.
+ *
+ * @param dq Pointer to the deque to initialize.
+ * @param capacity Initial number of elements the deque can hold.
+ * @param elem_size Size of each element in bytes.
+ * @param allocator Allocator used for every buffer operation, or `NULL` for the
+ *        standard `malloc` family. Must outlive the deque.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_deque_init_with_allocator(
+    list_deque* dq, size_t capacity, size_t elem_size, const list_allocator* allocator);
+
+/**
+ * @brief Releases the deque's buffer.
+ *
+ * @param dq Pointer to the deque to destroy.
+ */
+void list_deque_destroy(list_deque* dq);
+
+/**
+ * @brief Gets the number of elements in the deque.
+ *
+ * @param dq Pointer to the deque.
+ * @return The number of elements, or 0 if `dq` is `NULL`.
+ */
+size_t list_deque_size(const list_deque* dq);
+
+/**
+ * @brief Gets the number of elements the deque can hold without growing.
+ *
+ * @param dq Pointer to the deque.
+ * @return The capacity, or 0 if `dq` is `NULL`.
+ */
+size_t list_deque_capacity(const list_deque* dq);
+
+/**
+ * @brief Appends an element at the back of the deque.
+ *
+ * @param dq Pointer to the deque.
+ * @param value Pointer to the value to append. Must not point into the deque's own buffer.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_deque_push_back(list_deque* dq, const void* value);
+
+/**
+ * @brief Prepends an element at the front of the deque.
+ *
+ * @param dq Pointer to the deque.
+ * @param value Pointer to the value to prepend. Must not point into the deque's own buffer.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_deque_push_front(list_deque* dq, const void* value);
+
+/**
+ * @brief Removes the last element of the deque.
+ *
+ * Popping never releases capacity; the ring is reused by later pushes.
+ *
+ * @param dq Pointer to the deque.
+ * @param out_value Pointer to where the removed value will be stored (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `dq` is `NULL` or the deque is empty.
+ */
+list_status list_deque_pop_back(list_deque* dq, void* out_value);
+
+/**
+ * @brief Removes the first element of the deque.
+ *
+ * Popping never releases capacity; the ring is reused by later pushes.
+ *
+ * @param dq Pointer to the deque.
+ * @param out_value Pointer to where the removed value will be stored (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `dq` is `NULL` or the deque is empty.
+ */
+list_status list_deque_pop_front(list_deque* dq, void* out_value);
+
+/**
+ * @brief Gets the value of the element at `index`, counted from the front.
+ *
+ * @param dq Pointer to the deque.
+ * @param index Position of the element.
+ * @param out_value Pointer to where the value will be stored.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if `index` is not less than the size.
+ */
+list_status list_deque_get(const list_deque* dq, size_t index, void* out_value);
+
+/**
+ * @brief Sets the value of the element at `index`, counted from the front.
+ *
+ * @param dq Pointer to the deque.
+ * @param index Position of the element.
+ * @param value Pointer to the new value.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if `index` is not less than the size.
+ */
+list_status list_deque_set(list_deque* dq, size_t index, const void* value);
+
+/**
+ * @brief Gets a pointer to the element at `index`, counted from the front.
+ *
+ * The pointer is invalidated by any push that grows the deque and by
+ * `list_deque_make_contiguous`.
+ *
+ * @param dq Pointer to the deque.
+ * @param index Position of the element.
+ * @return Pointer to the element, or `NULL` if `dq` is `NULL` or `index` is out of bounds.
+ */
+void* list_deque_at(const list_deque* dq, size_t index);
+
+/**
+ * @brief Removes every element while keeping the buffer.
+ *
+ * @param dq Pointer to the deque.
+ */
+void list_deque_clear(list_deque* dq);
+
+/**
+ * @brief Rearranges the buffer so that the elements form one contiguous span.
+ *
+ * Runs in place without allocating. Afterwards the elements are
+ * `list_deque_size(dq)` consecutive elements from the returned pointer,
+ * until the next push at the front or a push that wraps around.
+ *
+ * @param dq Pointer to the deque.
+ * @return Pointer to the first element, or `NULL` if `dq` is `NULL` or the deque is empty.
+ */
+void* list_deque_make_contiguous(list_deque* dq);
+
+#endif //LIST_DEQUE_H
@@ -0,0 +1,246 @@
+#ifndef LIST_ITER_H
+#define LIST_ITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "list.h"
+
+/**
+ * @file list_iter.h
+ * @brief Header-only cursors over the contiguous buffer of a `list`.
+ *
+ * A `list_iter` walks a list forwards or backwards and hands out pointers
+ * to the elements in place, so each step is a pointer bump and a compare
+ * instead of a bounds-checked `list_get` copy. An iterator set up with
+ * `list_iter_init` can also prefetch a configurable distance ahead, once per
+ * cache line. Hardware prefetchers already keep up with plain sequential
+ * walks, so this pays off only when the work per element is heavy enough
+ * to hide the extra instructions.
+ *
+ * `list_iter_next_span` hands out contiguous runs of up to N elements
+ * instead, so consumers can process cache-sized batches with their own
+ * tight loops.
+ *
+ * Any operation that resizes the list invalidates its iterators.
+ *
+ * ### Example Usage
+ * @code
+ * for (list_iter it = list_iter_begin(&samples); !list_iter_done(&it);) {
+ *     const sample* s = list_iter_next(&it);
+ *     total += s->value;
+ * }
+ *
+ * list_iter it = list_iter_begin(&values);
+ * double* span;
+ * size_t n;
+ * while ((n = list_iter_next_span(&it, 4096, (void**) &span)) > 0) {
+ *     process_batch(span, n);
+ * }
+ * @endcode
+ */
+
+/**
+ * @brief A reasonable prefetch distance in bytes for `list_iter_init`.
+ */
+#define LIST_ITER_PREFETCH_DISTANCE 512
+
+/**
+ * @brief Cache line size assumed when spacing prefetches.
+ */
+#define LIST_ITER_LINE_SIZE 64
+
+/**
+ * @brief Direction flags for `list_iter_init`.
+ *
+ * @var LIST_ITER_FORWARD
+ *      Walk from the first element to the last.
+ *
+ * @var LIST_ITER_REVERSE
+ *      Walk from the last element to the first.
+ */
+typedef enum {
+    LIST_ITER_FORWARD = 0,
+    LIST_ITER_REVERSE = 1u << 0,
+} list_iter_flags;
+
+/**
+ * @brief A cursor over the elements of a list.
+ *
+ * @var list_iter::cur
+ *      The next element to hand out, or where the walk ends once done.
+ *
+ * @var list_iter::stop
+ *      One past the last element for a forward walk, the first element for a reverse one.
+ *
+ * @var list_iter::elem_size
+ *      The size of each element in bytes.
+ *
+ * @var list_iter::reverse
+ *      Whether the walk goes from the back to the front.
+ *
+ * @var list_iter::prefetch
+ *      How many bytes ahead of `cur` to prefetch, or 0 to disable prefetching.
+ *
+ * @var list_iter::prefetch_at
+ *      Address at which the next prefetch is issued, one cache line after the last.
+ */
+typedef struct list_iter {
+    uint8_t* cur;
+    uint8_t* stop;
+    size_t   elem_size;
+    bool     reverse;
+    size_t   prefetch;
+    uint8_t* prefetch_at;
+} list_iter;
+
+/**
+ * @brief Hints that the cache line at `addr` will soon be read.
+ * @internal
+ */
+static inline void list_iter_prefetch_line([[maybe_unused]] const void* addr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr, 0, 3);
+#endif
+}
+
+/**
+ * @brief Positions an iterator at one end of a list.
+ *
+ * @param it Pointer to the iterator to initialize.
+ * @param lst Pointer to the list to walk, or `NULL` for an empty walk.
+ * @param flags `LIST_ITER_FORWARD` or `LIST_ITER_REVERSE`.
+ * @param prefetch How many bytes ahead to prefetch, or 0 to disable prefetching.
+ */
+static inline void list_iter_init(list_iter* it, const list* lst, const unsigned flags, const size_t prefetch) {
+    uint8_t* first = lst != nullptr ? (uint8_t*) lst->data : nullptr;
+    const size_t bytes = first != nullptr ? lst->size * lst->elem_size : 0;
+
+    it->elem_size = lst != nullptr ? lst->elem_size : 0;
+    it->reverse = (flags & LIST_ITER_REVERSE) != 0;
+    it->prefetch = prefetch;
+
+    if (first == nullptr) {
+        it->cur = nullptr;
+        it->stop = nullptr;
+    } else if (!it->reverse) {
+        it->cur = first;
+        it->stop = first + bytes;
+    } else {
+        // cur is one past the next element, so both directions end when cur meets stop
+        it->cur = first + bytes;
+        it->stop = first;
+    }
+    it->prefetch_at = it->cur;
+}
+
+/**
+ * @brief Returns a forward iterator at the first element, without prefetching.
+ *
+ * @param lst Pointer to the list.
+ * @return The iterator.
+ */
+static inline list_iter list_iter_begin(const list* lst) {
+    list_iter it;
+    list_iter_init(&it, lst, LIST_ITER_FORWARD, 0);
+    return it;
+}
+
+/**
+ * @brief Returns a reverse iterator at the last element, without prefetching.
+ *
+ * @param lst Pointer to the list.
+ * @return The iterator.
+ */
+static inline list_iter list_iter_rbegin(const list* lst) {
+    list_iter it;
+    list_iter_init(&it, lst, LIST_ITER_REVERSE, 0);
+    return it;
+}
+
+/**
+ * @brief Checks whether every element has been handed out.
+ *
+ * @param it Pointer to the iterator.
+ * @return `true` once the walk has reached its end.
+ */
+static inline bool list_iter_done(const list_iter* it) {
+    return it->cur == it->stop;
+}
+
+/**
+ * @brief Gets the number of elements not yet handed out.
+ *
+ * @param it Pointer to the iterator.
+ * @return The number of remaining elements.
+ */
+static inline size_t list_iter_remaining(const list_iter* it) {
+    if (it->elem_size == 0) return 0;
+
+    const size_t bytes = (size_t) (it->reverse ? it->cur - it->stop : it->stop - it->cur);
+    return bytes / it->elem_size;
+}
+
+/**
+ * @brief Hands out the next element and advances the iterator.
+ *
+ * @param it Pointer to the iterator.
+ * @return Pointer to the element in the list's buffer, or `NULL` once the walk is done.
+ */
+static inline void* list_iter_next(list_iter* it) {
+    if (it->cur == it->stop) return nullptr;
+
+    if (!it->reverse) {
+        uint8_t* elem = it->cur;
+        if (it->prefetch != 0 && elem >= it->prefetch_at) {
+            // The address may lie past the buffer; prefetches never fault
+            list_iter_prefetch_line((const uint8_t*) ((uintptr_t) elem + it->prefetch));
+            it->prefetch_at = elem + LIST_ITER_LINE_SIZE;
+        }
+        it->cur = elem + it->elem_size;
+        return elem;
+    }
+
+    uint8_t* elem = it->cur - it->elem_size;
+    if (it->prefetch != 0 && elem <= it->prefetch_at) {
+        list_iter_prefetch_line((const uint8_t*) ((uintptr_t) elem - it->prefetch));
+        it->prefetch_at = (uint8_t*) ((uintptr_t) elem - LIST_ITER_LINE_SIZE);
+    }
+    it->cur = elem;
+    return elem;
+}
+
+/**
+ * @brief Hands out the next run of up to `max_count` contiguous elements.
+ *
+ * The span's elements are always in memory order. A reverse iterator hands
+ * out spans from the back of the list to the front, so the caller walks
+ * each span backwards to visit elements in reverse. If the iterator was
+ * initialized with a non-zero prefetch distance, the start of the following
+ * span is prefetched.
+ *
+ * @param it Pointer to the iterator.
+ * @param max_count Largest number of elements to hand out.
+ * @param out_span Receives a pointer to the span's lowest-addressed element.
+ * @return The number of elements in the span, or 0 once the walk is done.
+ */
+static inline size_t list_iter_next_span(list_iter* it, const size_t max_count, void** out_span) {
+    size_t count = list_iter_remaining(it);
+    if (count > max_count) count = max_count;
+    if (count == 0) return 0;
+
+    const size_t bytes = count * it->elem_size;
+    if (!it->reverse) {
+        *out_span = it->cur;
+        it->cur += bytes;
+        if (it->prefetch != 0 && it->cur != it->stop) list_iter_prefetch_line(it->cur);
+    } else {
+        it->cur -= bytes;
+        *out_span = it->cur;
+        if (it->prefetch != 0 && it->cur != it->stop) list_iter_prefetch_line(it->cur - it->elem_size);
+    }
+    it->prefetch_at = it->cur;
+
+    return count;
+}
+
+#endif //LIST_ITER_H
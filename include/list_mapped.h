@@ -0,0 +1,78 @@
+#ifndef LIST_MAPPED_H
+#define LIST_MAPPED_H
+
+#include "list.h"
+
+/**
+ * @brief Options for `list_open_mapped`, combined with bitwise OR.
+ *
+ * @var LIST_MAP_NONE
+ *      Open an existing file and keep its contents.
+ *
+ * @var LIST_MAP_CREATE
+ *      Create the file if it does not exist.
+ *
+ * @var LIST_MAP_TRUNCATE
+ *      Discard any existing contents and start with an empty list.
+ */
+typedef enum {
+    LIST_MAP_NONE     = 0,
+    LIST_MAP_CREATE   = 1u << 0,
+    LIST_MAP_TRUNCATE = 1u << 1,
+} list_map_flags;
+
+/**
+ * @brief Opens a `list` whose buffer is a memory-mapped file.
+ *
+ * The file starts with a 64-byte header recording the element size, the
+ * element count and the capacity, followed by the elements themselves. An
+ * existing file is mapped as-is, so reopening a list costs one `mmap` no
+ * matter how many elements it holds, and the OS page cache decides which
+ * parts stay resident.
+ *
+ * The returned list works with every `list` function. Growth goes through
+ * the normal resize path, which extends the file with `ftruncate` and the
+ * mapping with `mremap` where available. The header's element count is
+ * only written by `list_sync` and when the list is closed; after a crash
+ * the file reopens with the size of the last sync, cut down to the
+ * elements still in the file if the list shrank since.
+ *
+ * Releasing the buffer closes the file: call `list_close_mapped` (or
+ * `list_destroy`) when done. `list_shrink_to_fit` keeps the file open and
+ * never takes the list below its first page of elements. The list must not
+ * be copied while mapped.
+ *
+ * The file format uses the byte order of the host and is not portable
+ * between architectures.
+ *
+ * @param lst Pointer to the list to open.
+ * @param path Path of the backing file.
+ * @param elem_size Size of each element in bytes. Must match an existing file.
+ * @param flags Bitwise OR of `list_map_flags` values.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments or if the
+ *         file is not a mapped list with this element size, `LIST_ERR_IO` if the
+ *         file cannot be opened or mapped, `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_open_mapped(list* lst, const char* path, size_t elem_size, unsigned flags);
+
+/**
+ * @brief Writes the element count to the file header and flushes the mapping to disk.
+ *
+ * @param lst Pointer to a list opened with `list_open_mapped`.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if the list is not mapped,
+ *         `LIST_ERR_IO` if flushing fails.
+ */
+list_status list_sync(list* lst);
+
+/**
+ * @brief Syncs a mapped list, then unmaps and closes its file.
+ *
+ * The list is left empty and can be reinitialized.
+ *
+ * @param lst Pointer to a list opened with `list_open_mapped`.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if the list is not mapped,
+ *         `LIST_ERR_IO` if the final sync fails. The list is closed either way.
+ */
+list_status list_close_mapped(list* lst);
+
+#endif //LIST_MAPPED_H
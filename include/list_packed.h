@@ -0,0 +1,165 @@
+#ifndef LIST_PACKED_H
+#define LIST_PACKED_H
+
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief Number of values encoded together in one block of a `list_packed`.
+ */
+#define LIST_PACKED_BLOCK 128
+
+/**
+ * @brief A compressed, append-only list of unsigned 32- or 64-bit integers.
+ *
+ * Values are stored in blocks of `LIST_PACKED_BLOCK`, each reduced to
+ * residuals against the block's base and bit-packed at the width of its
+ * largest residual. Every block picks the smaller of two encodings:
+ *
+ * - frame of reference, where residuals are offsets from the block's
+ *   minimum, so any value decodes on its own;
+ * - delta, for non-decreasing blocks, where residuals are the gaps to the
+ *   value four positions earlier. Sorted IDs usually pack several times
+ *   tighter this way, and a single value costs a prefix sum over its lane.
+ *
+ * Blocks whose residuals need more than 32 bits are kept at full width.
+ * Decoding unpacks a whole block with the SIMD kernels picked at runtime
+ * (see `list_simd_backend`), so sequential scans through
+ * `list_packed_decode` read a fraction of the bytes a plain `list` would.
+ * The last, partial block is kept unpacked until it fills up.
+ *
+ * Values are treated as unsigned; signed values still round-trip exactly
+ * but negative ones compress poorly. All storage lives in `list` buffers.
+ *
+ * @var list_packed::blocks
+ *      One header per full block, with its base, encoding, width and word offset.
+ *
+ * @var list_packed::words
+ *      The bit-packed residuals of every full block, as 32-bit words.
+ *
+ * @var list_packed::tail
+ *      Values appended since the last full block, at full width.
+ *
+ * @var list_packed::size
+ *      The number of values in the list.
+ *
+ * @var list_packed::elem_size
+ *      The size of each value in bytes, 4 or 8.
+ */
+typedef struct list_packed {
+    list   blocks;
+    list   words;
+    list   tail;
+    size_t size;
+    size_t elem_size;
+} list_packed;
+
+/**
+ * @brief Initializes an empty packed list.
+ *
+ * @param pk Pointer to the list to initialize.
+ * @param elem_size Size of each value in bytes: 4 for `uint32_t`, 8 for `uint64_t`.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `pk` is `NULL` or `elem_size` is not 4 or 8.
+ */
+list_status list_packed_init(list_packed* pk, size_t elem_size);
+
+/**
+ * @brief Builds a packed list holding the elements of a plain list.
+ *
+ * @param pk Pointer to an uninitialized packed list.
+ * @param src Pointer to a list of 4- or 8-byte unsigned integers.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_packed_from_list(list_packed* pk, const list* src);
+
+/**
+ * @brief Frees all memory held by the list.
+ *
+ * @param pk Pointer to the list to destroy.
+ */
+void list_packed_destroy(list_packed* pk);
+
+/**
+ * @brief Gets the number of values in the list.
+ *
+ * @param pk Pointer to the list.
+ * @return Number of values in the list.
+ */
+size_t list_packed_size(const list_packed* pk);
+
+/**
+ * @brief Gets the number of bytes of buffer capacity held by the list.
+ *
+ * @param pk Pointer to the list.
+ * @return Combined capacity of the block headers, packed words and tail in bytes.
+ */
+size_t list_packed_bytes(const list_packed* pk);
+
+/**
+ * @brief Appends a value, encoding a block once `LIST_PACKED_BLOCK` values are pending.
+ *
+ * @param pk Pointer to the list.
+ * @param value Pointer to the value to add.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_packed_push(list_packed* pk, const void* value);
+
+/**
+ * @brief Appends `count` values, encoding full blocks straight from `values`.
+ *
+ * The bulk-build path: once any pending tail is topped up, whole blocks are
+ * packed without being staged, and the block headers are reserved once.
+ *
+ * @param pk Pointer to the list.
+ * @param values Pointer to `count` contiguous values.
+ * @param count Number of values to append.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `values` is `NULL` with a
+ *         non-zero count, `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_packed_push_n(list_packed* pk, const void* values, size_t count);
+
+/**
+ * @brief Gets the value at a specified index.
+ *
+ * Locates the block in O(1) and decodes only the one value, which for a
+ * delta-encoded block costs up to `LIST_PACKED_BLOCK / 4` residual reads.
+ *
+ * @param pk Pointer to the list.
+ * @param index Zero-based index of the value.
+ * @param out_value Pointer to where the value will be stored.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if the index is invalid.
+ */
+list_status list_packed_get(const list_packed* pk, size_t index, void* out_value);
+
+/**
+ * @brief Decodes a range of values into a plain array.
+ *
+ * @param pk Pointer to the list.
+ * @param first Index of the first value to decode.
+ * @param count Number of values to decode.
+ * @param out Receives `count` values of `elem_size` bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if the range does not lie within the list.
+ */
+list_status list_packed_decode(const list_packed* pk, size_t first, size_t count, void* out);
+
+/**
+ * @brief Releases the spare capacity of the packed buffers once the list is built.
+ *
+ * @param pk Pointer to the list.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `pk` is `NULL`,
+ *         `LIST_ERR_ALLOC` if reallocation fails.
+ */
+list_status list_packed_shrink_to_fit(list_packed* pk);
+
+/**
+ * @brief Removes every value without freeing the buffers.
+ *
+ * @param pk Pointer to the list.
+ */
+void list_packed_clear(list_packed* pk);
+
+#endif //LIST_PACKED_H
@@ -0,0 +1,121 @@
+#ifndef LIST_PAGES_H
+#define LIST_PAGES_H
+
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief Size in bytes of a cache line, the usual alignment for vector loads.
+ */
+#define LIST_CACHE_LINE_SIZE 64
+
+/**
+ * @brief Size in bytes of a huge page; mapped lengths are rounded to it when huge pages are requested.
+ */
+#define LIST_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+/**
+ * @brief Buffer size in bytes from which a `list_pages` allocator maps memory by default.
+ */
+#define LIST_PAGES_DEFAULT_THRESHOLD LIST_HUGE_PAGE_SIZE
+
+/**
+ * @brief Options of a `list_pages` allocator.
+ *
+ * @var LIST_PAGES_NONE
+ *      Serve every buffer from the heap, aligned as requested.
+ *
+ * @var LIST_PAGES_MAP
+ *      Map buffers of at least the threshold size directly with `mmap`.
+ *      They grow and shrink with `mremap`, which moves page table entries
+ *      instead of copying the contents.
+ *
+ * @var LIST_PAGES_HUGEPAGE
+ *      Like `LIST_PAGES_MAP`, and also ask the kernel to back mapped
+ *      buffers with transparent huge pages (`madvise(MADV_HUGEPAGE)`).
+ *
+ * @var LIST_PAGES_HUGETLB
+ *      Like `LIST_PAGES_HUGEPAGE`, but first try explicitly reserved huge
+ *      pages (`MAP_HUGETLB`), falling back to transparent ones when none
+ *      are available.
+ */
+typedef enum {
+    LIST_PAGES_NONE     = 0,
+    LIST_PAGES_MAP      = 1u << 0,
+    LIST_PAGES_HUGEPAGE = 1u << 1,
+    LIST_PAGES_HUGETLB  = 1u << 2,
+} list_pages_flags;
+
+/**
+ * @brief An allocator for large or over-aligned list buffers.
+ *
+ * Every buffer it hands out is aligned to `alignment`, so a list of vectors
+ * can use aligned loads on its data. Optionally, buffers of at least
+ * `map_threshold` bytes bypass the heap: they are mapped directly, can be
+ * backed by huge pages to cut TLB misses on random access into multi-GB
+ * lists, and are resized with `mremap` rather than copied.
+ *
+ * Mapped lengths are rounded up to `LIST_HUGE_PAGE_SIZE` when huge pages are
+ * requested and to the system page size otherwise. On platforms without
+ * `mmap` the map flags are ignored and every buffer comes from the heap.
+ *
+ * One allocator can serve any number of lists, from any thread.
+ *
+ * @var list_pages::alignment
+ *      Alignment in bytes of every buffer.
+ *
+ * @var list_pages::map_threshold
+ *      Buffers of at least this many bytes are mapped when a map flag is set.
+ *
+ * @var list_pages::granule
+ *      Multiple that mapped lengths are rounded up to.
+ *
+ * @var list_pages::flags
+ *      A combination of `list_pages_flags`.
+ *
+ * @var list_pages::allocator
+ *      A `list_allocator` bound to this configuration, for use with
+ *      `list_init_with_allocator`.
+ *
+ * ### Example Usage
+ * @code
+ * list_pages pages;
+ * list_pages_init(&pages, LIST_CACHE_LINE_SIZE, 0, LIST_PAGES_HUGEPAGE);
+ *
+ * list samples;
+ * list_init_with_allocator(&samples, 0, sizeof(double), list_pages_allocator(&pages));
+ * // ... the buffer is 64-byte aligned, and on huge pages once it reaches 2 MB ...
+ * list_destroy(&samples);
+ * @endcode
+ */
+typedef struct list_pages {
+    size_t         alignment;
+    size_t         map_threshold;
+    size_t         granule;
+    unsigned       flags;
+    list_allocator allocator;
+} list_pages;
+
+/**
+ * @brief Initializes a page allocator.
+ *
+ * @param pages Pointer to the allocator to initialize. Must outlive every list using it.
+ * @param alignment Alignment of every buffer: a power of two no larger than
+ *        `LIST_PAGE_SIZE`, or 0 for the alignment of `malloc`.
+ * @param map_threshold Size in bytes from which buffers are mapped, or 0 for
+ *        `LIST_PAGES_DEFAULT_THRESHOLD`. Ignored without a map flag.
+ * @param flags A combination of `list_pages_flags`.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `pages` is `NULL`, the
+ *         alignment is invalid or a flag is unknown.
+ */
+list_status list_pages_init(list_pages* pages, size_t alignment, size_t map_threshold, unsigned flags);
+
+/**
+ * @brief Gets the `list_allocator` bound to a page allocator.
+ *
+ * @param pages Pointer to the allocator.
+ * @return The allocator, or `NULL` if `pages` is `NULL`.
+ */
+const list_allocator* list_pages_allocator(list_pages* pages);
+
+#endif //LIST_PAGES_H
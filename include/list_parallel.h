@@ -0,0 +1,93 @@
+#ifndef LIST_PARALLEL_H
+#define LIST_PARALLEL_H
+
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief Maximum number of threads, including the caller, that work on one call.
+ */
+#define LIST_PARALLEL_MAX_THREADS 256
+
+/**
+ * @brief Target size in bytes of the ranges handed to each thread.
+ *
+ * The element count per range is derived from `elem_size` and rounded so
+ * that every range spans whole 64-byte cache lines, which keeps threads
+ * writing neighbouring ranges from sharing a line.
+ */
+#define LIST_PARALLEL_CHUNK_BYTES (64 * 1024)
+
+/**
+ * @brief Calls `fn` on every element of a list, spread across a thread pool.
+ *
+ * The buffer is split into contiguous ranges of about
+ * `LIST_PARALLEL_CHUNK_BYTES` that threads claim dynamically, so uneven
+ * per-element cost still balances. `fn` receives whole ranges rather than
+ * single elements and may modify them in place, which also covers maps.
+ *
+ * Work runs on a process-wide pool created on first use and reused by
+ * later calls; the calling thread takes part. If the pool is already busy
+ * (another thread's call, or a call from inside `fn`) the work runs on the
+ * calling thread alone. Lists smaller than one range also run there.
+ *
+ * @param lst Pointer to the list. Must not be resized while the call runs.
+ * @param fn Callback receiving `count` contiguous elements, the index of the first, and `ctx`.
+ *        Called concurrently from several threads.
+ * @param ctx User data passed to `fn`.
+ * @param nthreads Maximum number of threads to use, or 0 for one per hardware thread.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` or `fn` is `NULL`.
+ */
+list_status list_parallel_for(
+    list* lst,
+    void (*fn)(void* elems, size_t count, size_t first_index, void* ctx),
+    void* ctx,
+    size_t nthreads);
+
+/**
+ * @brief Reduces the elements of a list to a single value using a thread pool.
+ *
+ * On entry `result` holds the identity value. Each range is folded by
+ * `reduce` into its own copy of the identity, and the partial results are
+ * then merged into `result` with `combine` in range order. Ranges depend
+ * only on the list's size and `elem_size`, so the result is the same for
+ * any thread count, even for non-associative operations like floating
+ * point addition.
+ *
+ * Scheduling is as for `list_parallel_for`.
+ *
+ * @param lst Pointer to the list.
+ * @param reduce Folds `count` contiguous elements into `accumulator`. Called concurrently.
+ * @param combine Folds the partial result `other` into `accumulator`. Called on the calling thread.
+ * @param result Holds the identity on entry and the reduced value on return.
+ * @param result_size Size of the result in bytes.
+ * @param ctx User data passed to `reduce` and `combine`.
+ * @param nthreads Maximum number of threads to use, or 0 for one per hardware thread.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments,
+ *         `LIST_ERR_ALLOC` if the partial results cannot be allocated.
+ */
+list_status list_parallel_reduce(
+    const list* lst,
+    void (*reduce)(const void* elems, size_t count, void* accumulator, void* ctx),
+    void (*combine)(void* accumulator, const void* other, void* ctx),
+    void* result,
+    size_t result_size,
+    void* ctx,
+    size_t nthreads);
+
+/**
+ * @brief Gets the number of hardware threads available to the process.
+ *
+ * @return The number of online processors, or 1 if it cannot be determined.
+ */
+size_t list_parallel_hardware_threads(void);
+
+/**
+ * @brief Stops and joins the threads of the shared pool.
+ *
+ * Optional; the pool is recreated by the next parallel call. Must not be
+ * called while a parallel call is running.
+ */
+void list_parallel_shutdown(void);
+
+#endif //LIST_PARALLEL_H
@@ -0,0 +1,211 @@
+#ifndef LIST_SEGMENTED_H
+#define LIST_SEGMENTED_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "list.h"
+
+/**
+ * @brief Maximum number of chunks a `list_segmented` can allocate.
+ */
+#define LIST_SEGMENTED_MAX_CHUNKS 48
+
+/**
+ * @brief Default number of elements in the first chunk of a `list_segmented`.
+ */
+#define LIST_SEGMENTED_DEFAULT_CHUNK 64
+
+/**
+ * @brief Largest first chunk a `list_segmented` accepts.
+ *
+ * Chunk `k` holds `first_chunk << k` elements, so the first chunk is capped
+ * to keep the size of the last of the `LIST_SEGMENTED_MAX_CHUNKS` chunks
+ * representable in a `size_t` (32768 elements with a 64-bit `size_t`).
+ */
+#define LIST_SEGMENTED_MAX_FIRST_CHUNK \
+    ((size_t) 1 << (SIZE_WIDTH > LIST_SEGMENTED_MAX_CHUNKS ? SIZE_WIDTH - 1 - LIST_SEGMENTED_MAX_CHUNKS : 0))
+
+/**
+ * @brief A list stored in geometrically growing chunks instead of one buffer.
+ *
+ * It offers the same push/pop/get/set operations and `list_status` codes as
+ * `list`, but growing never reallocates: a full list gains a new chunk twice
+ * the size of the previous one, and existing elements stay where they are.
+ * This removes the large copy (and the momentary doubling of memory) that
+ * `realloc` causes on huge lists, and makes element pointers returned by
+ * `list_segmented_at` stable for as long as the element exists.
+ *
+ * Element `i` lives in chunk `k = log2(i / first_chunk + 1)`, so indexing
+ * costs a bit scan and two loads instead of one.
+ *
+ * Chunks are reference counted, so `list_segmented_snapshot` can share
+ * them between lists and a write copies only the chunk it lands in.
+ *
+ * @var list_segmented::chunks
+ *      The chunk index. Chunk `k` holds `first_chunk << k` elements.
+ *
+ * @var list_segmented::size
+ *      The number of elements currently stored in the list.
+ *
+ * @var list_segmented::chunk_count
+ *      The number of chunks currently allocated.
+ *
+ * @var list_segmented::elem_size
+ *      The size of each element in bytes.
+ *
+ * @var list_segmented::first_chunk_shift
+ *      Base-2 logarithm of the number of elements in the first chunk.
+ *
+ * @var list_segmented::shared_chunks
+ *      Bit `k` is set while chunk `k` may be shared with a snapshot and must
+ *      be checked before it is written.
+ */
+typedef struct list_segmented {
+    uint8_t* chunks[LIST_SEGMENTED_MAX_CHUNKS];
+    size_t   size;
+    size_t   chunk_count;
+    size_t   elem_size;
+    unsigned first_chunk_shift;
+    uint64_t shared_chunks;
+} list_segmented;
+
+/**
+ * @brief Initializes an empty segmented list.
+ *
+ * @param seg Pointer to the list to initialize.
+ * @param elem_size Size of each element in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `seg` is `NULL` or `elem_size` is 0.
+ */
+list_status list_segmented_init(list_segmented* seg, size_t elem_size);
+
+/**
+ * @brief Initializes an empty segmented list with a chosen first chunk size.
+ *
+ * No memory is allocated until the first push.
+ *
+ * @param seg Pointer to the list to initialize.
+ * @param capacity Number of elements in the first chunk, rounded up to a power of two.
+ *        At most `LIST_SEGMENTED_MAX_FIRST_CHUNK`.
+ * @param elem_size Size of each element in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments.
+ */
+list_status list_segmented_init_with_capacity(list_segmented* seg, size_t capacity, size_t elem_size);
+
+/**
+ * @brief Releases every chunk owned by the list.
+ *
+ * @param seg Pointer to the list to destroy.
+ */
+void list_segmented_destroy(list_segmented* seg);
+
+/**
+ * @brief Gets the current size of the list (number of elements stored).
+ *
+ * @param seg Pointer to the list.
+ * @return Number of elements in the list.
+ */
+size_t list_segmented_size(const list_segmented* seg);
+
+/**
+ * @brief Gets the number of elements the allocated chunks can hold.
+ *
+ * @param seg Pointer to the list.
+ * @return Number of elements the list can currently hold.
+ */
+size_t list_segmented_capacity(const list_segmented* seg);
+
+/**
+ * @brief Adds a new element to the end of the list without moving existing elements.
+ *
+ * @param seg Pointer to the list.
+ * @param value Pointer to the value to add.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_ERR_ALLOC` if allocation fails.
+ */
+list_status list_segmented_push(list_segmented* seg, const void* value);
+
+/**
+ * @brief Removes the last element from the list and optionally retrieves its value.
+ *
+ * Once the second-to-last chunk becomes empty, the last chunk is released.
+ * Keeping one empty chunk in reserve stops a list oscillating around a chunk
+ * boundary from allocating and freeing on every operation.
+ *
+ * @param seg Pointer to the list.
+ * @param out_value Pointer to where the popped value will be stored (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if the list is empty.
+ */
+list_status list_segmented_pop(list_segmented* seg, void* out_value);
+
+/**
+ * @brief Gets the value of an element at a specified index.
+ *
+ * @param seg Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @param out_value Pointer to where the value will be stored.
+ * @return `LIST_OK` on success, `LIST_OUT_OF_BOUNDS` if the index is invalid.
+ */
+list_status list_segmented_get(const list_segmented* seg, size_t index, void* out_value);
+
+/**
+ * @brief Sets the value of an element at a specified index.
+ *
+ * @param seg Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @param value Pointer to the value to set at the specified index.
+ * @return `LIST_OK` on success, `LIST_OUT_OF_BOUNDS` if the index is invalid.
+ */
+list_status list_segmented_set(list_segmented* seg, size_t index, const void* value);
+
+/**
+ * @brief Gets a stable pointer to the element at a specified index.
+ *
+ * The pointer stays valid until the element is popped or the list is
+ * destroyed; pushes never invalidate it. Writes through it reach every
+ * snapshot sharing the chunk unless `list_segmented_unshare` was called
+ * first, and a later write through `list_segmented_set` or
+ * `list_segmented_push` may move the element to a private chunk.
+ *
+ * @param seg Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @return Pointer to the element, or `NULL` if the index is invalid.
+ */
+void* list_segmented_at(const list_segmented* seg, size_t index);
+
+/**
+ * @brief Clears all elements from the list without freeing its chunks.
+ *
+ * @param seg Pointer to the list.
+ */
+void list_segmented_clear(list_segmented* seg);
+
+/**
+ * @brief Takes an O(1)-per-chunk copy-on-write snapshot of a segmented list.
+ *
+ * `src` and `out` share every chunk, each guarded by an atomic reference
+ * count, and stay independent: the first `list_segmented_set` or
+ * `list_segmented_push` landing in a shared chunk copies that chunk alone,
+ * and `list_segmented_pop` only drops references. A chunk is freed by the
+ * last list to let go of it. Holders on different threads may use their
+ * own lists concurrently.
+ *
+ * @param src Pointer to the list to snapshot.
+ * @param out Pointer to an uninitialized list that receives the snapshot.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`
+ *         or the two are the same list.
+ */
+list_status list_segmented_snapshot(list_segmented* src, list_segmented* out);
+
+/**
+ * @brief Gives a segmented list private copies of every chunk it shares.
+ *
+ * Needed only before writing through `list_segmented_at`. Chunks no other
+ * list holds any more are kept without copying.
+ *
+ * @param seg Pointer to the list.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `seg` is `NULL`,
+ *         `LIST_ERR_ALLOC` if a copy cannot be allocated.
+ */
+list_status list_segmented_unshare(list_segmented* seg);
+
+#endif //LIST_SEGMENTED_H
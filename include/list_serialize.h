@@ -0,0 +1,147 @@
+#ifndef LIST_SERIALIZE_H
+#define LIST_SERIALIZE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "list.h"
+
+/**
+ * @brief Version of the binary format written by this library.
+ */
+#define LIST_SERIALIZE_VERSION 1
+
+/**
+ * @brief Size in bytes of the header that precedes the payload.
+ *
+ * A serialized list is this header followed by `count * elem_size` bytes of
+ * raw elements, so payloads keep the alignment of the buffer up to 32 bytes.
+ */
+#define LIST_SERIALIZE_HEADER_SIZE 32
+
+/**
+ * @brief Options for writing a serialized list, combined with bitwise OR.
+ *
+ * @var LIST_SERIALIZE_NONE
+ *      Write the header and payload only.
+ *
+ * @var LIST_SERIALIZE_CHECKSUM
+ *      Store a 64-bit FNV-1a checksum of the payload, verified on load.
+ */
+typedef enum {
+    LIST_SERIALIZE_NONE     = 0,
+    LIST_SERIALIZE_CHECKSUM = 1u << 0,
+} list_serialize_flags;
+
+/**
+ * @brief A read-only, non-owning view of contiguous elements.
+ *
+ * Views let serialized data be read in place, for example straight out of a
+ * shared memory segment or a received buffer, without copying it into a
+ * `list`. The viewed buffer must outlive the view.
+ *
+ * @var list_view::data
+ *      Pointer to the first element.
+ *
+ * @var list_view::size
+ *      The number of elements in the view.
+ *
+ * @var list_view::elem_size
+ *      The size of each element in bytes.
+ */
+typedef struct list_view {
+    const void* data;
+    size_t      size;
+    size_t      elem_size;
+} list_view;
+
+/**
+ * @brief Gets the number of bytes `list_save` needs for a list.
+ *
+ * @param lst Pointer to the list.
+ * @return Size of the serialized list in bytes, or 0 if `lst` is `NULL` or too large.
+ */
+size_t list_serialized_size(const list* lst);
+
+/**
+ * @brief Serializes a list into a caller-provided buffer.
+ *
+ * @param lst Pointer to the list.
+ * @param buffer Destination buffer.
+ * @param buffer_size Size of `buffer` in bytes; at least `list_serialized_size(lst)`.
+ * @param flags Bitwise OR of `list_serialize_flags` values.
+ * @param out_written Receives the number of bytes written (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments or if
+ *         the buffer is too small.
+ */
+list_status list_save(const list* lst, void* buffer, size_t buffer_size, unsigned flags, size_t* out_written);
+
+/**
+ * @brief Initializes a list with a copy of the elements in a serialized buffer.
+ *
+ * @param lst Pointer to the list to initialize.
+ * @param buffer Buffer holding a serialized list.
+ * @param buffer_size Size of `buffer` in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if the buffer is not a valid
+ *         serialized list, `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_load(list* lst, const void* buffer, size_t buffer_size);
+
+/**
+ * @brief Wraps a serialized buffer in a view without copying the payload.
+ *
+ * The header is validated, and so is the checksum if one was stored.
+ *
+ * @param view Pointer to the view to initialize.
+ * @param buffer Buffer holding a serialized list.
+ * @param buffer_size Size of `buffer` in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if the buffer is not a valid serialized list.
+ */
+list_status list_view_from_buffer(list_view* view, const void* buffer, size_t buffer_size);
+
+/**
+ * @brief Gets a view of a list's current elements.
+ *
+ * The view is invalidated by anything that resizes the list.
+ *
+ * @param lst Pointer to the list.
+ * @return A view of the list; empty if `lst` is `NULL`.
+ */
+list_view list_view_of(const list* lst);
+
+/**
+ * @brief Gets a pointer to an element of a view.
+ *
+ * @param view Pointer to the view.
+ * @param index Zero-based index of the element.
+ * @return Pointer to the element, or `NULL` if the index is invalid.
+ */
+const void* list_view_at(const list_view* view, size_t index);
+
+/**
+ * @brief Writes a serialized list to a file descriptor.
+ *
+ * The header and payload are written with a single `writev`, repeated only
+ * if the descriptor accepts a partial write (as sockets and pipes may).
+ *
+ * @param lst Pointer to the list.
+ * @param fd File descriptor opened for writing.
+ * @param flags Bitwise OR of `list_serialize_flags` values.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments,
+ *         `LIST_ERR_IO` if writing fails.
+ */
+list_status list_write_fd(const list* lst, int fd, unsigned flags);
+
+/**
+ * @brief Initializes a list from a serialized list read from a file descriptor.
+ *
+ * The payload is read straight into the list's buffer with no intermediate copy.
+ *
+ * @param lst Pointer to the list to initialize.
+ * @param fd File descriptor opened for reading.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if the data is not a valid
+ *         serialized list, `LIST_ERR_IO` if reading fails or ends early,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_read_fd(list* lst, int fd);
+
+#endif //LIST_SERIALIZE_H
@@ -0,0 +1,65 @@
+#ifndef LIST_SNAPSHOT_H
+#define LIST_SNAPSHOT_H
+
+#include "list.h"
+
+/**
+ * @brief Takes an O(1) copy-on-write snapshot of a list.
+ *
+ * Instead of copying the elements, `src` and `out` share one buffer guarded
+ * by an atomic reference count. Each list stays independent: the first
+ * mutating `list_` call on either of them (`list_push`, `list_set`,
+ * `list_pop`, `list_sort` and so on) first detaches a private copy, leaving
+ * the other holders untouched. The last holder to detach or be destroyed
+ * frees the shared buffer, so a snapshot may outlive its source.
+ *
+ * Snapshots can be handed to other threads: holders on different threads
+ * may read, write and destroy their own lists concurrently, as the count is
+ * updated atomically. A single list is still not safe to use from several
+ * threads at once.
+ *
+ * Only the `list_` functions detach, including `list_push_unchecked` and
+ * `list_set_unchecked` and so the `LIST_FAST` versions of `list_push` and
+ * `list_set`, along with the push and set of typed lists from
+ * `list_typed.h`. Writing through `list_data`, `list_at`,
+ * `list_at_unchecked`, a typed list's `_data` or a `list_iter` changes
+ * every holder's elements; call `list_unshare` first. Memory-mapped lists
+ * cannot be shared.
+ *
+ * A list with inline storage moves its elements to the heap so they can be
+ * shared. `out` is overwritten without being destroyed first and inherits
+ * the policies, flags and allocator of `src`.
+ *
+ * @param src Pointer to the list to snapshot.
+ * @param out Pointer to an uninitialized list that receives the snapshot.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         the two are the same list or `src` is memory-mapped,
+ *         `LIST_ERR_ALLOC` if the shared block cannot be allocated.
+ */
+list_status list_snapshot(list* src, list* out);
+
+/**
+ * @brief Gives a list a private copy of a buffer it shares with snapshots.
+ *
+ * Does nothing if the buffer is not shared. If every other holder has
+ * already let go of it, the list takes the buffer back without copying.
+ *
+ * @param lst Pointer to the list.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`,
+ *         `LIST_ERR_ALLOC` if the private copy cannot be allocated.
+ */
+list_status list_unshare(list* lst);
+
+/**
+ * @brief Checks whether a list's buffer is currently shared with another list.
+ *
+ * The answer may be stale as soon as it is returned if holders on other
+ * threads let go of the buffer concurrently; it only ever changes from
+ * shared to not shared that way.
+ *
+ * @param lst Pointer to the list.
+ * @return `true` if at least one other list holds the same buffer.
+ */
+bool list_shares_buffer(const list* lst);
+
+#endif //LIST_SNAPSHOT_H
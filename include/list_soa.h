@@ -0,0 +1,198 @@
+#ifndef LIST_SOA_H
+#define LIST_SOA_H
+
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief Maximum number of fields in a `list_soa` schema.
+ */
+#define LIST_SOA_MAX_FIELDS 16
+
+/**
+ * @brief Describes one field of the rows stored in a `list_soa`.
+ *
+ * @var list_soa_field::size
+ *      Size of the field in bytes.
+ *
+ * @var list_soa_field::offset
+ *      Offset of the field within the caller's row struct, as given by `offsetof`.
+ */
+typedef struct list_soa_field {
+    size_t size;
+    size_t offset;
+} list_soa_field;
+
+/**
+ * @brief Builds the `list_soa_field` for a member of a row struct.
+ */
+#define LIST_SOA_FIELD(type, member) ((list_soa_field) { sizeof(((type*) 0)->member), offsetof(type, member) })
+
+/**
+ * @brief A list of rows stored column by column (struct of arrays).
+ *
+ * Each field lives in its own `list`, so a loop that reads one field
+ * touches only that field's bytes instead of pulling whole rows through
+ * the cache, and each column can be handed to `list_find`,
+ * `list_parallel_reduce` and friends on its own. Rows are still pushed and
+ * read whole, gathered from and scattered to the caller's row struct
+ * using the schema's offsets.
+ *
+ * Every column grows under the normal `list` growth rules. A push reserves
+ * room in all columns before writing any, so a failed push leaves the
+ * columns the same length.
+ *
+ * @var list_soa::columns
+ *      One list per field, holding that field of every row.
+ *
+ * @var list_soa::offsets
+ *      Offset of each field within a row struct.
+ *
+ * @var list_soa::field_count
+ *      The number of fields in the schema.
+ *
+ * @var list_soa::size
+ *      The number of rows.
+ *
+ * ### Example Usage
+ * @code
+ * typedef struct sample { uint64_t id; uint64_t timestamp; double value; uint32_t flags; } sample;
+ *
+ * const list_soa_field schema[] = {
+ *     LIST_SOA_FIELD(sample, id), LIST_SOA_FIELD(sample, timestamp),
+ *     LIST_SOA_FIELD(sample, value), LIST_SOA_FIELD(sample, flags),
+ * };
+ *
+ * list_soa samples;
+ * list_soa_init(&samples, schema, 4);
+ * list_soa_push(&samples, &(sample) { 1, 1700000000, 2.5, 0 });
+ *
+ * const double* values = list_soa_column(&samples, 2);
+ * for (size_t i = 0; i < list_soa_size(&samples); i++) total += values[i];
+ * @endcode
+ */
+typedef struct list_soa {
+    list   columns[LIST_SOA_MAX_FIELDS];
+    size_t offsets[LIST_SOA_MAX_FIELDS];
+    size_t field_count;
+    size_t size;
+} list_soa;
+
+/**
+ * @brief Initializes an empty struct-of-arrays list.
+ *
+ * @param soa Pointer to the list to initialize.
+ * @param fields The schema: the size and row offset of each field.
+ * @param field_count Number of fields, from 1 to `LIST_SOA_MAX_FIELDS`.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on an invalid schema,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_soa_init(list_soa* soa, const list_soa_field* fields, size_t field_count);
+
+/**
+ * @brief Initializes an empty struct-of-arrays list with room for `capacity` rows.
+ *
+ * @param soa Pointer to the list to initialize.
+ * @param fields The schema: the size and row offset of each field.
+ * @param field_count Number of fields, from 1 to `LIST_SOA_MAX_FIELDS`.
+ * @param capacity Initial number of rows every column can hold.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on an invalid schema,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_soa_init_with_capacity(list_soa* soa, const list_soa_field* fields, size_t field_count, size_t capacity);
+
+/**
+ * @brief Releases every column.
+ *
+ * @param soa Pointer to the list to destroy.
+ */
+void list_soa_destroy(list_soa* soa);
+
+/**
+ * @brief Gets the number of rows.
+ *
+ * @param soa Pointer to the list.
+ * @return The number of rows, or 0 if `soa` is `NULL`.
+ */
+size_t list_soa_size(const list_soa* soa);
+
+/**
+ * @brief Appends a row, copying each field out of `row` into its column.
+ *
+ * @param soa Pointer to the list.
+ * @param row Pointer to a row struct laid out as described by the schema.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_ERR_ALLOC` if a column cannot grow, in which case no column changes.
+ */
+list_status list_soa_push(list_soa* soa, const void* row);
+
+/**
+ * @brief Removes the last row and optionally retrieves it.
+ *
+ * @param soa Pointer to the list.
+ * @param out_row Pointer to a row struct to fill (optional, can be `NULL`).
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `soa` is `NULL` or the list is empty.
+ */
+list_status list_soa_pop(list_soa* soa, void* out_row);
+
+/**
+ * @brief Gathers the row at `index` into a row struct.
+ *
+ * @param soa Pointer to the list.
+ * @param index Zero-based index of the row.
+ * @param out_row Pointer to a row struct to fill.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if `index` is not less than the size.
+ */
+list_status list_soa_get(const list_soa* soa, size_t index, void* out_row);
+
+/**
+ * @brief Overwrites the row at `index` with the fields of `row`.
+ *
+ * @param soa Pointer to the list.
+ * @param index Zero-based index of the row.
+ * @param row Pointer to a row struct laid out as described by the schema.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_OUT_OF_BOUNDS` if `index` is not less than the size.
+ */
+list_status list_soa_set(list_soa* soa, size_t index, const void* row);
+
+/**
+ * @brief Gets a pointer to one field of one row.
+ *
+ * @param soa Pointer to the list.
+ * @param index Zero-based index of the row.
+ * @param field Index of the field in the schema.
+ * @return Pointer to the field, or `NULL` if an argument is out of range.
+ */
+void* list_soa_at(const list_soa* soa, size_t index, size_t field);
+
+/**
+ * @brief Gets the contiguous array holding one field of every row.
+ *
+ * The array has `list_soa_size(soa)` elements and stays valid until the
+ * next push or pop.
+ *
+ * @param soa Pointer to the list.
+ * @param field Index of the field in the schema.
+ * @return Pointer to the column, or `NULL` if an argument is out of range or the list is empty.
+ */
+void* list_soa_column(const list_soa* soa, size_t field);
+
+/**
+ * @brief Gets the `list` that stores one column, for use with the read-only `list` functions.
+ *
+ * @param soa Pointer to the list.
+ * @param field Index of the field in the schema.
+ * @return The column's list, or `NULL` if an argument is out of range.
+ */
+const list* list_soa_column_list(const list_soa* soa, size_t field);
+
+/**
+ * @brief Removes every row while keeping the column buffers.
+ *
+ * @param soa Pointer to the list.
+ */
+void list_soa_clear(list_soa* soa);
+
+#endif //LIST_SOA_H
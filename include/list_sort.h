@@ -0,0 +1,90 @@
+#ifndef LIST_SORT_H
+#define LIST_SORT_H
+
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief Lists with fewer elements than this are sorted serially by `list_sort_parallel`.
+ */
+#define LIST_SORT_PARALLEL_THRESHOLD 65536
+
+/**
+ * @brief Element types that `list_sort_keys` can sort without a comparator.
+ *
+ * Each type requires `elem_size` to match its size (4 or 8 bytes). Floating
+ * point keys sort in IEEE total order: negative NaNs first, then -inf up to
+ * +inf, then positive NaNs, with -0.0 before +0.0.
+ */
+typedef enum {
+    LIST_KEY_I32,
+    LIST_KEY_U32,
+    LIST_KEY_F32,
+    LIST_KEY_I64,
+    LIST_KEY_U64,
+    LIST_KEY_F64,
+} list_key_type;
+
+/**
+ * @brief Sorts a list in ascending order using a comparator.
+ *
+ * @param lst Pointer to the list.
+ * @param cmp Comparator with `qsort` semantics.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`.
+ */
+list_status list_sort(list* lst, int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief Sorts a list of plain integer or floating point keys with a radix sort.
+ *
+ * Runs in linear time with no comparator calls, and skips byte positions
+ * that are identical across all keys. Needs a scratch buffer the size of the list.
+ *
+ * @param lst Pointer to the list.
+ * @param key_type The type of every element.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if `lst` is `NULL`, the key type
+ *         is unknown or does not match `elem_size`, `LIST_ERR_ALLOC` if the scratch
+ *         buffer cannot be allocated.
+ */
+list_status list_sort_keys(list* lst, list_key_type key_type);
+
+/**
+ * @brief Sorts a large list with a parallel merge sort.
+ *
+ * The list is cut into one run per thread, the runs are sorted concurrently
+ * on the shared pool used by `list_parallel_for`, and are then merged
+ * pairwise, with the merges of each round also running concurrently. Like
+ * `list_sort`, the result is not stable. Lists below
+ * `LIST_SORT_PARALLEL_THRESHOLD` elements are sorted with `list_sort`.
+ *
+ * @param lst Pointer to the list.
+ * @param cmp Comparator with `qsort` semantics. Called concurrently.
+ * @param nthreads Maximum number of threads to use, or 0 for one per hardware thread.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` if an argument is `NULL`,
+ *         `LIST_ERR_ALLOC` if the merge buffer cannot be allocated.
+ */
+list_status list_sort_parallel(list* lst, int (*cmp)(const void* a, const void* b), size_t nthreads);
+
+/**
+ * @brief Finds the first element of a sorted list that is not less than `key`.
+ *
+ * @param lst Pointer to a list sorted by `cmp`.
+ * @param key Pointer to the key to search for.
+ * @param cmp Comparator called as `cmp(element, key)`.
+ * @return Index of the first element not less than `key`, or the list's size if
+ *         there is none (also 0 if an argument is `NULL`).
+ */
+size_t list_lower_bound(const list* lst, const void* key, int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief Finds an element equal to `key` in a sorted list.
+ *
+ * @param lst Pointer to a list sorted by `cmp`.
+ * @param key Pointer to the key to search for.
+ * @param cmp Comparator called as `cmp(element, key)`.
+ * @return Pointer to the first matching element, or `NULL` if there is none
+ *         or an argument is `NULL`.
+ */
+void* list_bsearch(const list* lst, const void* key, int (*cmp)(const void* a, const void* b));
+
+#endif //LIST_SORT_H
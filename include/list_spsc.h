@@ -0,0 +1,156 @@
+#ifndef LIST_SPSC_H
+#define LIST_SPSC_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include "list.h"
+
+/**
+ * @brief A bounded, lock-free queue for exactly one producer and one consumer thread.
+ *
+ * The ring lives in an ordinary `list` buffer sized by `list_init_with_capacity`,
+ * and is never resized. The producer only writes `tail` and the consumer
+ * only writes `head`, each published with a release store and read with an
+ * acquire load, so a handoff costs no locks and no read-modify-write
+ * atomics. Each side also keeps a private copy of the other side's index on
+ * its own cache line and only reloads the shared one when the copy says the
+ * ring is full (or empty), which keeps cache-line traffic between the two
+ * threads to a minimum.
+ *
+ * The batch functions move many elements with one index update, so a single
+ * publish covers the whole batch.
+ *
+ * @var list_spsc::buf
+ *      The list that owns the ring buffer. Only its capacity is used.
+ *
+ * @var list_spsc::capacity
+ *      Number of slots in the ring.
+ *
+ * @var list_spsc::tail
+ *      Number of elements pushed so far. Written by the producer.
+ *
+ * @var list_spsc::tail_slot
+ *      `tail` modulo `capacity`. Producer-private.
+ *
+ * @var list_spsc::head_cache
+ *      The producer's last seen value of `head`.
+ *
+ * @var list_spsc::head
+ *      Number of elements popped so far. Written by the consumer.
+ *
+ * @var list_spsc::head_slot
+ *      `head` modulo `capacity`. Consumer-private.
+ *
+ * @var list_spsc::tail_cache
+ *      The consumer's last seen value of `tail`.
+ *
+ * ### Example Usage
+ * @code
+ * list_spsc queue;
+ * list_spsc_init(&queue, 4096, sizeof(record));
+ *
+ * // On the producer thread:
+ * while (!list_spsc_try_push(&queue, &rec)) { }
+ *
+ * // On the consumer thread:
+ * record batch[64];
+ * const size_t n = list_spsc_pop_n(&queue, batch, 64);
+ *
+ * list_spsc_destroy(&queue);  // Once both threads are done
+ * @endcode
+ */
+typedef struct list_spsc {
+    list                      buf;
+    size_t                    capacity;
+    alignas(64) atomic_size_t tail;
+    size_t                    tail_slot;
+    size_t                    head_cache;
+    alignas(64) atomic_size_t head;
+    size_t                    head_slot;
+    size_t                    tail_cache;
+} list_spsc;
+
+/**
+ * @brief Initializes an empty queue.
+ *
+ * The ring holds at least `capacity` elements, sized exactly as
+ * `list_init_with_capacity` would size a list.
+ *
+ * @param q Pointer to the queue to initialize.
+ * @param capacity Minimum number of elements the queue can hold. Must not be 0.
+ * @param elem_size Size of each element in bytes.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+list_status list_spsc_init(list_spsc* q, size_t capacity, size_t elem_size);
+
+/**
+ * @brief Releases the queue's buffer.
+ *
+ * Must not be called while either thread is still using the queue.
+ *
+ * @param q Pointer to the queue to destroy.
+ */
+void list_spsc_destroy(list_spsc* q);
+
+/**
+ * @brief Gets the number of elements the queue can hold.
+ *
+ * @param q Pointer to the queue.
+ * @return The capacity, or 0 if `q` is `NULL`.
+ */
+size_t list_spsc_capacity(const list_spsc* q);
+
+/**
+ * @brief Gets the number of elements in the queue.
+ *
+ * Exact only when neither thread is working on the queue; otherwise a
+ * value that was correct at some moment during the call.
+ *
+ * @param q Pointer to the queue.
+ * @return The number of queued elements, or 0 if `q` is `NULL`.
+ */
+size_t list_spsc_size(const list_spsc* q);
+
+/**
+ * @brief Adds an element at the tail of the queue. Producer only.
+ *
+ * @param q Pointer to the queue.
+ * @param value Pointer to the value to add.
+ * @return `true` if the element was added, `false` if the queue is full or an argument is `NULL`.
+ */
+bool list_spsc_try_push(list_spsc* q, const void* value);
+
+/**
+ * @brief Removes the element at the head of the queue. Consumer only.
+ *
+ * @param q Pointer to the queue.
+ * @param out_value Pointer to where the removed value will be stored.
+ * @return `true` if an element was removed, `false` if the queue is empty or an argument is `NULL`.
+ */
+bool list_spsc_try_pop(list_spsc* q, void* out_value);
+
+/**
+ * @brief Adds up to `count` contiguous elements with a single publish. Producer only.
+ *
+ * Elements are added in order until the queue is full; the consumer sees
+ * all of them at once.
+ *
+ * @param q Pointer to the queue.
+ * @param values Pointer to the elements to add.
+ * @param count Number of elements to add.
+ * @return The number of elements added, or 0 if an argument is `NULL`.
+ */
+size_t list_spsc_push_n(list_spsc* q, const void* values, size_t count);
+
+/**
+ * @brief Removes up to `max_count` elements with a single publish. Consumer only.
+ *
+ * @param q Pointer to the queue.
+ * @param out_values Pointer to room for `max_count` elements.
+ * @param max_count Maximum number of elements to remove.
+ * @return The number of elements removed, or 0 if an argument is `NULL`.
+ */
+size_t list_spsc_pop_n(list_spsc* q, void* out_values, size_t max_count);
+
+#endif //LIST_SPSC_H
@@ -0,0 +1,177 @@
+#ifndef LIST_TYPED_H
+#define LIST_TYPED_H
+
+#include "list.h"
+
+/**
+ * @file list_typed.h
+ * @brief Header-only generator for type-specialized lists.
+ *
+ * `LIST_DEFINE(T, name)` declares a list type `name` that stores elements of
+ * type `T`, together with `static inline` functions `name_push`, `name_get`,
+ * `name_set`, `name_pop` and friends. Because the element type is known at
+ * compile time, element copies compile to plain loads and stores instead of
+ * variable-length `memcpy` calls, and the common paths inline into callers.
+ *
+ * A typed list wraps an ordinary `list` as its first member, so it uses the
+ * same growth rules, shrink policy and `list_status` codes, and it can be
+ * passed to any untyped `list_` function through `list_base`. Errors are
+ * reported by the checked `list_` calls, so `LIST_ENABLE_STATS` counts them.
+ * Those calls are written with parenthesized names, e.g. `(list_get)(...)`,
+ * so they stay checked when `LIST_FAST` is defined.
+ *
+ * ### Example Usage
+ * @code
+ * LIST_DEFINE(int32_t, i32list)
+ *
+ * i32list ids;
+ * i32list_init(&ids);
+ * i32list_push(&ids, 42);
+ *
+ * int32_t first;
+ * if (i32list_get(&ids, 0, &first) == LIST_OK) {
+ *     printf("First: %d\n", first);
+ * }
+ *
+ * list_shrink_to_fit(list_base(&ids));  // Untyped API on a typed list
+ * i32list_destroy(&ids);
+ * @endcode
+ */
+
+/**
+ * @brief Stand-in typed list that keeps `list_base` well-formed for plain `list` pointers.
+ * @internal
+ */
+typedef struct list_typed_any_ {
+    list base;
+} list_typed_any_;
+
+/**
+ * @brief Converts a typed list pointer (or a `list` pointer) to a `list` pointer.
+ *
+ * Typed lists store their `list` as the `base` member, so the conversion is
+ * free and keeps constness. Plain `list` pointers are passed through
+ * unchanged; any other pointer is a compile error.
+ */
+#define list_base(l) _Generic((l),                                                   \
+    list*: (l),                                                                      \
+    const list*: (l),                                                                \
+    default: &_Generic((l),                                                          \
+        list*: (list_typed_any_*) nullptr,                                           \
+        const list*: (list_typed_any_*) nullptr,                                     \
+        default: (l))->base)
+
+/**
+ * @brief Defines a list type `name` specialized for elements of type `T`.
+ *
+ * @param T The element type.
+ * @param name The name of the generated list type and prefix of its functions.
+ */
+#define LIST_DEFINE(T, name)                                                                \
+    typedef struct name {                                                                   \
+        list base;                                                                          \
+    } name;                                                                                 \
+                                                                                            \
+    static inline list_status name##_init(name* l) {                                        \
+        return list_init(&l->base, sizeof(T));                                              \
+    }                                                                                       \
+                                                                                            \
+    static inline list_status name##_init_with_capacity(                                    \
+        name* l, const size_t capacity) {                                                   \
+        return list_init_with_capacity(&l->base, capacity, sizeof(T));                      \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_destroy(name* l) {                                            \
+        list_destroy(&l->base);                                                             \
+    }                                                                                       \
+                                                                                            \
+    static inline size_t name##_size(const name* l) {                                       \
+        return l != nullptr ? l->base.size : 0;                                             \
+    }                                                                                       \
+                                                                                            \
+    static inline T* name##_data(const name* l) {                                           \
+        return l != nullptr ? (T*) l->base.data : nullptr;                                  \
+    }                                                                                       \
+                                                                                            \
+    static inline list_status name##_push(name* l, const T value) {                         \
+        if (l == nullptr) return (list_push)(nullptr, &value);                              \
+        /* A buffer shared with a snapshot is detached by list_push */                      \
+        if (l->base.size < l->base.capacity && !list_is_shared(&l->base)) {                 \
+            ((T*) l->base.data)[l->base.size++] = value;                                    \
+            return LIST_OK;                                                                 \
+        }                                                                                   \
+        return (list_push)(&l->base, &value);                                               \
+    }                                                                                       \
+                                                                                            \
+    static inline list_status name##_get(                                                   \
+        const name* l, const size_t index, T* out_value) {                                  \
+        if (l == nullptr) return (list_get)(nullptr, index, out_value);                     \
+        if (l->base.data == nullptr || out_value == nullptr || index >= l->base.size) {     \
+            return (list_get)(&l->base, index, out_value);                                  \
+        }                                                                                   \
+        *out_value = ((const T*) l->base.data)[index];                                      \
+        return LIST_OK;                                                                     \
+    }                                                                                       \
+                                                                                            \
+    static inline list_status name##_set(                                                   \
+        name* l, const size_t index, const T value) {                                       \
+        if (l == nullptr) return (list_set)(nullptr, index, &value);                        \
+        /* Errors and shared buffers are handled by list_set */                             \
+        if (l->base.data == nullptr || index >= l->base.size || list_is_shared(&l->base)) { \
+            return (list_set)(&l->base, index, &value);                                     \
+        }                                                                                   \
+        ((T*) l->base.data)[index] = value;                                                 \
+        return LIST_OK;                                                                     \
+    }                                                                                       \
+                                                                                            \
+    static inline list_status name##_peek(const name* l, T* out_value) {                    \
+        if (l == nullptr) return (list_get)(nullptr, 0, out_value);                         \
+        if (l->base.size == 0) return list_peek(&l->base, out_value);                       \
+        return name##_get(l, l->base.size - 1, out_value);                                  \
+    }                                                                                       \
+                                                                                            \
+    static inline list_status name##_pop(name* l, T* out_value) {                           \
+        if (l == nullptr || l->base.data == nullptr || l->base.size == 0) {                 \
+            return (list_pop)(l != nullptr ? &l->base : nullptr, out_value);                \
+        }                                                                                   \
+        /* Pops that cannot trigger a shrink stay inline; others defer to list_pop */       \
+        if (l->base.shrink_policy == LIST_SHRINK_NEVER || l->base.capacity <= 1 ||          \
+            l->base.size - 1 >= l->base.capacity / 4) {                                     \
+            l->base.size--;                                                                 \
+            if (out_value != nullptr) {                                                     \
+                *out_value = ((const T*) l->base.data)[l->base.size];                       \
+            }                                                                               \
+            return LIST_OK;                                                                 \
+        }                                                                                   \
+        return (list_pop)(&l->base, out_value);                                             \
+    }
+
+/**
+ * @brief Generates a `_Generic` association for one registered typed list.
+ * @internal
+ */
+#define LIST_TYPED_ASSOC_(name, op) name*: name##_##op,
+
+/**
+ * @brief Selects the `op` function of the typed list pointed to by `l`.
+ * @internal
+ *
+ * Requires the user to define `LIST_TYPED_REGISTRY(X, op)` so that it expands
+ * `X(name, op)` once for each list type created with `LIST_DEFINE`, e.g.
+ * `#define LIST_TYPED_REGISTRY(X, op) X(i32list, op) X(f64list, op)`.
+ */
+#define LIST_TYPED_DISPATCH_(l, op) _Generic((l), LIST_TYPED_REGISTRY(LIST_TYPED_ASSOC_, op) default: nullptr)
+
+/**
+ * @brief Type-generic front end for registered typed lists.
+ *
+ * These macros pick the matching `name_push`, `name_get`, `name_set` or
+ * `name_pop` for the list passed in, so code can be written once for any
+ * registered element type. See `LIST_TYPED_DISPATCH_` for registration.
+ */
+#define list_tpush(l, value)          LIST_TYPED_DISPATCH_(l, push)((l), (value))
+#define list_tget(l, index, out_value) LIST_TYPED_DISPATCH_(l, get)((l), (index), (out_value))
+#define list_tset(l, index, value)    LIST_TYPED_DISPATCH_(l, set)((l), (index), (value))
+#define list_tpop(l, out_value)       LIST_TYPED_DISPATCH_(l, pop)((l), (out_value))
+
+#endif //LIST_TYPED_H
@@ -1,6 +1,11 @@
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 #include "list.h"
+#include "list_internal.h"
 
 /**
  * @defgroup list_internal Internal List Functions
@@ -28,14 +33,161 @@ static list_status list_resize(list* lst, size_t new_capacity);
  * @brief Grows the capacity of the list when it reaches its current limit.
  * @internal
  *
- * This function doubles the capacity of the list to accommodate additional
- * elements when needed. It is typically called internally by `list_push`.
+ * This function multiplies the capacity of the list by its growth factor
+ * (2.0 by default) to accommodate additional elements when needed. It is
+ * typically called internally by `list_push`.
  *
  * @param lst Pointer to the list.
  * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if memory allocation fails.
  */
 static list_status list_grow(list* lst);
 
+/**
+ * @ingroup list_internal
+ * @brief Computes the capacity the growth policy picks for at least `required` elements.
+ * @internal
+ *
+ * @param lst Pointer to the list.
+ * @param required The minimum number of elements the list must be able to hold.
+ * @return The new capacity, never less than `required`.
+ */
+static size_t list_next_capacity(const list* lst, size_t required);
+
+/**
+ * @ingroup list_internal
+ * @brief Extends the capacity to the full usable size of the allocated block.
+ * @internal
+ *
+ * Applies `LIST_ROUND_USABLE_SIZE`; a no-op where the usable size is unknown.
+ *
+ * @param lst Pointer to the list.
+ */
+static void list_use_usable_size(list* lst);
+
+/**
+ * @ingroup list_internal
+ * @brief Shrinks the buffer after a pop according to the list's shrink policy.
+ * @internal
+ *
+ * @param lst Pointer to the list.
+ * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if memory allocation fails.
+ */
+static list_status list_maybe_shrink(list* lst);
+
+/**
+ * @ingroup list_internal
+ * @brief Allocates `size` bytes through the list's allocator.
+ * @internal
+ *
+ * @param lst Pointer to the list.
+ * @param size Number of bytes to allocate.
+ * @return Pointer to the new block, or `NULL` on failure.
+ */
+static void* list_mem_alloc(const list* lst, size_t size);
+
+/**
+ * @ingroup list_internal
+ * @brief Resizes a block previously obtained from the list's allocator.
+ * @internal
+ *
+ * A `NULL` block is treated as a fresh allocation.
+ *
+ * @param lst Pointer to the list.
+ * @param ptr The block to resize, or `NULL`.
+ * @param old_size The current size of the block in bytes.
+ * @param new_size The requested size of the block in bytes.
+ * @return Pointer to the resized block, or `NULL` on failure.
+ */
+static void* list_mem_realloc(const list* lst, void* ptr, size_t old_size, size_t new_size);
+
+/**
+ * @ingroup list_internal
+ * @brief Releases a block previously obtained from the list's allocator.
+ * @internal
+ *
+ * @param lst Pointer to the list.
+ * @param ptr The block to release, or `NULL`.
+ * @param size The size of the block in bytes.
+ */
+static void list_mem_free(const list* lst, void* ptr, size_t size);
+
+/**
+ * @ingroup list_internal
+ * @brief Checks whether a buffer of `size` bytes is kept in the list's inline storage.
+ * @internal
+ *
+ * Only lists with the standard allocator use inline storage.
+ *
+ * @param lst Pointer to the list.
+ * @param size The size of the buffer in bytes.
+ * @return `true` if the buffer belongs in `inline_data`.
+ */
+static bool list_fits_inline(const list* lst, size_t size);
+
+/**
+ * @ingroup list_internal
+ * @brief Checks whether `ptr` is the list's inline storage.
+ * @internal
+ *
+ * @param lst Pointer to the list.
+ * @param ptr The buffer to check, or `NULL`.
+ * @return `true` if `ptr` points at `inline_data`.
+ */
+static bool list_is_inline(const list* lst, const void* ptr);
+
+/**
+ * @ingroup list_internal
+ * @brief Gets the list's inline storage.
+ * @internal
+ *
+ * @param lst Pointer to the list.
+ * @return Pointer to `inline_data`, or `NULL` when inline storage is disabled.
+ */
+static void* list_inline_buffer(const list* lst);
+
+/**
+ * @ingroup list_internal
+ * @brief Shared implementation of the `list_init` family.
+ * @internal
+ *
+ * @param lst Pointer to the list to initialize.
+ * @param capacity Initial number of elements the list can hold.
+ * @param elem_size Size of each element in bytes.
+ * @param allocator Allocator for the list's buffer, or `NULL` for the standard one.
+ * @param flags Bitwise OR of `list_flags` values.
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on invalid arguments,
+ *         `LIST_ERR_ALLOC` on allocation failure.
+ */
+static list_status list_init_internal(
+    list* lst, size_t capacity, size_t elem_size, const list_allocator* allocator, unsigned flags);
+
+/**
+ * @ingroup list_internal
+ * @brief Checks that every index is below `size`.
+ * @internal
+ *
+ * The common all-valid case is a branch-free maximum over the indices,
+ * which the compiler vectorizes; only when it fails is the array searched
+ * again for the first offender.
+ *
+ * @return `count` if every index is valid, else the position of the first invalid one.
+ */
+static size_t list_first_bad_index(const size_t* indices, size_t count, size_t size);
+
+/**
+ * @ingroup list_internal
+ * @brief Copies `data[indices[i]]` to `out[i]`, with a loop specialized for common element sizes.
+ * @internal
+ */
+static void list_gather_copy(const uint8_t* data, size_t elem_size, const size_t* indices, size_t count, uint8_t* out);
+
+/**
+ * @ingroup list_internal
+ * @brief Copies `values[i]` to `data[indices[i]]`, with a loop specialized for common element sizes.
+ * @internal
+ */
+static void list_scatter_copy(uint8_t* data, size_t elem_size, const size_t* indices, size_t count, const uint8_t* values);
+
 /** @} */ // end of list_internal
 
 list_status list_init(list* lst, const size_t elem_size) {
@@ -43,29 +195,137 @@ list_status list_init(list* lst, const size_t elem_size) {
 }
 
 list_status list_init_with_capacity(list* lst, const size_t capacity, const size_t elem_size) {
-    if (lst == nullptr || elem_size == 0) return LIST_ERR_INVALID;
+    return list_init_with_allocator(lst, capacity, elem_size, nullptr);
+}
+
+list_status list_init_with_allocator(
+    list* lst,
+    const size_t capacity,
+    const size_t elem_size,
+    const list_allocator* allocator)
+{
+    return list_init_internal(lst, capacity, elem_size, allocator, LIST_FLAG_NONE);
+}
+
+list_status list_init_with_flags(list* lst, const size_t capacity, const size_t elem_size, const unsigned flags) {
+    return list_init_internal(lst, capacity, elem_size, nullptr, flags);
+}
+
+void list_destroy(list* lst) {
+    if (lst == nullptr) return;
 
+    if (list_is_shared(lst)) list_shared_drop(lst);
+    list_mem_free(lst, lst->data, lst->capacity * lst->elem_size);
     lst->data = nullptr;
     lst->size = 0;
     lst->capacity = 0;
-    lst->elem_size = elem_size;
+}
 
-    if (capacity == 0) return LIST_OK;
+list_status list_move(list* dst, list* src) {
+    if (dst == nullptr || src == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+    if (dst == src) return LIST_OK;
 
-    lst->data = calloc(capacity, elem_size);
-    if (lst->data == nullptr) return LIST_ERR_ALLOC;
+    const bool was_inline = list_is_inline(src, src->data);
+
+    *dst = *src;
+    if (was_inline) dst->data = list_inline_buffer(dst);
+    if (list_is_mapped(dst)) {
+        // The mapping serves a single list, which is now dst
+        list_mapped_rebind(dst);
+        src->allocator = nullptr;
+    } else if (list_is_shared(dst)) {
+        // dst now holds src's reference to the shared block
+        list_shared_forget(src);
+    }
+
+    src->data = nullptr;
+    src->size = 0;
+    src->capacity = 0;
+#ifdef LIST_ENABLE_STATS
+    list_stats_reset(src);
+#endif
 
-    lst->capacity = capacity;
     return LIST_OK;
 }
 
-void list_destroy(list* lst) {
-    if (lst == nullptr) return;
+list_status list_swap(list* a, list* b) {
+    if (a == nullptr || b == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+    if (a == b) return LIST_OK;
+
+    const bool a_inline = list_is_inline(a, a->data);
+    const bool b_inline = list_is_inline(b, b->data);
+
+    const list tmp = *a;
+    *a = *b;
+    *b = tmp;
+
+    if (a_inline) b->data = list_inline_buffer(b);
+    if (b_inline) a->data = list_inline_buffer(a);
+    if (list_is_mapped(a)) list_mapped_rebind(a);
+    if (list_is_mapped(b)) list_mapped_rebind(b);
+
+    return LIST_OK;
+}
+
+void* list_release(list* lst, size_t* out_size, size_t* out_capacity) {
+    if (lst == nullptr || list_is_mapped(lst)) {
+        list_fail(lst, LIST_ERR_INVALID);
+        return nullptr;
+    }
+    if (list_own(lst) != LIST_OK) return nullptr;
+
+    void* buf = lst->data;
+    size_t capacity = lst->capacity;
+
+    if (list_is_inline(lst, buf)) {
+        // The inline storage cannot leave the list, so hand out a heap copy
+        capacity = lst->size;
+        buf = nullptr;
+        if (capacity > 0) {
+            buf = malloc(capacity * lst->elem_size);
+            if (buf == nullptr) {
+                list_fail(lst, LIST_ERR_ALLOC);
+                return nullptr;
+            }
+            memcpy(buf, lst->data, capacity * lst->elem_size);
+        }
+    }
+
+    if (out_size != nullptr) *out_size = lst->size;
+    if (out_capacity != nullptr) *out_capacity = capacity;
 
-    free(lst->data);
     lst->data = nullptr;
     lst->size = 0;
     lst->capacity = 0;
+
+    return buf;
+}
+
+list_status list_adopt(list* lst, void* buf, const size_t size, const size_t capacity, const size_t elem_size) {
+    return list_adopt_with_allocator(lst, buf, size, capacity, elem_size, nullptr);
+}
+
+list_status list_adopt_with_allocator(
+    list* lst,
+    void* buf,
+    const size_t size,
+    const size_t capacity,
+    const size_t elem_size,
+    const list_allocator* allocator)
+{
+    if (lst == nullptr || size > capacity || (buf == nullptr) != (capacity == 0)) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+    if (elem_size != 0 && capacity > SIZE_MAX / elem_size) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    const list_status err = list_init_internal(lst, 0, elem_size, allocator, LIST_FLAG_NONE);
+    if (err != LIST_OK) return err;
+
+    lst->data = buf;
+    lst->size = size;
+    lst->capacity = capacity;
+
+    return LIST_OK;
 }
 
 size_t list_size(const list* lst) {
@@ -77,7 +337,8 @@ size_t list_capacity(const list* lst) {
 }
 
 list_status list_push(list* lst, const void* value) {
-    if (lst == nullptr || value == nullptr) return LIST_ERR_INVALID;
+    if (lst == nullptr || value == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
 
     if (lst->size >= lst->capacity) {
         const list_status err = list_grow(lst);
@@ -91,8 +352,63 @@ list_status list_push(list* lst, const void* value) {
     return LIST_OK;
 }
 
+list_status list_push_n(list* lst, const void* values, const size_t count) {
+    if (lst == nullptr || (values == nullptr && count > 0)) return list_fail(lst, LIST_ERR_INVALID);
+
+    if (count == 0) return LIST_OK;
+    if (count > SIZE_MAX - lst->size) return list_fail(lst, LIST_ERR_ALLOC);
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    const list_status err = list_ensure_capacity(lst, lst->size + count);
+    if (err != LIST_OK) return err;
+
+    void* dest = (uint8_t*) lst->data + lst->size * lst->elem_size;
+    memcpy(dest, values, count * lst->elem_size);
+    lst->size += count;
+
+    return LIST_OK;
+}
+
+list_status list_extend(list* dst, const list* src) {
+    if (dst == nullptr || src == nullptr || dst->elem_size != src->elem_size) {
+        return list_fail(dst, LIST_ERR_INVALID);
+    }
+
+    const size_t count = src->size;
+    if (count == 0) return LIST_OK;
+    if (count > SIZE_MAX - dst->size) return list_fail(dst, LIST_ERR_ALLOC);
+    if (list_own(dst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    const list_status err = list_ensure_capacity(dst, dst->size + count);
+    if (err != LIST_OK) return err;
+
+    // Read src->data only after resizing, since src may be dst itself
+    void* dest = (uint8_t*) dst->data + dst->size * dst->elem_size;
+    memcpy(dest, src->data, count * dst->elem_size);
+    dst->size += count;
+
+    return LIST_OK;
+}
+
+list_status list_fill(list* lst, const void* value, const size_t count) {
+    if (lst == nullptr || value == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    if (count == 0) return LIST_OK;
+    if (count > SIZE_MAX - lst->size) return list_fail(lst, LIST_ERR_ALLOC);
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    const list_status err = list_ensure_capacity(lst, lst->size + count);
+    if (err != LIST_OK) return err;
+
+    list_simd_fill((uint8_t*) lst->data + lst->size * lst->elem_size, count, lst->elem_size, value);
+    lst->size += count;
+
+    return LIST_OK;
+}
+
 list_status list_pop(list* lst, void* out_value) {
-    if (lst->data == nullptr || lst->size == 0) return LIST_ERR_INVALID;
+    if (lst == nullptr || lst->data == nullptr || lst->size == 0) return list_fail(lst, LIST_ERR_INVALID);
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
 
     lst->size--;
 
@@ -101,30 +417,243 @@ list_status list_pop(list* lst, void* out_value) {
         memcpy(out_value, src, lst->elem_size);
     }
 
-    // Shrink if we're using significantly less than the capacity
-    if (lst->capacity > 1 && lst->size < lst->capacity / 4) {
-        size_t new_capacity = lst->capacity / 2;
+    return list_maybe_shrink(lst);
+}
 
-        // Don't allow a new capacity less than 1
-        if (new_capacity < 1) new_capacity = 1;
+list_status list_insert_at(list* lst, const size_t index, const void* value) {
+    if (value == nullptr) return list_fail(lst, LIST_ERR_INVALID);
 
-        const list_status err = list_resize(lst, new_capacity);
-        if (err != LIST_OK) return err;
+    return list_insert_range(lst, index, value, 1);
+}
+
+list_status list_insert_range(list* lst, const size_t index, const void* values, const size_t count) {
+    if (lst == nullptr || (values == nullptr && count > 0)) return list_fail(lst, LIST_ERR_INVALID);
+
+    if (index > lst->size) return list_fail(lst, LIST_OUT_OF_BOUNDS);
+    if (count == 0) return LIST_OK;
+    if (count > SIZE_MAX - lst->size) return list_fail(lst, LIST_ERR_ALLOC);
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    const list_status err = list_ensure_capacity(lst, lst->size + count);
+    if (err != LIST_OK) return err;
+
+    uint8_t* dest = (uint8_t*) lst->data + index * lst->elem_size;
+    memmove(dest + count * lst->elem_size, dest, (lst->size - index) * lst->elem_size);
+    memcpy(dest, values, count * lst->elem_size);
+    lst->size += count;
+
+    return LIST_OK;
+}
+
+list_status list_erase_at(list* lst, const size_t index, void* out_value) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    if (index >= lst->size) return list_fail(lst, LIST_OUT_OF_BOUNDS);
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    if (out_value != nullptr) {
+        memcpy(out_value, (const uint8_t*) lst->data + index * lst->elem_size, lst->elem_size);
     }
 
+    return list_erase_range(lst, index, 1);
+}
+
+list_status list_erase_range(list* lst, const size_t first, const size_t count) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    if (first > lst->size || count > lst->size - first) return list_fail(lst, LIST_OUT_OF_BOUNDS);
+    if (count == 0) return LIST_OK;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    uint8_t* dest = (uint8_t*) lst->data + first * lst->elem_size;
+    memmove(dest, dest + count * lst->elem_size, (lst->size - first - count) * lst->elem_size);
+    lst->size -= count;
+
+    return list_maybe_shrink(lst);
+}
+
+list_status list_swap_remove(list* lst, const size_t index, void* out_value) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    if (index >= lst->size) return list_fail(lst, LIST_OUT_OF_BOUNDS);
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    uint8_t* slot = (uint8_t*) lst->data + index * lst->elem_size;
+    if (out_value != nullptr) memcpy(out_value, slot, lst->elem_size);
+
+    lst->size--;
+    if (index != lst->size) memcpy(slot, (const uint8_t*) lst->data + lst->size * lst->elem_size, lst->elem_size);
+
+    return list_maybe_shrink(lst);
+}
+
+list_status list_erase_if(
+    list* lst,
+    bool (*pred)(const void* elem, void* ctx),
+    void* ctx,
+    size_t* out_removed)
+{
+    if (out_removed != nullptr) *out_removed = 0;
+    if (lst == nullptr || pred == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    const size_t elem_size = lst->elem_size;
+
+    // Nothing is written until the first match, so a shared buffer is only copied if needed
+    size_t first = 0;
+    while (first < lst->size && !pred((const uint8_t*) lst->data + first * elem_size, ctx)) first++;
+    if (first == lst->size) return LIST_OK;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    uint8_t* data = lst->data;
+    size_t kept = first;     // Elements compacted so far
+    size_t run = first + 1;  // Start of the pending run of kept elements
+
+    for (size_t i = run; i < lst->size; i++) {
+        if (!pred(data + i * elem_size, ctx)) continue;
+
+        // Move the run of kept elements before this one down in one go
+        if (i > run) {
+            memmove(data + kept * elem_size, data + run * elem_size, (i - run) * elem_size);
+            kept += i - run;
+        }
+        run = i + 1;
+    }
+
+    if (lst->size > run) {
+        memmove(data + kept * elem_size, data + run * elem_size, (lst->size - run) * elem_size);
+        kept += lst->size - run;
+    }
+
+    if (out_removed != nullptr) *out_removed = lst->size - kept;
+    lst->size = kept;
+
+    return list_maybe_shrink(lst);
+}
+
+list_status list_set_shrink_policy(list* lst, const list_shrink_policy policy, const size_t min_capacity) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    switch (policy) {
+        case LIST_SHRINK_QUARTER:
+        case LIST_SHRINK_NEVER:
+        case LIST_SHRINK_RETAIN_MIN:
+            break;
+        default:
+            return list_fail(lst, LIST_ERR_INVALID);
+    }
+
+    lst->shrink_policy = policy;
+    lst->min_capacity = min_capacity;
+    return LIST_OK;
+}
+
+list_status list_set_flags(list* lst, const unsigned flags) {
+    if (lst == nullptr || (flags & ~LIST_FLAG_ZERO_FILL) != 0) return list_fail(lst, LIST_ERR_INVALID);
+
+    // Newly requested zero-fill also covers capacity reserved before now
+    if ((flags & LIST_FLAG_ZERO_FILL) != 0 && (lst->flags & LIST_FLAG_ZERO_FILL) == 0 && lst->data != nullptr) {
+        if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+        const size_t slack = (lst->capacity - lst->size) * lst->elem_size;
+        memset((uint8_t*) lst->data + lst->size * lst->elem_size, 0, slack);
+        LIST_STATS_ZERO(lst, slack);
+    }
+
+    lst->flags = flags;
+    return LIST_OK;
+}
+
+list_status list_set_growth_policy(list* lst, const double growth_factor, const list_capacity_rounding rounding) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+    if (!(growth_factor > 1.0 && growth_factor <= 16.0)) return list_fail(lst, LIST_ERR_INVALID);
+
+    switch (rounding) {
+        case LIST_ROUND_NONE:
+        case LIST_ROUND_USABLE_SIZE:
+        case LIST_ROUND_PAGE:
+            break;
+        default:
+            return list_fail(lst, LIST_ERR_INVALID);
+    }
+
+    lst->growth_factor = growth_factor;
+    lst->rounding = rounding;
+    return LIST_OK;
+}
+
+list_status list_shrink_to_fit(list* lst) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    // A mapped list keeps its file open, down to the first page of elements
+    if (list_is_mapped(lst)) {
+        const size_t min_capacity = list_mapped_min_capacity(lst->elem_size);
+        return list_resize(lst, lst->size > min_capacity ? lst->size : min_capacity);
+    }
+
+    if (lst->size == 0) {
+        // Nothing to keep, so a shared buffer is let go rather than copied
+        if (list_is_shared(lst)) list_shared_drop(lst);
+        if (lst->data != nullptr) LIST_STATS_RESIZE(lst, lst->capacity * lst->elem_size, 0, false);
+
+        list_mem_free(lst, lst->data, lst->capacity * lst->elem_size);
+        lst->data = nullptr;
+        lst->capacity = 0;
+        return LIST_OK;
+    }
+
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+    return list_resize(lst, lst->size);
+}
+
+list_status list_reserve(list* lst, const size_t capacity) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+    if (capacity <= lst->capacity) return LIST_OK;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    return list_ensure_capacity(lst, capacity);
+}
+
+list_status list_resize_to(list* lst, const size_t size, const void* fill) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+    if (size == lst->size) return LIST_OK;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    if (size < lst->size) {
+        lst->size = size;
+        return list_maybe_shrink(lst);
+    }
+
+    const list_status err = list_ensure_capacity(lst, size);
+    if (err != LIST_OK) return err;
+
+    uint8_t* dest = (uint8_t*) lst->data + lst->size * lst->elem_size;
+    if (fill != nullptr) {
+        list_simd_fill(dest, size - lst->size, lst->elem_size, fill);
+    } else {
+        memset(dest, 0, (size - lst->size) * lst->elem_size);
+    }
+    lst->size = size;
+
     return LIST_OK;
 }
 
+void list_clear_and_release(list* lst) {
+    if (lst == nullptr) return;
+
+    lst->size = 0;
+    list_shrink_to_fit(lst);
+}
+
 list_status list_peek(const list* lst, void* out_value) {
-    if (lst->data == nullptr || lst->size == 0 || out_value == nullptr) return LIST_ERR_INVALID;
+    if (lst->data == nullptr || lst->size == 0 || out_value == nullptr) return list_fail(lst, LIST_ERR_INVALID);
 
     return list_get(lst, lst->size - 1, out_value);
 }
 
 list_status list_get(const list* lst, const size_t index, void* out_value) {
-    if (lst == nullptr || lst->data == nullptr || out_value == nullptr) return LIST_ERR_INVALID;
+    if (lst == nullptr || lst->data == nullptr || out_value == nullptr) return list_fail(lst, LIST_ERR_INVALID);
 
-    if (index >= lst->size) return LIST_OUT_OF_BOUNDS;
+    if (index >= lst->size) return list_fail(lst, LIST_OUT_OF_BOUNDS);
 
     const void* src = (const uint8_t*) lst->data + index * lst->elem_size;
     memcpy(out_value, src, lst->elem_size);
@@ -132,10 +661,12 @@ list_status list_get(const list* lst, const size_t index, void* out_value) {
     return LIST_OK;
 }
 
-list_status list_set(const list* lst, const size_t index, const void* value) {
-    if (lst == nullptr || lst->data == nullptr) return LIST_ERR_INVALID;
+list_status list_set(list* lst, const size_t index, const void* value) {
+    if (lst == nullptr || lst->data == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    if (index >= lst->size) return list_fail(lst, LIST_OUT_OF_BOUNDS);
 
-    if (index >= lst->size) return LIST_OUT_OF_BOUNDS;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
 
     void* dest = (uint8_t*) lst->data + index * lst->elem_size;
     memcpy(dest, value, lst->elem_size);
@@ -143,34 +674,129 @@ list_status list_set(const list* lst, const size_t index, const void* value) {
     return LIST_OK;
 }
 
+void* list_at(const list* lst, const size_t index) {
+    if (lst == nullptr || lst->data == nullptr || index >= lst->size) return nullptr;
+
+    return (uint8_t*) lst->data + index * lst->elem_size;
+}
+
+list_status list_gather(
+    const list* lst,
+    const size_t* indices,
+    const size_t count,
+    void* out,
+    size_t* out_bad_index)
+{
+    if (lst == nullptr || (count > 0 && (indices == nullptr || out == nullptr))) return list_fail(lst, LIST_ERR_INVALID);
+
+    const size_t bad = list_first_bad_index(indices, count, lst->size);
+    if (bad != count) {
+        if (out_bad_index != nullptr) *out_bad_index = bad;
+        return list_fail(lst, LIST_OUT_OF_BOUNDS);
+    }
+
+    if (count > 0) list_gather_copy(lst->data, lst->elem_size, indices, count, out);
+    return LIST_OK;
+}
+
+list_status list_scatter(
+    list* lst,
+    const size_t* indices,
+    const size_t count,
+    const void* values,
+    size_t* out_bad_index)
+{
+    if (lst == nullptr || (count > 0 && (indices == nullptr || values == nullptr))) return list_fail(lst, LIST_ERR_INVALID);
+
+    const size_t bad = list_first_bad_index(indices, count, lst->size);
+    if (bad != count) {
+        if (out_bad_index != nullptr) *out_bad_index = bad;
+        return list_fail(lst, LIST_OUT_OF_BOUNDS);
+    }
+
+    if (count == 0) return LIST_OK;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    list_scatter_copy(lst->data, lst->elem_size, indices, count, values);
+    return LIST_OK;
+}
+
+void* list_emplace_back(list* lst) {
+    if (lst == nullptr || list_own(lst) != LIST_OK) return nullptr;
+
+    if (lst->size >= lst->capacity) {
+        if (list_grow(lst) != LIST_OK) return nullptr;
+    }
+
+    void* slot = (uint8_t*) lst->data + lst->size * lst->elem_size;
+    lst->size++;
+
+    return slot;
+}
+
 void list_clear(list* lst) {
     if (lst == nullptr) return;
 
     lst->size = 0;
 }
 
+size_t list_find(const list* lst, const void* value) {
+    if (lst == nullptr || lst->data == nullptr || value == nullptr) return LIST_NOT_FOUND;
+
+    return list_simd_find(lst->data, lst->size, lst->elem_size, value);
+}
+
+size_t list_count(const list* lst, const void* value) {
+    if (lst == nullptr || lst->data == nullptr || value == nullptr) return 0;
+
+    return list_simd_count(lst->data, lst->size, lst->elem_size, value);
+}
+
+bool list_contains(const list* lst, const void* value) {
+    return list_find(lst, value) != LIST_NOT_FOUND;
+}
+
+bool list_equal(const list* a, const list* b) {
+    if (a == nullptr || b == nullptr) return false;
+    if (a->elem_size != b->elem_size || a->size != b->size) return false;
+    if (a->size == 0 || a->data == b->data) return true;
+
+    // libc's memcmp is already vectorized for every element size
+    return memcmp(a->data, b->data, a->size * a->elem_size) == 0;
+}
+
 const char* list_error_to_string(const list_status err) {
     switch (err) {
         case LIST_OK:            return "No error";
         case LIST_ERR_ALLOC:     return "Error allocating memory";
         case LIST_ERR_INVALID:   return "Invalid input";
         case LIST_OUT_OF_BOUNDS: return "Out of bounds access attempted";
+        case LIST_ERR_IO:        return "Error accessing file";
         default:                 return "Unknown error";
     }
 }
 
 static list_status list_resize(list* lst, const size_t new_capacity) {
-    if (lst == nullptr || new_capacity == 0) return LIST_ERR_INVALID;
+    if (lst == nullptr || new_capacity == 0) return list_fail(lst, LIST_ERR_INVALID);
 
     if (new_capacity == lst->capacity) return LIST_OK;  // No change needed
+    if (new_capacity > SIZE_MAX / lst->elem_size) return list_fail(lst, LIST_ERR_ALLOC);
+
+    void* new_data = list_mem_realloc(
+        lst, lst->data, lst->capacity * lst->elem_size, new_capacity * lst->elem_size);
+    if (new_data == nullptr) return list_fail(lst, LIST_ERR_ALLOC);
 
-    void* new_data = realloc(lst->data, new_capacity * lst->elem_size);
-    if (new_data == nullptr) return LIST_ERR_ALLOC;
+    LIST_STATS_RESIZE(
+        lst,
+        lst->capacity * lst->elem_size,
+        new_capacity * lst->elem_size,
+        lst->data != nullptr && new_data != lst->data);
 
-    // Zero out new section
-    if (new_capacity > lst->capacity) {
+    // Zero out new section only when the caller relies on it
+    if ((lst->flags & LIST_FLAG_ZERO_FILL) != 0 && new_capacity > lst->capacity) {
         const size_t diff = new_capacity - lst->capacity;
         memset((uint8_t*) new_data + lst->capacity * lst->elem_size, 0, diff * lst->elem_size);
+        LIST_STATS_ZERO(lst, diff * lst->elem_size);
     }
 
     lst->data = new_data;
@@ -185,6 +811,245 @@ static list_status list_resize(list* lst, const size_t new_capacity) {
 }
 
 static list_status list_grow(list* lst) {
-    const size_t new_capacity = lst->capacity == 0 ? 1 : lst->capacity * 2;
+    if (lst->capacity == SIZE_MAX) return list_fail(lst, LIST_ERR_ALLOC);
+    return list_ensure_capacity(lst, lst->capacity + 1);
+}
+
+list_status list_ensure_capacity(list* lst, const size_t required) {
+    if (required <= lst->capacity) return LIST_OK;
+
+    const list_status err = list_resize(lst, list_next_capacity(lst, required));
+    if (err != LIST_OK) return err;
+
+    if (lst->rounding == LIST_ROUND_USABLE_SIZE) list_use_usable_size(lst);
+    return LIST_OK;
+}
+
+static size_t list_next_capacity(const list* lst, const size_t required) {
+    size_t new_capacity = 1;
+    if (lst->capacity > 0) {
+        const double grown = (double) lst->capacity * lst->growth_factor;
+        new_capacity = grown >= (double) SIZE_MAX ? SIZE_MAX : (size_t) grown;
+        if (new_capacity <= lst->capacity) new_capacity = lst->capacity + 1;
+    }
+    if (new_capacity < required) new_capacity = required;
+
+    if (lst->rounding == LIST_ROUND_PAGE && new_capacity <= SIZE_MAX / lst->elem_size) {
+        const size_t bytes = new_capacity * lst->elem_size;
+        if (bytes >= LIST_PAGE_ROUND_THRESHOLD && bytes <= SIZE_MAX - (LIST_PAGE_SIZE - 1)) {
+            const size_t rounded = (bytes + LIST_PAGE_SIZE - 1) / LIST_PAGE_SIZE * LIST_PAGE_SIZE;
+            new_capacity = rounded / lst->elem_size;
+        }
+    }
+
+    return new_capacity;
+}
+
+static void list_use_usable_size(list* lst) {
+    if (lst->allocator != nullptr || lst->data == nullptr) return;
+
+    size_t usable_bytes = LIST_INLINE_BYTES;
+    if (!list_is_inline(lst, lst->data)) {
+#if defined(__GLIBC__)
+        usable_bytes = malloc_usable_size(lst->data);
+#else
+        return;
+#endif
+    }
+
+    const size_t usable = usable_bytes / lst->elem_size;
+    if (usable <= lst->capacity) return;
+
+    if ((lst->flags & LIST_FLAG_ZERO_FILL) != 0) {
+        const size_t extra = (usable - lst->capacity) * lst->elem_size;
+        memset((uint8_t*) lst->data + lst->capacity * lst->elem_size, 0, extra);
+        LIST_STATS_ZERO(lst, extra);
+    }
+    lst->capacity = usable;
+}
+
+static list_status list_maybe_shrink(list* lst) {
+    if (lst->shrink_policy == LIST_SHRINK_NEVER) return LIST_OK;
+
+    // Shrink if we're using significantly less than the capacity
+    if (lst->capacity <= 1 || lst->size >= lst->capacity / 4) return LIST_OK;
+
+    size_t new_capacity = lst->capacity / 2;
+
+    // Don't allow a new capacity less than 1
+    if (new_capacity < 1) new_capacity = 1;
+
+    if (lst->shrink_policy == LIST_SHRINK_RETAIN_MIN && new_capacity < lst->min_capacity) {
+        if (lst->capacity <= lst->min_capacity) return LIST_OK;
+        new_capacity = lst->min_capacity;
+    }
+
     return list_resize(lst, new_capacity);
 }
+
+static void* list_mem_alloc(const list* lst, const size_t size) {
+    if (list_fits_inline(lst, size)) return list_inline_buffer(lst);
+    if (lst->allocator == nullptr) return malloc(size);
+    return lst->allocator->alloc(lst->allocator->ctx, size);
+}
+
+static void* list_mem_realloc(const list* lst, void* ptr, const size_t old_size, const size_t new_size) {
+    if (list_fits_inline(lst, new_size)) {
+        void* inline_buffer = list_inline_buffer(lst);
+        if (ptr != nullptr && ptr != inline_buffer) {
+            memcpy(inline_buffer, ptr, old_size < new_size ? old_size : new_size);
+            free(ptr);
+        }
+        return inline_buffer;
+    }
+    if (list_is_inline(lst, ptr)) {
+        void* heap = malloc(new_size);
+        if (heap != nullptr) memcpy(heap, ptr, old_size);
+        return heap;
+    }
+    if (lst->allocator == nullptr) return realloc(ptr, new_size);
+    if (ptr == nullptr) return lst->allocator->alloc(lst->allocator->ctx, new_size);
+    return lst->allocator->realloc(lst->allocator->ctx, ptr, old_size, new_size);
+}
+
+static void list_mem_free(const list* lst, void* ptr, const size_t size) {
+    if (ptr == nullptr || list_is_inline(lst, ptr)) return;
+    if (lst->allocator == nullptr) {
+        free(ptr);
+        return;
+    }
+    lst->allocator->free(lst->allocator->ctx, ptr, size);
+}
+
+static list_status list_init_internal(
+    list* lst,
+    const size_t capacity,
+    const size_t elem_size,
+    const list_allocator* allocator,
+    const unsigned flags)
+{
+    // The list is not initialized yet, so argument errors are only counted globally
+    if (lst == nullptr || elem_size == 0) return list_fail(nullptr, LIST_ERR_INVALID);
+    if ((flags & ~LIST_FLAG_ZERO_FILL) != 0) return list_fail(nullptr, LIST_ERR_INVALID);
+    if (allocator != nullptr &&
+        (allocator->alloc == nullptr || allocator->realloc == nullptr || allocator->free == nullptr)) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    lst->data = nullptr;
+    lst->size = 0;
+    lst->capacity = 0;
+    lst->elem_size = elem_size;
+    lst->shrink_policy = LIST_SHRINK_QUARTER;
+    lst->min_capacity = 0;
+    lst->allocator = allocator;
+    lst->flags = flags;
+    lst->growth_factor = 2.0;
+    lst->rounding = LIST_ROUND_NONE;
+#ifdef LIST_ENABLE_STATS
+    list_stats_reset(lst);
+#endif
+
+    if (capacity == 0) return LIST_OK;
+    if (capacity > SIZE_MAX / elem_size) return list_fail(lst, LIST_ERR_ALLOC);
+
+    if ((flags & LIST_FLAG_ZERO_FILL) == 0) {
+        lst->data = list_mem_alloc(lst, capacity * elem_size);
+    } else if (allocator == nullptr && !list_fits_inline(lst, capacity * elem_size)) {
+        // calloc can hand out fresh pages without touching them
+        lst->data = calloc(capacity, elem_size);
+    } else {
+        lst->data = list_mem_alloc(lst, capacity * elem_size);
+        if (lst->data != nullptr) memset(lst->data, 0, capacity * elem_size);
+    }
+    if (lst->data == nullptr) return list_fail(lst, LIST_ERR_ALLOC);
+
+    if ((flags & LIST_FLAG_ZERO_FILL) != 0) LIST_STATS_ZERO(lst, capacity * elem_size);
+    LIST_STATS_RESIZE(lst, 0, capacity * elem_size, false);
+
+    lst->capacity = capacity;
+    return LIST_OK;
+}
+
+static bool list_fits_inline(const list* lst, const size_t size) {
+    return LIST_INLINE_BYTES > 0 && lst->allocator == nullptr && size <= LIST_INLINE_BYTES;
+}
+
+static bool list_is_inline(const list* lst, const void* ptr) {
+    return ptr != nullptr && ptr == list_inline_buffer(lst);
+}
+
+static void* list_inline_buffer([[maybe_unused]] const list* lst) {
+#if LIST_INLINE_BYTES > 0
+    // Like list_at, hands out a writable pointer into a list passed as const
+    return (void*) lst->inline_data;
+#else
+    return nullptr;
+#endif
+}
+
+static size_t list_first_bad_index(const size_t* indices, const size_t count, const size_t size) {
+    size_t max_index = 0;
+    for (size_t i = 0; i < count; i++) {
+        max_index = indices[i] > max_index ? indices[i] : max_index;
+    }
+    if (count == 0 || max_index < size) return count;
+
+    size_t i = 0;
+    while (indices[i] < size) i++;
+    return i;
+}
+
+// Each loop prefetches the element LIST_GATHER_PREFETCH_DISTANCE indices
+// ahead; the size-specialized copies compile to single loads and stores.
+#define LIST_GATHER_PREFETCH_DISTANCE 16
+
+#define LIST_GATHER_LOOP(size, data, indices, count, out) \
+    for (size_t i = 0; i < (count); i++) { \
+        if (i + LIST_GATHER_PREFETCH_DISTANCE < (count)) { \
+            LIST_PREFETCH((data) + (indices)[i + LIST_GATHER_PREFETCH_DISTANCE] * (size), 0); \
+        } \
+        memcpy((out) + i * (size), (data) + (indices)[i] * (size), (size)); \
+    }
+
+#define LIST_SCATTER_LOOP(size, data, indices, count, values) \
+    for (size_t i = 0; i < (count); i++) { \
+        if (i + LIST_GATHER_PREFETCH_DISTANCE < (count)) { \
+            LIST_PREFETCH((data) + (indices)[i + LIST_GATHER_PREFETCH_DISTANCE] * (size), 1); \
+        } \
+        memcpy((data) + (indices)[i] * (size), (values) + i * (size), (size)); \
+    }
+
+static void list_gather_copy(
+    const uint8_t* data,
+    const size_t elem_size,
+    const size_t* indices,
+    const size_t count,
+    uint8_t* out)
+{
+    switch (elem_size) {
+        case 1:  LIST_GATHER_LOOP(1, data, indices, count, out); break;
+        case 2:  LIST_GATHER_LOOP(2, data, indices, count, out); break;
+        case 4:  LIST_GATHER_LOOP(4, data, indices, count, out); break;
+        case 8:  LIST_GATHER_LOOP(8, data, indices, count, out); break;
+        case 16: LIST_GATHER_LOOP(16, data, indices, count, out); break;
+        default: LIST_GATHER_LOOP(elem_size, data, indices, count, out); break;
+    }
+}
+
+static void list_scatter_copy(
+    uint8_t* data,
+    const size_t elem_size,
+    const size_t* indices,
+    const size_t count,
+    const uint8_t* values)
+{
+    switch (elem_size) {
+        case 1:  LIST_SCATTER_LOOP(1, data, indices, count, values); break;
+        case 2:  LIST_SCATTER_LOOP(2, data, indices, count, values); break;
+        case 4:  LIST_SCATTER_LOOP(4, data, indices, count, values); break;
+        case 8:  LIST_SCATTER_LOOP(8, data, indices, count, values); break;
+        case 16: LIST_SCATTER_LOOP(16, data, indices, count, values); break;
+        default: LIST_SCATTER_LOOP(elem_size, data, indices, count, values); break;
+    }
+}
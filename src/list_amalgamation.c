@@ -0,0 +1,32 @@
+/**
+ * @file list_amalgamation.c
+ * @brief The whole library as a single translation unit, compiled by the `list_inline` target.
+ * @internal
+ *
+ * Building every source in one unit lets the compiler inline across the
+ * library's own modules without link-time optimization, and lets a
+ * consumer compile the library with its own flags. Calls from the consumer's
+ * other sources still go out of line unless LTO is enabled. Every internal helper is
+ * prefixed with its module's name, so the sources do not collide.
+ */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // list_mapped.c and list_pages.c need it before the first system header
+#endif
+#define LIST_BUILDING_LIBRARY
+
+#include "list.c"
+#include "list_arena.c"
+#include "list_concurrent.c"
+#include "list_deque.c"
+#include "list_mapped.c"
+#include "list_packed.c"
+#include "list_pages.c"
+#include "list_parallel.c"
+#include "list_segmented.c"
+#include "list_serialize.c"
+#include "list_simd.c"
+#include "list_snapshot.c"
+#include "list_soa.c"
+#include "list_sort.c"
+#include "list_spsc.c"
+#include "list_stats.c"
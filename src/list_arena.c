@@ -0,0 +1,275 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "list_arena.h"
+#include "list_internal.h"
+
+struct list_arena_block {
+    list_arena_block* next;
+    size_t            capacity;
+    size_t            used;
+    size_t            last;
+    alignas(max_align_t) uint8_t bytes[];
+};
+
+/**
+ * @defgroup list_arena_internal Internal Arena Functions
+ * @brief Helper functions used internally by the arena and pool allocators.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_arena_internal
+ * @brief Rounds a request up to the arena's allocation granularity.
+ * @internal
+ *
+ * @param size The requested size in bytes.
+ * @return The rounded size, or 0 if rounding would overflow.
+ */
+static size_t list_arena_round(size_t size);
+
+/**
+ * @ingroup list_arena_internal
+ * @brief Appends a new block of at least `size` bytes after the current block.
+ * @internal
+ *
+ * @param arena Pointer to the arena.
+ * @param size Minimum usable size of the block in bytes.
+ * @return Pointer to the new block, or `NULL` on failure.
+ */
+static list_arena_block* list_arena_add_block(list_arena* arena, size_t size);
+
+/**
+ * @ingroup list_arena_internal
+ * @brief Maps a request size to its pool size class.
+ * @internal
+ *
+ * @param size The requested size in bytes.
+ * @return The size class index, or `LIST_POOL_CLASS_COUNT` if the request is too large to pool.
+ */
+static size_t list_pool_class(size_t size);
+
+static void* list_arena_alloc_cb(void* ctx, size_t size);
+static void* list_arena_realloc_cb(void* ctx, void* ptr, size_t old_size, size_t new_size);
+static void  list_arena_free_cb(void* ctx, void* ptr, size_t size);
+static void* list_pool_alloc_cb(void* ctx, size_t size);
+static void* list_pool_realloc_cb(void* ctx, void* ptr, size_t old_size, size_t new_size);
+static void  list_pool_free_cb(void* ctx, void* ptr, size_t size);
+
+/** @} */ // end of list_arena_internal
+
+list_status list_arena_init(list_arena* arena, const size_t block_size) {
+    if (arena == nullptr || block_size == 0) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    arena->first = nullptr;
+    arena->current = nullptr;
+    arena->block_size = block_size;
+    arena->allocator = (list_allocator) {
+        .alloc   = list_arena_alloc_cb,
+        .realloc = list_arena_realloc_cb,
+        .free    = list_arena_free_cb,
+        .ctx     = arena,
+    };
+
+    return LIST_OK;
+}
+
+void list_arena_destroy(list_arena* arena) {
+    if (arena == nullptr) return;
+
+    list_arena_block* block = arena->first;
+    while (block != nullptr) {
+        list_arena_block* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    arena->first = nullptr;
+    arena->current = nullptr;
+}
+
+void list_arena_reset(list_arena* arena) {
+    if (arena == nullptr || arena->first == nullptr) return;
+
+    // Later blocks are rewound lazily as allocation reaches them
+    arena->current = arena->first;
+    arena->current->used = 0;
+    arena->current->last = 0;
+}
+
+void* list_arena_alloc(list_arena* arena, size_t size) {
+    if (arena == nullptr) return nullptr;
+
+    size = list_arena_round(size == 0 ? 1 : size);
+    if (size == 0) return nullptr;
+
+    list_arena_block* block = arena->current;
+    if (block == nullptr || block->capacity - block->used < size) {
+        list_arena_block* next = block != nullptr ? block->next : nullptr;
+
+        if (next != nullptr && next->capacity >= size) {
+            next->used = 0;
+            next->last = 0;
+            arena->current = next;
+            block = next;
+        } else {
+            block = list_arena_add_block(arena, size);
+            if (block == nullptr) return nullptr;
+        }
+    }
+
+    block->last = block->used;
+    block->used += size;
+    return block->bytes + block->last;
+}
+
+const list_allocator* list_arena_allocator(list_arena* arena) {
+    return arena != nullptr ? &arena->allocator : nullptr;
+}
+
+list_status list_pool_init(list_pool* pool, list_arena* arena) {
+    if (pool == nullptr || arena == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    pool->arena = arena;
+    for (size_t i = 0; i < LIST_POOL_CLASS_COUNT; i++) {
+        pool->free_lists[i] = nullptr;
+    }
+    pool->allocator = (list_allocator) {
+        .alloc   = list_pool_alloc_cb,
+        .realloc = list_pool_realloc_cb,
+        .free    = list_pool_free_cb,
+        .ctx     = pool,
+    };
+
+    return LIST_OK;
+}
+
+void list_pool_reset(list_pool* pool) {
+    if (pool == nullptr) return;
+
+    for (size_t i = 0; i < LIST_POOL_CLASS_COUNT; i++) {
+        pool->free_lists[i] = nullptr;
+    }
+    list_arena_reset(pool->arena);
+}
+
+const list_allocator* list_pool_allocator(list_pool* pool) {
+    return pool != nullptr ? &pool->allocator : nullptr;
+}
+
+static size_t list_arena_round(const size_t size) {
+    constexpr size_t align = alignof(max_align_t);
+    if (size > SIZE_MAX - (align - 1)) return 0;
+    return (size + align - 1) & ~(align - 1);
+}
+
+static list_arena_block* list_arena_add_block(list_arena* arena, const size_t size) {
+    const size_t capacity = size > arena->block_size ? size : arena->block_size;
+    if (capacity > SIZE_MAX - sizeof(list_arena_block)) return nullptr;
+
+    list_arena_block* block = malloc(sizeof(list_arena_block) + capacity);
+    if (block == nullptr) return nullptr;
+
+    block->capacity = capacity;
+    block->used = 0;
+    block->last = 0;
+
+    // Insert after the current block so that stale blocks remain available for reuse
+    if (arena->current == nullptr) {
+        block->next = arena->first;
+        arena->first = block;
+    } else {
+        block->next = arena->current->next;
+        arena->current->next = block;
+    }
+    arena->current = block;
+
+    return block;
+}
+
+static size_t list_pool_class(const size_t size) {
+    size_t block = LIST_POOL_MIN_BLOCK;
+    for (size_t i = 0; i < LIST_POOL_CLASS_COUNT; i++) {
+        if (size <= block) return i;
+        block <<= 1;
+    }
+    return LIST_POOL_CLASS_COUNT;
+}
+
+static void* list_arena_alloc_cb(void* ctx, const size_t size) {
+    return list_arena_alloc(ctx, size);
+}
+
+static void* list_arena_realloc_cb(void* ctx, void* ptr, const size_t old_size, const size_t new_size) {
+    list_arena* arena = ctx;
+    list_arena_block* block = arena->current;
+
+    // The most recent allocation can be resized in place
+    if (block != nullptr && ptr == block->bytes + block->last) {
+        const size_t rounded = list_arena_round(new_size);
+        if (rounded != 0 && rounded <= block->capacity - block->last) {
+            block->used = block->last + rounded;
+            return ptr;
+        }
+    }
+
+    void* new_ptr = list_arena_alloc(arena, new_size);
+    if (new_ptr == nullptr) return nullptr;
+
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    return new_ptr;
+}
+
+static void list_arena_free_cb(void* ctx, void* ptr, [[maybe_unused]] const size_t size) {
+    list_arena* arena = ctx;
+    list_arena_block* block = arena->current;
+
+    // Only the most recent allocation can be reclaimed before a reset
+    if (block != nullptr && ptr == block->bytes + block->last) {
+        block->used = block->last;
+    }
+}
+
+static void* list_pool_alloc_cb(void* ctx, const size_t size) {
+    list_pool* pool = ctx;
+    const size_t cls = list_pool_class(size);
+
+    if (cls == LIST_POOL_CLASS_COUNT) return list_arena_alloc(pool->arena, size);
+
+    void* block = pool->free_lists[cls];
+    if (block != nullptr) {
+        memcpy(&pool->free_lists[cls], block, sizeof(void*));
+        return block;
+    }
+
+    return list_arena_alloc(pool->arena, (size_t) LIST_POOL_MIN_BLOCK << cls);
+}
+
+static void* list_pool_realloc_cb(void* ctx, void* ptr, const size_t old_size, const size_t new_size) {
+    list_pool* pool = ctx;
+    const size_t old_cls = list_pool_class(old_size);
+    const size_t new_cls = list_pool_class(new_size);
+
+    if (old_cls == new_cls && old_cls != LIST_POOL_CLASS_COUNT) return ptr;
+
+    void* new_ptr = list_pool_alloc_cb(pool, new_size);
+    if (new_ptr == nullptr) return nullptr;
+
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    list_pool_free_cb(pool, ptr, old_size);
+    return new_ptr;
+}
+
+static void list_pool_free_cb(void* ctx, void* ptr, const size_t size) {
+    list_pool* pool = ctx;
+    const size_t cls = list_pool_class(size);
+
+    if (cls == LIST_POOL_CLASS_COUNT) {
+        list_arena_free_cb(pool->arena, ptr, size);
+        return;
+    }
+
+    memcpy(ptr, &pool->free_lists[cls], sizeof(void*));
+    pool->free_lists[cls] = ptr;
+}
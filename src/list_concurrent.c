@@ -0,0 +1,342 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list_concurrent.h"
+#include "list_internal.h"
+
+/**
+ * @brief Tombstone stored in place of a chunk whose allocation failed.
+ * @internal
+ *
+ * Every slot of a dead chunk stays empty: pushes that land in it reserve
+ * again past its end, and snapshots step over it.
+ */
+static uint8_t concurrent_list_dead_chunk_;
+#define CONCURRENT_LIST_DEAD_CHUNK (&concurrent_list_dead_chunk_)
+
+/**
+ * @defgroup list_concurrent_internal Internal Concurrent List Functions
+ * @brief Helper functions used internally by the concurrent list implementation.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_concurrent_internal
+ * @brief Locates the chunk and offset that hold element `index`.
+ * @internal
+ *
+ * @param cl Pointer to the list.
+ * @param index Zero-based index of the element.
+ * @param out_chunk Receives the chunk number.
+ * @param out_offset Receives the element's offset within the chunk.
+ * @return `true` if the index is within the list's maximum capacity.
+ */
+static bool concurrent_list_locate(const concurrent_list* cl, size_t index, size_t* out_chunk, size_t* out_offset);
+
+/**
+ * @ingroup list_concurrent_internal
+ * @brief Gets the number of elements chunk `k` can hold.
+ * @internal
+ */
+static size_t concurrent_list_chunk_capacity(const concurrent_list* cl, size_t k);
+
+/**
+ * @ingroup list_concurrent_internal
+ * @brief Gets the index of the first element of chunk `k`.
+ * @internal
+ */
+static size_t concurrent_list_chunk_start(const concurrent_list* cl, size_t k);
+
+/**
+ * @ingroup list_concurrent_internal
+ * @brief Gets chunk `k`, allocating and publishing it if no thread has yet.
+ * @internal
+ *
+ * A failed allocation publishes `CONCURRENT_LIST_DEAD_CHUNK` instead, unless
+ * another thread published a real chunk first.
+ *
+ * @return Pointer to the chunk, `CONCURRENT_LIST_DEAD_CHUNK` if another thread's
+ *         allocation failed, or `NULL` if this call's allocation failed.
+ */
+static uint8_t* concurrent_list_get_chunk(concurrent_list* cl, size_t k);
+
+/**
+ * @ingroup list_concurrent_internal
+ * @brief Moves the reservation counter past the end of dead chunk `k`.
+ * @internal
+ */
+static void concurrent_list_skip_chunk(concurrent_list* cl, size_t k);
+
+/**
+ * @ingroup list_concurrent_internal
+ * @brief Gets the size in bytes of chunk `k`, elements and ready flags together.
+ * @internal
+ */
+static size_t concurrent_list_chunk_bytes(const concurrent_list* cl, size_t k);
+
+/**
+ * @ingroup list_concurrent_internal
+ * @brief Frees a chunk through the list's allocator.
+ * @internal
+ */
+static void concurrent_list_free_chunk(const concurrent_list* cl, uint8_t* chunk, size_t k);
+
+/**
+ * @ingroup list_concurrent_internal
+ * @brief Gets the ready flag of an element within its chunk.
+ * @internal
+ *
+ * Each chunk stores its elements first, followed by one flag per element
+ * that is set with release semantics once the element has been written.
+ */
+static atomic_uchar* concurrent_list_ready_flag(const concurrent_list* cl, uint8_t* chunk, size_t k, size_t offset);
+
+/** @} */ // end of list_concurrent_internal
+
+list_status concurrent_list_init(concurrent_list* cl, const size_t elem_size) {
+    return concurrent_list_init_with_capacity(cl, CONCURRENT_LIST_DEFAULT_CHUNK, elem_size);
+}
+
+list_status concurrent_list_init_with_capacity(concurrent_list* cl, const size_t capacity, const size_t elem_size) {
+    return concurrent_list_init_with_allocator(cl, capacity, elem_size, nullptr);
+}
+
+list_status concurrent_list_init_with_allocator(
+    concurrent_list* cl,
+    const size_t capacity,
+    const size_t elem_size,
+    const list_allocator* allocator)
+{
+    if (cl == nullptr || elem_size == 0 || capacity > CONCURRENT_LIST_MAX_FIRST_CHUNK) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+    if (allocator != nullptr &&
+        (allocator->alloc == nullptr || allocator->realloc == nullptr || allocator->free == nullptr)) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    unsigned shift = 0;
+    while (((size_t) 1 << shift) < capacity) shift++;
+
+    for (size_t k = 0; k < CONCURRENT_LIST_MAX_CHUNKS; k++) {
+        atomic_init(&cl->chunks[k], nullptr);
+    }
+    atomic_init(&cl->reserved, 0);
+    atomic_init(&cl->published, 0);
+    cl->elem_size = elem_size;
+    cl->first_chunk_shift = shift;
+    cl->allocator = allocator;
+
+    return LIST_OK;
+}
+
+void concurrent_list_destroy(concurrent_list* cl) {
+    if (cl == nullptr) return;
+
+    for (size_t k = 0; k < CONCURRENT_LIST_MAX_CHUNKS; k++) {
+        uint8_t* chunk = atomic_load_explicit(&cl->chunks[k], memory_order_relaxed);
+        if (chunk != nullptr && chunk != CONCURRENT_LIST_DEAD_CHUNK) concurrent_list_free_chunk(cl, chunk, k);
+        atomic_store_explicit(&cl->chunks[k], nullptr, memory_order_relaxed);
+    }
+    atomic_store_explicit(&cl->reserved, 0, memory_order_relaxed);
+    atomic_store_explicit(&cl->published, 0, memory_order_relaxed);
+}
+
+list_status concurrent_list_push(concurrent_list* cl, const void* value) {
+    if (cl == nullptr || value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    size_t k;
+    size_t offset;
+    uint8_t* chunk;
+    for (;;) {
+        const size_t index = atomic_fetch_add_explicit(&cl->reserved, 1, memory_order_relaxed);
+        if (!concurrent_list_locate(cl, index, &k, &offset)) return list_fail(nullptr, LIST_ERR_ALLOC);
+
+        chunk = concurrent_list_get_chunk(cl, k);
+        if (chunk != nullptr && chunk != CONCURRENT_LIST_DEAD_CHUNK) break;
+
+        // The slot is left in a dead chunk that snapshots step over. Only the
+        // push whose allocation failed reports it; the others reserve again.
+        concurrent_list_skip_chunk(cl, k);
+        if (chunk == nullptr) return list_fail(nullptr, LIST_ERR_ALLOC);
+    }
+
+    memcpy(chunk + offset * cl->elem_size, value, cl->elem_size);
+    atomic_store_explicit(concurrent_list_ready_flag(cl, chunk, k, offset), 1, memory_order_release);
+
+    return LIST_OK;
+}
+
+size_t concurrent_list_size(const concurrent_list* cl) {
+    if (cl == nullptr) return 0;
+    return atomic_load_explicit(&cl->reserved, memory_order_relaxed);
+}
+
+list_status concurrent_list_get(const concurrent_list* cl, const size_t index, void* out_value) {
+    if (cl == nullptr || out_value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    if (index >= concurrent_list_size(cl)) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+
+    size_t k;
+    size_t offset;
+    if (!concurrent_list_locate(cl, index, &k, &offset)) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+
+    uint8_t* chunk = atomic_load_explicit(&cl->chunks[k], memory_order_acquire);
+    if (chunk == nullptr || chunk == CONCURRENT_LIST_DEAD_CHUNK) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+    if (atomic_load_explicit(concurrent_list_ready_flag(cl, chunk, k, offset), memory_order_acquire) == 0) {
+        return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+    }
+
+    memcpy(out_value, chunk + offset * cl->elem_size, cl->elem_size);
+    return LIST_OK;
+}
+
+list_status concurrent_list_snapshot_take(concurrent_list* cl, concurrent_list_snapshot* out_snapshot) {
+    if (cl == nullptr || out_snapshot == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    const size_t reserved = atomic_load_explicit(&cl->reserved, memory_order_acquire);
+    size_t known = atomic_load_explicit(&cl->published, memory_order_acquire);
+    size_t size = known;
+
+    // Extend the published prefix over every element whose writer has finished
+    while (size < reserved) {
+        size_t k;
+        size_t offset;
+        if (!concurrent_list_locate(cl, size, &k, &offset)) break;
+
+        uint8_t* chunk = atomic_load_explicit(&cl->chunks[k], memory_order_acquire);
+        if (chunk == nullptr) break;
+        if (chunk == CONCURRENT_LIST_DEAD_CHUNK) {
+            const size_t end = concurrent_list_chunk_start(cl, k + 1);
+            size = end < reserved ? end : reserved;
+            continue;
+        }
+        if (atomic_load_explicit(concurrent_list_ready_flag(cl, chunk, k, offset), memory_order_acquire) == 0) break;
+
+        size++;
+    }
+
+    while (known < size &&
+           !atomic_compare_exchange_weak_explicit(
+               &cl->published, &known, size, memory_order_release, memory_order_relaxed)) {
+    }
+
+    out_snapshot->owner = cl;
+    out_snapshot->size = size;
+    return LIST_OK;
+}
+
+const void* concurrent_list_snapshot_at(const concurrent_list_snapshot* snapshot, const size_t index) {
+    if (snapshot == nullptr || index >= snapshot->size) return nullptr;
+
+    const concurrent_list* cl = snapshot->owner;
+    size_t k;
+    size_t offset;
+    concurrent_list_locate(cl, index, &k, &offset);
+
+    const uint8_t* chunk = atomic_load_explicit(&cl->chunks[k], memory_order_acquire);
+    if (chunk == CONCURRENT_LIST_DEAD_CHUNK) return nullptr;
+    return chunk + offset * cl->elem_size;
+}
+
+list_status concurrent_list_snapshot_for_each(
+    const concurrent_list_snapshot* snapshot,
+    void (*fn)(const void* elems, size_t count, size_t first_index, void* ctx),
+    void* ctx)
+{
+    if (snapshot == nullptr || fn == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    const concurrent_list* cl = snapshot->owner;
+    size_t first = 0;
+    for (size_t k = 0; first < snapshot->size; k++) {
+        const size_t chunk_capacity = concurrent_list_chunk_capacity(cl, k);
+        const size_t remaining = snapshot->size - first;
+        const size_t count = remaining < chunk_capacity ? remaining : chunk_capacity;
+
+        const uint8_t* chunk = atomic_load_explicit(&cl->chunks[k], memory_order_acquire);
+        if (chunk != CONCURRENT_LIST_DEAD_CHUNK) fn(chunk, count, first, ctx);
+        first += count;
+    }
+
+    return LIST_OK;
+}
+
+static bool concurrent_list_locate(
+    const concurrent_list* cl,
+    const size_t index,
+    size_t* out_chunk,
+    size_t* out_offset)
+{
+    list_chunk_locate(cl->first_chunk_shift, index, out_chunk, out_offset);
+    return *out_chunk < CONCURRENT_LIST_MAX_CHUNKS;
+}
+
+static size_t concurrent_list_chunk_capacity(const concurrent_list* cl, const size_t k) {
+    return (size_t) 1 << (cl->first_chunk_shift + k);
+}
+
+static size_t concurrent_list_chunk_start(const concurrent_list* cl, const size_t k) {
+    return (((size_t) 1 << k) - 1) << cl->first_chunk_shift;
+}
+
+static uint8_t* concurrent_list_get_chunk(concurrent_list* cl, const size_t k) {
+    uint8_t* chunk = atomic_load_explicit(&cl->chunks[k], memory_order_acquire);
+    if (chunk != nullptr) return chunk;
+
+    // Zeroed so that every ready flag starts cleared
+    const size_t capacity = concurrent_list_chunk_capacity(cl, k);
+    uint8_t* fresh = nullptr;
+    if (capacity <= SIZE_MAX / (cl->elem_size + 1)) {
+        if (cl->allocator == nullptr) {
+            fresh = calloc(capacity, cl->elem_size + 1);
+        } else {
+            fresh = cl->allocator->alloc(cl->allocator->ctx, concurrent_list_chunk_bytes(cl, k));
+            if (fresh != nullptr) memset(fresh, 0, concurrent_list_chunk_bytes(cl, k));
+        }
+    }
+
+    // Slots are handed out before their chunk exists, so a failure is published
+    // as a tombstone rather than leaving them for snapshots to wait on forever
+    uint8_t* published = fresh != nullptr ? fresh : CONCURRENT_LIST_DEAD_CHUNK;
+    uint8_t* expected = nullptr;
+    if (atomic_compare_exchange_strong_explicit(
+            &cl->chunks[k], &expected, published, memory_order_acq_rel, memory_order_acquire)) {
+        return fresh;
+    }
+
+    // Another thread published the chunk (or its tombstone) first
+    if (fresh != nullptr) concurrent_list_free_chunk(cl, fresh, k);
+    return expected;
+}
+
+static void concurrent_list_skip_chunk(concurrent_list* cl, const size_t k) {
+    // Only runs after a failed allocation, so the loop is off the hot path
+    const size_t end = concurrent_list_chunk_start(cl, k + 1);
+    size_t reserved = atomic_load_explicit(&cl->reserved, memory_order_relaxed);
+    while (reserved < end &&
+           !atomic_compare_exchange_weak_explicit(
+               &cl->reserved, &reserved, end, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static size_t concurrent_list_chunk_bytes(const concurrent_list* cl, const size_t k) {
+    return concurrent_list_chunk_capacity(cl, k) * (cl->elem_size + 1);
+}
+
+static void concurrent_list_free_chunk(const concurrent_list* cl, uint8_t* chunk, const size_t k) {
+    if (cl->allocator == nullptr) {
+        free(chunk);
+    } else {
+        cl->allocator->free(cl->allocator->ctx, chunk, concurrent_list_chunk_bytes(cl, k));
+    }
+}
+
+static atomic_uchar* concurrent_list_ready_flag(
+    const concurrent_list* cl,
+    uint8_t* chunk,
+    const size_t k,
+    const size_t offset)
+{
+    return (atomic_uchar*) (chunk + concurrent_list_chunk_capacity(cl, k) * cl->elem_size) + offset;
+}
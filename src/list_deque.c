@@ -0,0 +1,243 @@
+#include <stdint.h>
+#include <string.h>
+#include "list_deque.h"
+#include "list_internal.h"
+
+/**
+ * @defgroup list_deque_internal Internal Deque Functions
+ * @brief Helper functions used internally by the deque implementation.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_deque_internal
+ * @brief Gets the address of the element at `index`, counted from the front.
+ * @internal
+ *
+ * `index` must be below the capacity; the wrap is a compare and subtract
+ * rather than a division.
+ */
+static uint8_t* list_deque_slot(const list_deque* dq, size_t index);
+
+/**
+ * @ingroup list_deque_internal
+ * @brief Grows the ring by at least one slot, keeping the elements in ring order.
+ * @internal
+ *
+ * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if allocation fails.
+ */
+static list_status list_deque_grow(list_deque* dq);
+
+/**
+ * @ingroup list_deque_internal
+ * @brief Reverses the order of the `count` elements starting at `data`.
+ * @internal
+ */
+static void list_deque_reverse(uint8_t* data, size_t count, size_t elem_size);
+
+/** @} */ // end of list_deque_internal
+
+list_status list_deque_init(list_deque* dq, const size_t elem_size) {
+    return list_deque_init_with_allocator(dq, 0, elem_size, nullptr);
+}
+
+list_status list_deque_init_with_capacity(list_deque* dq, const size_t capacity, const size_t elem_size) {
+    return list_deque_init_with_allocator(dq, capacity, elem_size, nullptr);
+}
+
+list_status list_deque_init_with_allocator(
+    list_deque* dq,
+    const size_t capacity,
+    const size_t elem_size,
+    const list_allocator* allocator)
+{
+    if (dq == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    dq->head = 0;
+    return list_init_with_allocator(&dq->buf, capacity, elem_size, allocator);
+}
+
+void list_deque_destroy(list_deque* dq) {
+    if (dq == nullptr) return;
+
+    list_destroy(&dq->buf);
+    dq->head = 0;
+}
+
+size_t list_deque_size(const list_deque* dq) {
+    return dq != nullptr ? dq->buf.size : 0;
+}
+
+size_t list_deque_capacity(const list_deque* dq) {
+    return dq != nullptr ? dq->buf.capacity : 0;
+}
+
+list_status list_deque_push_back(list_deque* dq, const void* value) {
+    if (dq == nullptr || value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    if (dq->buf.size == dq->buf.capacity) {
+        const list_status err = list_deque_grow(dq);
+        if (err != LIST_OK) return err;
+    }
+
+    memcpy(list_deque_slot(dq, dq->buf.size), value, dq->buf.elem_size);
+    dq->buf.size++;
+
+    return LIST_OK;
+}
+
+list_status list_deque_push_front(list_deque* dq, const void* value) {
+    if (dq == nullptr || value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    if (dq->buf.size == dq->buf.capacity) {
+        const list_status err = list_deque_grow(dq);
+        if (err != LIST_OK) return err;
+    }
+
+    dq->head = (dq->head == 0 ? dq->buf.capacity : dq->head) - 1;
+    memcpy((uint8_t*) dq->buf.data + dq->head * dq->buf.elem_size, value, dq->buf.elem_size);
+    dq->buf.size++;
+
+    return LIST_OK;
+}
+
+list_status list_deque_pop_back(list_deque* dq, void* out_value) {
+    if (dq == nullptr || dq->buf.size == 0) return list_fail(dq != nullptr ? &dq->buf : nullptr, LIST_ERR_INVALID);
+
+    dq->buf.size--;
+    if (out_value != nullptr) memcpy(out_value, list_deque_slot(dq, dq->buf.size), dq->buf.elem_size);
+
+    return LIST_OK;
+}
+
+list_status list_deque_pop_front(list_deque* dq, void* out_value) {
+    if (dq == nullptr || dq->buf.size == 0) return list_fail(dq != nullptr ? &dq->buf : nullptr, LIST_ERR_INVALID);
+
+    if (out_value != nullptr) memcpy(out_value, list_deque_slot(dq, 0), dq->buf.elem_size);
+
+    dq->buf.size--;
+    dq->head++;
+    if (dq->head == dq->buf.capacity || dq->buf.size == 0) dq->head = 0;
+
+    return LIST_OK;
+}
+
+list_status list_deque_get(const list_deque* dq, const size_t index, void* out_value) {
+    if (dq == nullptr || out_value == nullptr) return list_fail(dq != nullptr ? &dq->buf : nullptr, LIST_ERR_INVALID);
+
+    if (index >= dq->buf.size) return list_fail(&dq->buf, LIST_OUT_OF_BOUNDS);
+
+    memcpy(out_value, list_deque_slot(dq, index), dq->buf.elem_size);
+    return LIST_OK;
+}
+
+list_status list_deque_set(list_deque* dq, const size_t index, const void* value) {
+    if (dq == nullptr || value == nullptr) return list_fail(dq != nullptr ? &dq->buf : nullptr, LIST_ERR_INVALID);
+
+    if (index >= dq->buf.size) return list_fail(&dq->buf, LIST_OUT_OF_BOUNDS);
+
+    memcpy(list_deque_slot(dq, index), value, dq->buf.elem_size);
+    return LIST_OK;
+}
+
+void* list_deque_at(const list_deque* dq, const size_t index) {
+    if (dq == nullptr || index >= dq->buf.size) return nullptr;
+
+    return list_deque_slot(dq, index);
+}
+
+void list_deque_clear(list_deque* dq) {
+    if (dq == nullptr) return;
+
+    dq->buf.size = 0;
+    dq->head = 0;
+}
+
+void* list_deque_make_contiguous(list_deque* dq) {
+    if (dq == nullptr || dq->buf.size == 0) return nullptr;
+
+    uint8_t* data = dq->buf.data;
+    const size_t elem_size = dq->buf.elem_size;
+    const size_t capacity = dq->buf.capacity;
+
+    if (dq->head + dq->buf.size <= capacity) return data + dq->head * elem_size;
+
+    // The ring is [A | gap | B]: B holds the first elements, A the wrapped rest
+    const size_t front = capacity - dq->head;
+    const size_t back = dq->buf.size - front;
+    const size_t gap = dq->head - back;
+
+    if (front <= gap) {
+        // Shift A right past where B will go, then put B at the start
+        memmove(data + front * elem_size, data, back * elem_size);
+        memcpy(data, data + dq->head * elem_size, front * elem_size);
+        dq->head = 0;
+    } else if (back <= gap) {
+        // Shift B left into the gap, then append A after it
+        memmove(data + (dq->head - back) * elem_size, data + dq->head * elem_size, front * elem_size);
+        memcpy(data + (capacity - back) * elem_size, data, back * elem_size);
+        dq->head -= back;
+    } else {
+        // Not enough room to move either part aside: rotate [A | gap | B] into [B | A | gap]
+        list_deque_reverse(data, dq->head, elem_size);
+        list_deque_reverse(data + dq->head * elem_size, front, elem_size);
+        list_deque_reverse(data, capacity, elem_size);
+        dq->head = 0;
+    }
+
+    return data + dq->head * elem_size;
+}
+
+static uint8_t* list_deque_slot(const list_deque* dq, const size_t index) {
+    size_t slot = dq->head + index;
+    if (slot >= dq->buf.capacity) slot -= dq->buf.capacity;
+
+    return (uint8_t*) dq->buf.data + slot * dq->buf.elem_size;
+}
+
+static list_status list_deque_grow(list_deque* dq) {
+    list* buf = &dq->buf;
+    const size_t old_capacity = buf->capacity;
+
+    if (old_capacity == SIZE_MAX) return list_fail(buf, LIST_ERR_ALLOC);
+
+    const list_status err = list_ensure_capacity(buf, old_capacity + 1);
+    if (err != LIST_OK) return err;
+
+    // Nothing wrapped, so the contents are already in ring order
+    if (dq->head + buf->size <= old_capacity) return LIST_OK;
+
+    uint8_t* data = buf->data;
+    const size_t elem_size = buf->elem_size;
+    const size_t added = buf->capacity - old_capacity;
+    const size_t front = old_capacity - dq->head;
+    const size_t back = buf->size - front;
+
+    if (back <= front && back <= added) {
+        // Append the wrapped part after the old end
+        memcpy(data + old_capacity * elem_size, data, back * elem_size);
+    } else {
+        // Move the first part to the new end
+        const size_t new_head = buf->capacity - front;
+        memmove(data + new_head * elem_size, data + dq->head * elem_size, front * elem_size);
+        dq->head = new_head;
+    }
+
+    return LIST_OK;
+}
+
+static void list_deque_reverse(uint8_t* data, const size_t count, const size_t elem_size) {
+    if (count < 2) return;
+
+    uint8_t* lo = data;
+    uint8_t* hi = data + (count - 1) * elem_size;
+
+    for (; lo < hi; lo += elem_size, hi -= elem_size) {
+        for (size_t b = 0; b < elem_size; b++) {
+            const uint8_t tmp = lo[b];
+            lo[b] = hi[b];
+            hi[b] = tmp;
+        }
+    }
+}
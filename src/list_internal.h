@@ -0,0 +1,252 @@
+#ifndef LIST_INTERNAL_H
+#define LIST_INTERNAL_H
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "list.h"
+#include "list_snapshot.h"
+
+/**
+ * @file list_internal.h
+ * @brief Declarations shared between the library's translation units.
+ * @internal
+ *
+ * Nothing in this header is part of the public API.
+ */
+
+#ifdef LIST_ENABLE_STATS
+
+/**
+ * @brief Records a buffer resize from `old_bytes` to `new_bytes`.
+ * @internal
+ *
+ * @param lst Pointer to the list whose buffer was resized.
+ * @param old_bytes Size of the buffer before the resize.
+ * @param new_bytes Size of the buffer after the resize.
+ * @param moved Whether the buffer was relocated, copying its contents.
+ */
+void list_stats_on_resize(list* lst, size_t old_bytes, size_t new_bytes, bool moved);
+
+/**
+ * @brief Records that `bytes` bytes of a list's buffer were zero-filled.
+ * @internal
+ */
+void list_stats_on_zero(list* lst, size_t bytes);
+
+/**
+ * @brief Records a failed operation.
+ * @internal
+ *
+ * @param lst Pointer to the list, or `NULL` to record the failure globally only.
+ * @param err The failure status.
+ */
+void list_stats_on_failure(const list* lst, list_status err);
+
+#define LIST_STATS_RESIZE(lst, old_bytes, new_bytes, moved) list_stats_on_resize((lst), (old_bytes), (new_bytes), (moved))
+#define LIST_STATS_ZERO(lst, bytes)                         list_stats_on_zero((lst), (bytes))
+#define LIST_STATS_FAILURE(lst, err)                        list_stats_on_failure((lst), (err))
+
+#else
+
+#define LIST_STATS_RESIZE(lst, old_bytes, new_bytes, moved) ((void) 0)
+#define LIST_STATS_ZERO(lst, bytes)                         ((void) 0)
+#define LIST_STATS_FAILURE(lst, err)                        ((void) 0)
+
+#endif
+
+/**
+ * @brief Checks whether a list's buffer is a file mapping opened by `list_open_mapped`.
+ * @internal
+ */
+bool list_is_mapped(const list* lst);
+
+/**
+ * @brief Points the file mapping behind `lst` back at `lst` after the list struct was moved.
+ * @internal
+ *
+ * The mapping records its owning list so it can write the size back to the
+ * file header; `list_move` and `list_swap` call this once the struct lives
+ * at its new address. `lst` must be a mapped list.
+ */
+void list_mapped_rebind(list* lst);
+
+/**
+ * @brief Gets the smallest capacity a mapped list of `elem_size` elements keeps.
+ * @internal
+ *
+ * That is the first page of elements after the file header, and at least one;
+ * `list_shrink_to_fit` stops there so an empty mapped list stays attached to its file.
+ */
+size_t list_mapped_min_capacity(size_t elem_size);
+
+/**
+ * @brief Gives a list a private buffer before it is written, if it holds a shared one.
+ * @internal
+ *
+ * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if the private copy cannot be allocated.
+ */
+static inline list_status list_own(list* lst) {
+    return list_is_shared(lst) ? list_unshare(lst) : LIST_OK;
+}
+
+/**
+ * @brief Lets go of a shared buffer on behalf of `list_destroy`.
+ * @internal
+ *
+ * Restores the list's own allocator and frees the buffer if this was its
+ * last holder. `lst` must be shared; its `data` is left `NULL` unless it
+ * had already moved to a private buffer.
+ */
+void list_shared_drop(list* lst);
+
+/**
+ * @brief Restores the list's own allocator after `list_move` handed its shared buffer to another list.
+ * @internal
+ *
+ * The reference to the shared block now belongs to the destination, so
+ * nothing is released. `lst` must be shared.
+ */
+void list_shared_forget(list* lst);
+
+/**
+ * @brief Hints that the cache line holding `addr` will soon be read (`rw` 0) or written (`rw` 1).
+ * @internal
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define LIST_PREFETCH(addr, rw) __builtin_prefetch((addr), (rw), 3)
+#else
+#define LIST_PREFETCH(addr, rw) ((void) 0)
+#endif
+
+/**
+ * @brief Computes the base-2 logarithm of `n`, rounded down. `n` must be non-zero.
+ * @internal
+ */
+static inline unsigned list_log2(const size_t n) {
+#if defined(__GNUC__)
+    return (unsigned) (sizeof(unsigned long long) * CHAR_BIT - 1) - (unsigned) __builtin_clzll(n);
+#else
+    unsigned result = 0;
+    while ((n >> result) > 1) result++;
+    return result;
+#endif
+}
+
+/**
+ * @brief Locates an element in storage made of geometrically growing chunks.
+ * @internal
+ *
+ * Chunk `k` holds `1 << (first_chunk_shift + k)` elements and starts at
+ * element `((1 << k) - 1) << first_chunk_shift`. Callers cap
+ * `first_chunk_shift` so that shift stays below `SIZE_WIDTH` for every chunk
+ * they allocate, and `index` must be less than `SIZE_MAX`.
+ *
+ * @param first_chunk_shift Base-2 logarithm of the size of the first chunk.
+ * @param index Zero-based index of the element.
+ * @param out_chunk Receives the chunk number.
+ * @param out_offset Receives the element's offset within the chunk.
+ */
+static inline void list_chunk_locate(
+    const unsigned first_chunk_shift,
+    const size_t index,
+    size_t* out_chunk,
+    size_t* out_offset)
+{
+    const size_t k = list_log2((index >> first_chunk_shift) + 1);
+    *out_chunk = k;
+    *out_offset = index - ((((size_t) 1 << k) - 1) << first_chunk_shift);
+}
+
+/**
+ * @brief Ensures the list can hold at least `required` elements.
+ * @internal
+ *
+ * If the current capacity is insufficient, the buffer is resized exactly once
+ * to the larger of `required` and the capacity `list_grow` would have chosen,
+ * so repeated bulk appends keep the amortized growth of `list_push`. The
+ * list's capacity rounding is applied to the result. The whole old buffer
+ * is preserved, not only the first `size` elements, which `list_deque`
+ * relies on.
+ *
+ * @param lst Pointer to the list.
+ * @param required The minimum number of elements the list must be able to hold.
+ * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if memory allocation fails.
+ */
+list_status list_ensure_capacity(list* lst, size_t required);
+
+/**
+ * @brief Finds the first of `count` elements that is bitwise equal to `value`.
+ * @internal
+ *
+ * Dispatches to the SIMD kernels picked for the running CPU.
+ *
+ * @return Index of the first match, or `LIST_NOT_FOUND`.
+ */
+size_t list_simd_find(const void* data, size_t count, size_t elem_size, const void* value);
+
+/**
+ * @brief Counts the elements among `count` that are bitwise equal to `value`.
+ * @internal
+ */
+size_t list_simd_count(const void* data, size_t count, size_t elem_size, const void* value);
+
+/**
+ * @brief Writes `count` copies of `value` to `dst`.
+ * @internal
+ */
+void list_simd_fill(void* dst, size_t count, size_t elem_size, const void* value);
+
+/**
+ * @brief Number of values in a block unpacked by `list_simd_unpack128`.
+ * @internal
+ */
+#define LIST_SIMD_PACK_BLOCK 128
+
+/**
+ * @brief Unpacks a block of 128 values of `width` bits each.
+ * @internal
+ *
+ * The block is laid out as four interleaved 32-bit lanes, so that one vector
+ * shift decodes four values: value `i` belongs to lane `i % 4`, each lane
+ * packs its 32 values back to back from the low bits up, and word `w` of
+ * lane `l` is stored at `words[4 * w + l]`.
+ *
+ * @param words The `4 * width` words of the block.
+ * @param width Bits per value, from 0 to 32.
+ * @param out Receives the 128 values in order.
+ */
+void list_simd_unpack128(const uint32_t* words, unsigned width, uint32_t* out);
+
+/**
+ * @brief Runs `task(i, ctx)` for every `i` in `[0, count)` on the shared parallel pool.
+ * @internal
+ *
+ * Each index is one unit of work claimed by a single thread; the calling
+ * thread takes part and the call returns once every task has finished.
+ * Scheduling falls back to the calling thread as in `list_parallel_for`.
+ *
+ * @param count Number of tasks.
+ * @param task Function running one task. Called concurrently.
+ * @param ctx User data passed to `task`.
+ * @param nthreads Maximum number of threads to use, or 0 for one per hardware thread.
+ */
+void list_parallel_tasks(size_t count, void (*task)(size_t index, void* ctx), void* ctx, size_t nthreads);
+
+/**
+ * @brief Records a failure status and returns it unchanged.
+ * @internal
+ *
+ * Used at every point where the library originates an error, so that
+ * failures are counted exactly once even when they propagate.
+ *
+ * @param lst Pointer to the list, or `NULL` if there is none.
+ * @param err The failure status.
+ * @return `err`.
+ */
+static inline list_status list_fail([[maybe_unused]] const list* lst, const list_status err) {
+    LIST_STATS_FAILURE(lst, err);
+    return err;
+}
+
+#endif //LIST_INTERNAL_H
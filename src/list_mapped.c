@@ -0,0 +1,347 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // mremap
+#endif
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "list_mapped.h"
+#include "list_internal.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Identifies a mapped list file ("LISTMAP1" in little-endian byte order).
+ * @internal
+ */
+#define LIST_MAPPED_MAGIC UINT64_C(0x3150414d5453494c)
+
+/**
+ * @brief On-disk header at the start of every mapped list file.
+ * @internal
+ *
+ * Padded to 64 bytes so the elements that follow it stay cache-line aligned.
+ */
+typedef struct list_mapped_header {
+    uint64_t magic;
+    uint64_t elem_size;
+    uint64_t size;
+    uint64_t capacity;
+    uint64_t reserved[4];
+} list_mapped_header;
+
+/**
+ * @brief State behind the allocator of a mapped list.
+ * @internal
+ *
+ * @var list_mapping::allocator
+ *      The allocator installed in the list; its context is this mapping.
+ *
+ * @var list_mapping::owner
+ *      The list the mapping belongs to, used to persist its size on close.
+ *
+ * @var list_mapping::fd
+ *      The open backing file.
+ *
+ * @var list_mapping::base
+ *      Start of the mapping, where the header lives.
+ *
+ * @var list_mapping::length
+ *      Length of the mapping (and of the file) in bytes.
+ */
+typedef struct list_mapping {
+    list_allocator allocator;
+    list*          owner;
+    int            fd;
+    uint8_t*       base;
+    size_t         length;
+} list_mapping;
+
+/**
+ * @defgroup list_mapped_internal Internal Mapped List Functions
+ * @brief Helper functions used internally by the memory-mapped list implementation.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_mapped_internal
+ * @brief Gets the mapping behind a list, or `NULL` if the list is not mapped.
+ * @internal
+ */
+static list_mapping* list_mapping_of(const list* lst);
+
+/**
+ * @ingroup list_mapped_internal
+ * @brief Resizes the file and the mapping so they hold `data_bytes` bytes of elements.
+ * @internal
+ *
+ * @param map Pointer to the mapping.
+ * @param data_bytes The new size of the element area in bytes.
+ * @return Pointer to the (possibly moved) element area, or `NULL` on failure.
+ */
+static void* list_mapping_resize(list_mapping* map, size_t data_bytes);
+
+/**
+ * @ingroup list_mapped_internal
+ * @brief Records the owner's size and capacity in the file header.
+ * @internal
+ */
+static void list_mapping_write_header(const list_mapping* map);
+
+/**
+ * @ingroup list_mapped_internal
+ * @brief Lowers the capacity and size in the file header to what `data_bytes` bytes can hold.
+ * @internal
+ *
+ * `list_open_mapped` rejects a header whose capacity exceeds the file, so
+ * this runs before the file shrinks. The elements that stay in the file
+ * keep the size of the last sync.
+ */
+static void list_mapping_clamp_header(const list_mapping* map, size_t data_bytes);
+
+/**
+ * @ingroup list_mapped_internal
+ * @brief Unmaps and closes the file and frees the mapping.
+ * @internal
+ */
+static void list_mapping_close(list_mapping* map);
+
+static void* list_mapped_alloc_cb(void* ctx, size_t size);
+static void* list_mapped_realloc_cb(void* ctx, void* ptr, size_t old_size, size_t new_size);
+static void  list_mapped_free_cb(void* ctx, void* ptr, size_t size);
+
+/** @} */ // end of list_mapped_internal
+
+list_status list_open_mapped(list* lst, const char* path, const size_t elem_size, const unsigned flags) {
+    if (lst == nullptr || path == nullptr || elem_size == 0) return list_fail(nullptr, LIST_ERR_INVALID);
+    if ((flags & ~(LIST_MAP_CREATE | LIST_MAP_TRUNCATE)) != 0) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    list_mapping* map = malloc(sizeof *map);
+    if (map == nullptr) return list_fail(nullptr, LIST_ERR_ALLOC);
+
+    int open_flags = O_RDWR;
+    if ((flags & LIST_MAP_CREATE) != 0) open_flags |= O_CREAT;
+    if ((flags & LIST_MAP_TRUNCATE) != 0) open_flags |= O_TRUNC;
+
+    map->fd = open(path, open_flags, 0666);
+    struct stat st;
+    if (map->fd < 0 || fstat(map->fd, &st) != 0) {
+        if (map->fd >= 0) close(map->fd);
+        free(map);
+        return list_fail(nullptr, LIST_ERR_IO);
+    }
+
+    map->allocator = (list_allocator) {
+        .alloc   = list_mapped_alloc_cb,
+        .realloc = list_mapped_realloc_cb,
+        .free    = list_mapped_free_cb,
+        .ctx     = map,
+    };
+    map->owner = lst;
+    map->base = nullptr;
+    map->length = 0;
+
+    const bool fresh = st.st_size == 0;
+    if (fresh) {
+        if (ftruncate(map->fd, sizeof(list_mapped_header)) != 0) {
+            list_mapping_close(map);
+            return list_fail(nullptr, LIST_ERR_IO);
+        }
+        st.st_size = sizeof(list_mapped_header);
+    }
+    if ((uint64_t) st.st_size < sizeof(list_mapped_header) || (uint64_t) st.st_size > SIZE_MAX) {
+        list_mapping_close(map);
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    void* base = mmap(nullptr, (size_t) st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, map->fd, 0);
+    if (base == MAP_FAILED) {
+        list_mapping_close(map);
+        return list_fail(nullptr, LIST_ERR_IO);
+    }
+    map->base = base;
+    map->length = (size_t) st.st_size;
+
+    list_mapped_header* header = (list_mapped_header*) map->base;
+    if (fresh) {
+        memset(header, 0, sizeof *header);
+        header->magic = LIST_MAPPED_MAGIC;
+        header->elem_size = elem_size;
+    }
+
+    const size_t data_bytes = map->length - sizeof *header;
+    if (header->magic != LIST_MAPPED_MAGIC || header->elem_size != elem_size ||
+        header->size > header->capacity || header->capacity > data_bytes / elem_size) {
+        list_mapping_close(map);
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    // A new file gets a first page of elements, so a mapped list never has a NULL buffer
+    const size_t initial_capacity = header->capacity == 0 ? list_mapped_min_capacity(elem_size) : 0;
+
+    const list_status err = list_init_with_allocator(lst, initial_capacity, elem_size, &map->allocator);
+    if (err != LIST_OK) {
+        list_mapping_close(map);
+        return err;
+    }
+
+    if (initial_capacity == 0) {
+        lst->data = map->base + sizeof *header;
+        lst->size = (size_t) header->size;
+        lst->capacity = (size_t) header->capacity;
+    }
+    list_mapping_write_header(map);
+
+    return LIST_OK;
+}
+
+list_status list_sync(list* lst) {
+    list_mapping* map = list_mapping_of(lst);
+    if (map == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    list_mapping_write_header(map);
+    if (msync(map->base, map->length, MS_SYNC) != 0) return list_fail(lst, LIST_ERR_IO);
+
+    return LIST_OK;
+}
+
+list_status list_close_mapped(list* lst) {
+    if (list_mapping_of(lst) == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    const list_status err = list_sync(lst);
+    list_destroy(lst);
+    return err;
+}
+
+bool list_is_mapped(const list* lst) {
+    return list_mapping_of(lst) != nullptr;
+}
+
+void list_mapped_rebind(list* lst) {
+    list_mapping_of(lst)->owner = lst;
+}
+
+size_t list_mapped_min_capacity(const size_t elem_size) {
+    const size_t capacity = (LIST_PAGE_SIZE - sizeof(list_mapped_header)) / elem_size;
+    return capacity == 0 ? 1 : capacity;
+}
+
+static list_mapping* list_mapping_of(const list* lst) {
+    if (lst == nullptr || lst->allocator == nullptr || lst->allocator->alloc != list_mapped_alloc_cb) return nullptr;
+    return lst->allocator->ctx;
+}
+
+static void* list_mapping_resize(list_mapping* map, const size_t data_bytes) {
+    if (data_bytes > SIZE_MAX - sizeof(list_mapped_header)) return nullptr;
+
+    const size_t new_length = sizeof(list_mapped_header) + data_bytes;
+    if (new_length == map->length) return map->base + sizeof(list_mapped_header);
+
+    // Extend the file before mapping past its old end; truncate only after unmapping the tail
+    if (new_length > map->length && ftruncate(map->fd, (off_t) new_length) != 0) return nullptr;
+
+    // A shorter file must still reopen if the process dies before the next sync
+    if (new_length < map->length) list_mapping_clamp_header(map, data_bytes);
+
+#if defined(MREMAP_MAYMOVE)
+    void* base = mremap(map->base, map->length, new_length, MREMAP_MAYMOVE);
+#else
+    void* base = mmap(nullptr, new_length, PROT_READ | PROT_WRITE, MAP_SHARED, map->fd, 0);
+    if (base != MAP_FAILED) munmap(map->base, map->length);
+#endif
+    if (base == MAP_FAILED) {
+        if (new_length > map->length && ftruncate(map->fd, (off_t) map->length) != 0) {
+            // A failed rollback only leaves extra length past the elements the header covers
+        }
+        return nullptr;
+    }
+
+    // The mapping and header already describe the smaller list, so a failed
+    // truncate is only counted: the resize still succeeds and the file keeps
+    // unused length at its end, which reopening ignores and growth reuses
+    if (new_length < map->length && ftruncate(map->fd, (off_t) new_length) != 0) {
+        list_fail(map->owner, LIST_ERR_IO);
+    }
+
+    map->base = base;
+    map->length = new_length;
+    return map->base + sizeof(list_mapped_header);
+}
+
+static void list_mapping_write_header(const list_mapping* map) {
+    list_mapped_header* header = (list_mapped_header*) map->base;
+    header->size = map->owner->size;
+    header->capacity = map->owner->capacity;
+}
+
+static void list_mapping_clamp_header(const list_mapping* map, const size_t data_bytes) {
+    list_mapped_header* header = (list_mapped_header*) map->base;
+    const uint64_t capacity = data_bytes / header->elem_size;
+
+    if (header->capacity > capacity) header->capacity = capacity;
+    if (header->size > capacity) header->size = capacity;
+}
+
+static void list_mapping_close(list_mapping* map) {
+    if (map->base != nullptr) munmap(map->base, map->length);
+    close(map->fd);
+    free(map);
+}
+
+static void* list_mapped_alloc_cb(void* ctx, const size_t size) {
+    return list_mapping_resize(ctx, size);
+}
+
+static void* list_mapped_realloc_cb(
+    void* ctx,
+    [[maybe_unused]] void* ptr,
+    [[maybe_unused]] const size_t old_size,
+    const size_t new_size)
+{
+    return list_mapping_resize(ctx, new_size);
+}
+
+static void list_mapped_free_cb(void* ctx, [[maybe_unused]] void* ptr, [[maybe_unused]] const size_t size) {
+    list_mapping* map = ctx;
+
+    // The buffer is going away, so the list falls back to the standard allocator
+    list_mapping_write_header(map);
+    map->owner->allocator = nullptr;
+    list_mapping_close(map);
+}
+
+#else
+
+list_status list_open_mapped(
+    [[maybe_unused]] list* lst,
+    [[maybe_unused]] const char* path,
+    [[maybe_unused]] const size_t elem_size,
+    [[maybe_unused]] const unsigned flags)
+{
+    return list_fail(nullptr, LIST_ERR_IO);
+}
+
+list_status list_sync(list* lst) {
+    return list_fail(lst, LIST_ERR_INVALID);
+}
+
+list_status list_close_mapped(list* lst) {
+    return list_fail(lst, LIST_ERR_INVALID);
+}
+
+bool list_is_mapped([[maybe_unused]] const list* lst) {
+    return false;
+}
+
+void list_mapped_rebind([[maybe_unused]] list* lst) {}
+
+size_t list_mapped_min_capacity([[maybe_unused]] const size_t elem_size) {
+    return 1;
+}
+
+#endif
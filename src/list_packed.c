@@ -0,0 +1,410 @@
+#include <stdint.h>
+#include <string.h>
+#include "list_packed.h"
+#include "list_internal.h"
+
+static_assert(LIST_PACKED_BLOCK == LIST_SIMD_PACK_BLOCK, "packed blocks must match the SIMD unpacker");
+
+/**
+ * @brief Width recorded for a block stored at full width, with no residuals.
+ * @internal
+ */
+#define LIST_PACKED_RAW_WIDTH 64
+
+/**
+ * @brief Header of one encoded block.
+ * @internal
+ *
+ * @var list_packed_block::base
+ *      The block's minimum (frame of reference) or its first value (delta).
+ *
+ * @var list_packed_block::offset
+ *      Index in `words` of the block's first packed word.
+ *
+ * @var list_packed_block::width
+ *      Bits per residual, from 0 to 32, or `LIST_PACKED_RAW_WIDTH`.
+ *
+ * @var list_packed_block::delta
+ *      Whether residuals are gaps to the value four positions earlier
+ *      rather than offsets from `base`.
+ */
+typedef struct list_packed_block {
+    uint64_t base;
+    size_t   offset;
+    uint8_t  width;
+    bool     delta;
+} list_packed_block;
+
+/**
+ * @defgroup list_packed_internal Internal Packed List Functions
+ * @brief Helper functions used internally by the packed list implementation.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_packed_internal
+ * @brief Encodes `LIST_PACKED_BLOCK` values and appends the block.
+ * @internal
+ *
+ * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if allocation fails, in
+ *         which case the list is left unchanged.
+ */
+static list_status list_packed_encode(list_packed* pk, const uint8_t* values);
+
+/**
+ * @ingroup list_packed_internal
+ * @brief Bit-packs 128 residuals of `width` bits into zeroed `words`, in the
+ *        lane layout `list_simd_unpack128` reads.
+ * @internal
+ */
+static void list_packed_pack(const uint32_t* residuals, unsigned width, uint32_t* words);
+
+/**
+ * @ingroup list_packed_internal
+ * @brief Reads the residual at `step` of `lane` without unpacking the block.
+ * @internal
+ */
+static uint32_t list_packed_extract(const uint32_t* words, unsigned width, unsigned step, unsigned lane);
+
+/**
+ * @ingroup list_packed_internal
+ * @brief Decodes every value of block `b` into `out`.
+ * @internal
+ */
+static void list_packed_decode_block(const list_packed* pk, size_t b, uint8_t* out);
+
+/**
+ * @ingroup list_packed_internal
+ * @brief Number of values held in full blocks.
+ * @internal
+ */
+static size_t list_packed_block_values(const list_packed* pk);
+
+/** @} */ // end of list_packed_internal
+
+list_status list_packed_init(list_packed* pk, const size_t elem_size) {
+    if (pk == nullptr || (elem_size != sizeof(uint32_t) && elem_size != sizeof(uint64_t))) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    list_init(&pk->blocks, sizeof(list_packed_block));
+    list_init(&pk->words, sizeof(uint32_t));
+    list_init(&pk->tail, elem_size);
+    // The tail empties every block; keep its buffer instead of shrinking it each time
+    list_set_shrink_policy(&pk->tail, LIST_SHRINK_NEVER, 0);
+    pk->size = 0;
+    pk->elem_size = elem_size;
+
+    return LIST_OK;
+}
+
+list_status list_packed_from_list(list_packed* pk, const list* src) {
+    if (pk == nullptr || src == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    list_status err = list_packed_init(pk, src->elem_size);
+    if (err != LIST_OK) return err;
+
+    err = list_packed_push_n(pk, src->data, src->size);
+    if (err != LIST_OK) list_packed_destroy(pk);
+    return err;
+}
+
+void list_packed_destroy(list_packed* pk) {
+    if (pk == nullptr) return;
+
+    list_destroy(&pk->blocks);
+    list_destroy(&pk->words);
+    list_destroy(&pk->tail);
+    pk->size = 0;
+}
+
+size_t list_packed_size(const list_packed* pk) {
+    return pk != nullptr ? pk->size : 0;
+}
+
+size_t list_packed_bytes(const list_packed* pk) {
+    if (pk == nullptr) return 0;
+
+    return pk->blocks.capacity * pk->blocks.elem_size +
+           pk->words.capacity * pk->words.elem_size +
+           pk->tail.capacity * pk->tail.elem_size;
+}
+
+list_status list_packed_push(list_packed* pk, const void* value) {
+    if (pk == nullptr || value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    const list_status err = list_push(&pk->tail, value);
+    if (err != LIST_OK) return err;
+
+    if (pk->tail.size == LIST_PACKED_BLOCK) {
+        const list_status encode_err = list_packed_encode(pk, pk->tail.data);
+        if (encode_err != LIST_OK) {
+            pk->tail.size--;
+            return encode_err;
+        }
+        list_clear(&pk->tail);
+    }
+
+    pk->size++;
+    return LIST_OK;
+}
+
+list_status list_packed_push_n(list_packed* pk, const void* values, size_t count) {
+    if (pk == nullptr || (values == nullptr && count > 0)) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    const uint8_t* src = values;
+    const size_t elem_size = pk->elem_size;
+
+    // Top up the pending tail so that the rest starts on a block boundary
+    for (; count > 0 && pk->tail.size > 0; count--, src += elem_size) {
+        const list_status err = list_packed_push(pk, src);
+        if (err != LIST_OK) return err;
+    }
+
+    const list_status err = list_reserve(&pk->blocks, pk->blocks.size + count / LIST_PACKED_BLOCK);
+    if (err != LIST_OK) return err;
+
+    for (; count >= LIST_PACKED_BLOCK; count -= LIST_PACKED_BLOCK, src += LIST_PACKED_BLOCK * elem_size) {
+        const list_status encode_err = list_packed_encode(pk, src);
+        if (encode_err != LIST_OK) return encode_err;
+        pk->size += LIST_PACKED_BLOCK;
+    }
+
+    if (count == 0) return LIST_OK;
+
+    const list_status tail_err = list_push_n(&pk->tail, src, count);
+    if (tail_err != LIST_OK) return tail_err;
+    pk->size += count;
+
+    return LIST_OK;
+}
+
+list_status list_packed_get(const list_packed* pk, const size_t index, void* out_value) {
+    if (pk == nullptr || out_value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+    if (index >= pk->size) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+
+    const size_t packed = list_packed_block_values(pk);
+    if (index >= packed) return list_get(&pk->tail, index - packed, out_value);
+
+    const list_packed_block* block = (const list_packed_block*) pk->blocks.data + index / LIST_PACKED_BLOCK;
+    const uint32_t* words = (const uint32_t*) pk->words.data + block->offset;
+    const unsigned offset = (unsigned) (index % LIST_PACKED_BLOCK);
+
+    if (block->width == LIST_PACKED_RAW_WIDTH) {
+        memcpy(out_value, words + 2 * offset, sizeof(uint64_t));
+        return LIST_OK;
+    }
+
+    const unsigned lane = offset % 4;
+    const unsigned step = offset / 4;
+    uint64_t value = block->base;
+
+    if (block->delta) {
+        for (unsigned s = 0; s <= step; s++) value += list_packed_extract(words, block->width, s, lane);
+    } else {
+        value += list_packed_extract(words, block->width, step, lane);
+    }
+
+    if (pk->elem_size == sizeof(uint32_t)) {
+        const uint32_t narrow = (uint32_t) value;
+        memcpy(out_value, &narrow, sizeof narrow);
+    } else {
+        memcpy(out_value, &value, sizeof value);
+    }
+
+    return LIST_OK;
+}
+
+list_status list_packed_decode(const list_packed* pk, size_t first, size_t count, void* out) {
+    if (pk == nullptr || (out == nullptr && count > 0)) return list_fail(nullptr, LIST_ERR_INVALID);
+    if (first > pk->size || count > pk->size - first) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+
+    const size_t elem_size = pk->elem_size;
+    const size_t packed = list_packed_block_values(pk);
+    uint8_t* dst = out;
+
+    while (count > 0 && first < packed) {
+        const size_t offset = first % LIST_PACKED_BLOCK;
+        const size_t n = LIST_PACKED_BLOCK - offset < count ? LIST_PACKED_BLOCK - offset : count;
+
+        if (n == LIST_PACKED_BLOCK) {
+            list_packed_decode_block(pk, first / LIST_PACKED_BLOCK, dst);
+        } else {
+            alignas(uint64_t) uint8_t scratch[LIST_PACKED_BLOCK * sizeof(uint64_t)];
+            list_packed_decode_block(pk, first / LIST_PACKED_BLOCK, scratch);
+            memcpy(dst, scratch + offset * elem_size, n * elem_size);
+        }
+
+        dst += n * elem_size;
+        first += n;
+        count -= n;
+    }
+
+    if (count > 0) memcpy(dst, (const uint8_t*) pk->tail.data + (first - packed) * elem_size, count * elem_size);
+    return LIST_OK;
+}
+
+list_status list_packed_shrink_to_fit(list_packed* pk) {
+    if (pk == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    list_status err = list_shrink_to_fit(&pk->blocks);
+    if (err != LIST_OK) return err;
+
+    err = list_shrink_to_fit(&pk->words);
+    if (err != LIST_OK) return err;
+
+    return list_shrink_to_fit(&pk->tail);
+}
+
+void list_packed_clear(list_packed* pk) {
+    if (pk == nullptr) return;
+
+    list_clear(&pk->blocks);
+    list_clear(&pk->words);
+    list_clear(&pk->tail);
+    pk->size = 0;
+}
+
+static list_status list_packed_encode(list_packed* pk, const uint8_t* values) {
+    uint64_t v[LIST_PACKED_BLOCK];
+    if (pk->elem_size == sizeof(uint32_t)) {
+        for (size_t i = 0; i < LIST_PACKED_BLOCK; i++) {
+            uint32_t narrow;
+            memcpy(&narrow, values + i * sizeof narrow, sizeof narrow);
+            v[i] = narrow;
+        }
+    } else {
+        memcpy(v, values, sizeof v);
+    }
+
+    uint64_t min = v[0];
+    uint64_t max = v[0];
+    bool sorted = true;
+    for (size_t i = 1; i < LIST_PACKED_BLOCK; i++) {
+        if (v[i] < min) min = v[i];
+        if (v[i] > max) max = v[i];
+        sorted &= v[i] >= v[i - 1];
+    }
+
+    uint64_t max_gap = 0;
+    if (sorted) {
+        for (size_t i = 1; i < LIST_PACKED_BLOCK; i++) {
+            const uint64_t gap = v[i] - v[i < 4 ? 0 : i - 4];
+            if (gap > max_gap) max_gap = gap;
+        }
+    }
+
+    // Prefer frame of reference on a tie, since it decodes single values in O(1)
+    const unsigned range_width = max == min ? 0 : list_log2(max - min) + 1;
+    const unsigned gap_width = max_gap == 0 ? 0 : list_log2(max_gap) + 1;
+
+    list_packed_block block = {
+        .base   = min,
+        .offset = pk->words.size,
+        .width  = (uint8_t) range_width,
+        .delta  = false,
+    };
+    if (sorted && gap_width < range_width) {
+        block.base = v[0];
+        block.width = (uint8_t) gap_width;
+        block.delta = true;
+    }
+    if (block.width > 32) {
+        block.base = 0;
+        block.width = LIST_PACKED_RAW_WIDTH;
+        block.delta = false;
+    }
+
+    list_status err = list_reserve(&pk->blocks, pk->blocks.size + 1);
+    if (err != LIST_OK) return err;
+
+    const size_t word_count = block.width == LIST_PACKED_RAW_WIDTH ? 2 * LIST_PACKED_BLOCK : 4 * (size_t) block.width;
+    err = list_resize_to(&pk->words, block.offset + word_count, nullptr);
+    if (err != LIST_OK) return err;
+
+    uint32_t* words = (uint32_t*) pk->words.data + block.offset;
+    if (block.width == LIST_PACKED_RAW_WIDTH) {
+        memcpy(words, v, sizeof v);
+    } else if (block.width > 0) {
+        uint32_t residuals[LIST_PACKED_BLOCK];
+        for (size_t i = 0; i < LIST_PACKED_BLOCK; i++) {
+            const uint64_t reference = !block.delta ? block.base : v[i < 4 ? 0 : i - 4];
+            residuals[i] = (uint32_t) (v[i] - reference);
+        }
+        list_packed_pack(residuals, block.width, words);
+    }
+
+    // Room was reserved above, so this cannot fail
+    list_push(&pk->blocks, &block);
+    return LIST_OK;
+}
+
+static void list_packed_pack(const uint32_t* residuals, const unsigned width, uint32_t* words) {
+    for (unsigned step = 0; step < LIST_PACKED_BLOCK / 4; step++) {
+        const unsigned bit = step * width;
+        const unsigned word = bit / 32;
+        const unsigned shift = bit % 32;
+
+        for (unsigned lane = 0; lane < 4; lane++) {
+            const uint32_t residual = residuals[step * 4 + lane];
+            words[word * 4 + lane] |= residual << shift;
+            if (shift + width > 32) words[(word + 1) * 4 + lane] |= residual >> (32 - shift);
+        }
+    }
+}
+
+static uint32_t list_packed_extract(const uint32_t* words, const unsigned width, const unsigned step, const unsigned lane) {
+    if (width == 0) return 0;
+
+    const unsigned bit = step * width;
+    const unsigned word = bit / 32;
+    const unsigned shift = bit % 32;
+    const uint32_t mask = width == 32 ? UINT32_MAX : ((uint32_t) 1 << width) - 1;
+
+    uint32_t value = words[word * 4 + lane] >> shift;
+    if (shift + width > 32) value |= words[(word + 1) * 4 + lane] << (32 - shift);
+    return value & mask;
+}
+
+// Rebuilds a block of `type` values from its residuals. The delta chain
+// runs four values apart, so each step is one vector add of the lanes
+#define LIST_PACKED_RECONSTRUCT(type)                                                    \
+    do {                                                                                 \
+        type decoded[LIST_PACKED_BLOCK];                                                 \
+        const type base = (type) block->base;                                            \
+        if (block->delta) {                                                              \
+            for (size_t i = 0; i < 4; i++) decoded[i] = base + residuals[i];             \
+            for (size_t i = 4; i < LIST_PACKED_BLOCK; i++) {                             \
+                decoded[i] = decoded[i - 4] + residuals[i];                              \
+            }                                                                            \
+        } else {                                                                         \
+            for (size_t i = 0; i < LIST_PACKED_BLOCK; i++) decoded[i] = base + residuals[i]; \
+        }                                                                                \
+        memcpy(out, decoded, sizeof decoded);                                            \
+    } while (0)
+
+static void list_packed_decode_block(const list_packed* pk, const size_t b, uint8_t* out) {
+    const list_packed_block* block = (const list_packed_block*) pk->blocks.data + b;
+    const uint32_t* words = (const uint32_t*) pk->words.data + block->offset;
+
+    if (block->width == LIST_PACKED_RAW_WIDTH) {
+        memcpy(out, words, LIST_PACKED_BLOCK * sizeof(uint64_t));
+        return;
+    }
+
+    uint32_t residuals[LIST_PACKED_BLOCK];
+    list_simd_unpack128(words, block->width, residuals);
+
+    if (pk->elem_size == sizeof(uint32_t)) {
+        LIST_PACKED_RECONSTRUCT(uint32_t);
+    } else {
+        LIST_PACKED_RECONSTRUCT(uint64_t);
+    }
+}
+
+#undef LIST_PACKED_RECONSTRUCT
+
+static size_t list_packed_block_values(const list_packed* pk) {
+    return pk->blocks.size * LIST_PACKED_BLOCK;
+}
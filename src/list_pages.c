@@ -0,0 +1,263 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // mremap, MAP_HUGETLB
+#endif
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list_pages.h"
+#include "list_internal.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LIST_PAGES_HAVE_MMAP 1
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Flags that route large buffers to `mmap`.
+ * @internal
+ */
+#define LIST_PAGES_MAP_FLAGS (LIST_PAGES_MAP | LIST_PAGES_HUGEPAGE | LIST_PAGES_HUGETLB)
+
+/**
+ * @defgroup list_pages_internal Internal Page Allocator Functions
+ * @brief Helper functions used internally by the page allocator.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_pages_internal
+ * @brief Checks whether a buffer of `size` bytes is mapped rather than on the heap.
+ * @internal
+ *
+ * The answer depends only on the size, which the list passes to every
+ * callback, so no per-buffer bookkeeping is needed.
+ */
+static bool list_pages_is_mapped(const list_pages* pages, size_t size);
+
+/**
+ * @ingroup list_pages_internal
+ * @brief Rounds `size` up to a multiple of the power of two `multiple`.
+ * @internal
+ */
+static size_t list_pages_round_up(size_t size, size_t multiple);
+
+/**
+ * @ingroup list_pages_internal
+ * @brief Allocates an aligned heap block.
+ * @internal
+ */
+static void* list_pages_heap_alloc(const list_pages* pages, size_t size);
+
+/**
+ * @ingroup list_pages_internal
+ * @brief Resizes an aligned heap block.
+ * @internal
+ *
+ * Over-aligned blocks are moved to a fresh aligned block rather than passed
+ * to `realloc`, which may not keep the alignment. On failure `ptr` is left
+ * untouched.
+ */
+static void* list_pages_heap_realloc(const list_pages* pages, void* ptr, size_t old_size, size_t new_size);
+
+/**
+ * @ingroup list_pages_internal
+ * @brief Maps a buffer of `size` bytes, on huge pages if requested.
+ * @internal
+ */
+static void* list_pages_map(const list_pages* pages, size_t size);
+
+/**
+ * @ingroup list_pages_internal
+ * @brief Resizes a mapped buffer in place or by remapping its pages.
+ * @internal
+ */
+static void* list_pages_remap(const list_pages* pages, void* ptr, size_t old_size, size_t new_size);
+
+/**
+ * @ingroup list_pages_internal
+ * @brief Unmaps a mapped buffer of `size` bytes.
+ * @internal
+ */
+static void list_pages_unmap(const list_pages* pages, void* ptr, size_t size);
+
+static void* list_pages_alloc_cb(void* ctx, size_t size);
+static void* list_pages_realloc_cb(void* ctx, void* ptr, size_t old_size, size_t new_size);
+static void list_pages_free_cb(void* ctx, void* ptr, size_t size);
+
+/** @} */ // end of list_pages_internal
+
+list_status list_pages_init(list_pages* pages, size_t alignment, size_t map_threshold, const unsigned flags) {
+    if (pages == nullptr || (flags & ~(unsigned) LIST_PAGES_MAP_FLAGS) != 0) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    if (alignment == 0) alignment = alignof(max_align_t);
+    if ((alignment & (alignment - 1)) != 0 || alignment > LIST_PAGE_SIZE) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    size_t page_size = LIST_PAGE_SIZE;
+#if defined(LIST_PAGES_HAVE_MMAP)
+    const long system_page = sysconf(_SC_PAGESIZE);
+    if (system_page > 0) page_size = (size_t) system_page;
+#endif
+
+    if (map_threshold == 0) map_threshold = LIST_PAGES_DEFAULT_THRESHOLD;
+
+    pages->alignment = alignment;
+    pages->map_threshold = map_threshold;
+    pages->granule = page_size;
+    if ((flags & (LIST_PAGES_HUGEPAGE | LIST_PAGES_HUGETLB)) != 0 && page_size < LIST_HUGE_PAGE_SIZE) {
+        pages->granule = LIST_HUGE_PAGE_SIZE;
+    }
+    pages->flags = flags;
+    pages->allocator = (list_allocator) {
+        list_pages_alloc_cb, list_pages_realloc_cb, list_pages_free_cb, pages
+    };
+
+    return LIST_OK;
+}
+
+const list_allocator* list_pages_allocator(list_pages* pages) {
+    return pages != nullptr ? &pages->allocator : nullptr;
+}
+
+static void* list_pages_alloc_cb(void* ctx, const size_t size) {
+    const list_pages* pages = ctx;
+
+    if (list_pages_is_mapped(pages, size)) return list_pages_map(pages, size);
+    return list_pages_heap_alloc(pages, size);
+}
+
+static void* list_pages_realloc_cb(void* ctx, void* ptr, const size_t old_size, const size_t new_size) {
+    const list_pages* pages = ctx;
+    const bool was_mapped = list_pages_is_mapped(pages, old_size);
+    const bool is_mapped = list_pages_is_mapped(pages, new_size);
+
+    if (was_mapped && is_mapped) return list_pages_remap(pages, ptr, old_size, new_size);
+    if (!was_mapped && !is_mapped) return list_pages_heap_realloc(pages, ptr, old_size, new_size);
+
+    // Crossing the threshold moves the buffer between the heap and a mapping
+    void* moved = list_pages_alloc_cb(ctx, new_size);
+    if (moved == nullptr) return nullptr;
+
+    memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    list_pages_free_cb(ctx, ptr, old_size);
+    return moved;
+}
+
+static void list_pages_free_cb(void* ctx, void* ptr, const size_t size) {
+    const list_pages* pages = ctx;
+
+    if (list_pages_is_mapped(pages, size)) {
+        list_pages_unmap(pages, ptr, size);
+    } else {
+        free(ptr);
+    }
+}
+
+static bool list_pages_is_mapped([[maybe_unused]] const list_pages* pages, [[maybe_unused]] const size_t size) {
+#if defined(LIST_PAGES_HAVE_MMAP)
+    return (pages->flags & LIST_PAGES_MAP_FLAGS) != 0 && size >= pages->map_threshold;
+#else
+    return false;
+#endif
+}
+
+static size_t list_pages_round_up(const size_t size, const size_t multiple) {
+    if (size > SIZE_MAX - (multiple - 1)) return 0;
+    return (size + multiple - 1) & ~(multiple - 1);
+}
+
+static void* list_pages_heap_alloc(const list_pages* pages, const size_t size) {
+    if (pages->alignment <= alignof(max_align_t)) return malloc(size);
+
+    // aligned_alloc wants a size that is a multiple of the alignment
+    const size_t rounded = list_pages_round_up(size, pages->alignment);
+    return rounded != 0 ? aligned_alloc(pages->alignment, rounded) : nullptr;
+}
+
+static void* list_pages_heap_realloc(
+    const list_pages* pages,
+    void* ptr,
+    const size_t old_size,
+    const size_t new_size)
+{
+    if (ptr == nullptr) return list_pages_heap_alloc(pages, new_size);
+    if (pages->alignment <= alignof(max_align_t)) return realloc(ptr, new_size);
+
+    void* aligned = list_pages_heap_alloc(pages, new_size);
+    if (aligned == nullptr) return nullptr;
+
+    memcpy(aligned, ptr, old_size < new_size ? old_size : new_size);
+    free(ptr);
+    return aligned;
+}
+
+#if defined(LIST_PAGES_HAVE_MMAP)
+
+static void* list_pages_map(const list_pages* pages, const size_t size) {
+    const size_t length = list_pages_round_up(size, pages->granule);
+    if (length == 0) return nullptr;
+
+    void* base = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    if ((pages->flags & LIST_PAGES_HUGETLB) != 0) {
+        base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+
+    if (base == MAP_FAILED) {
+        base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) return nullptr;
+
+#if defined(MADV_HUGEPAGE)
+        // Only a hint: the kernel may not have transparent huge pages enabled
+        if ((pages->flags & (LIST_PAGES_HUGEPAGE | LIST_PAGES_HUGETLB)) != 0) madvise(base, length, MADV_HUGEPAGE);
+#endif
+    }
+
+    return base;
+}
+
+static void* list_pages_remap(const list_pages* pages, void* ptr, const size_t old_size, const size_t new_size) {
+    const size_t old_length = list_pages_round_up(old_size, pages->granule);
+    const size_t new_length = list_pages_round_up(new_size, pages->granule);
+    if (new_length == 0) return nullptr;
+    if (new_length == old_length) return ptr;
+
+#if defined(MREMAP_MAYMOVE)
+    void* base = mremap(ptr, old_length, new_length, MREMAP_MAYMOVE);
+    if (base != MAP_FAILED) return base;
+#endif
+
+    // No mremap, or the kernel cannot remap this kind of mapping: copy instead
+    void* moved = list_pages_map(pages, new_size);
+    if (moved == nullptr) return nullptr;
+
+    memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    munmap(ptr, old_length);
+    return moved;
+}
+
+static void list_pages_unmap(const list_pages* pages, void* ptr, const size_t size) {
+    if (ptr != nullptr) munmap(ptr, list_pages_round_up(size, pages->granule));
+}
+
+#else
+
+static void* list_pages_map([[maybe_unused]] const list_pages* pages, [[maybe_unused]] const size_t size) {
+    return nullptr;
+}
+
+static void* list_pages_remap(
+    [[maybe_unused]] const list_pages* pages,
+    [[maybe_unused]] void* ptr,
+    [[maybe_unused]] const size_t old_size,
+    [[maybe_unused]] const size_t new_size)
+{
+    return nullptr;
+}
+
+static void list_pages_unmap([[maybe_unused]] const list_pages* pages, [[maybe_unused]] void* ptr, [[maybe_unused]] const size_t size) {}
+
+#endif
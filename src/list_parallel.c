@@ -0,0 +1,389 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <threads.h>
+#include "list_parallel.h"
+#include "list_internal.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+typedef struct list_parallel_job list_parallel_job;
+
+/**
+ * @brief One parallel call: a buffer split into ranges that threads claim in turn.
+ * @internal
+ *
+ * @var list_parallel_job::next_chunk
+ *      Index of the next unclaimed range.
+ *
+ * @var list_parallel_job::run_chunk
+ *      Processes one range; set by the public entry point that built the job.
+ *
+ * @var list_parallel_job::partials
+ *      Per-range results of a reduction, `result_size` bytes each.
+ */
+struct list_parallel_job {
+    uint8_t*      data;
+    size_t        size;
+    size_t        elem_size;
+    size_t        chunk_elems;
+    size_t        chunk_count;
+    atomic_size_t next_chunk;
+    void        (*run_chunk)(const list_parallel_job* job, size_t chunk, uint8_t* elems, size_t count, size_t first);
+    void        (*for_fn)(void* elems, size_t count, size_t first_index, void* ctx);
+    void        (*reduce_fn)(const void* elems, size_t count, void* accumulator, void* ctx);
+    void        (*task_fn)(size_t index, void* ctx);
+    uint8_t*      partials;
+    const void*   identity;
+    size_t        result_size;
+    void*         ctx;
+};
+
+/**
+ * @brief The process-wide worker pool shared by every parallel call.
+ * @internal
+ *
+ * One job runs at a time; `submit` is held by the thread that posted it.
+ * Workers sleep on `wake` until `generation` changes, and those whose index
+ * is below `participants` join the job. The last one to finish signals `done`.
+ */
+static struct {
+    once_flag          init_once;
+    bool               ready;
+    mtx_t              submit;
+    mtx_t              lock;
+    cnd_t              wake;
+    cnd_t              done;
+    thrd_t             workers[LIST_PARALLEL_MAX_THREADS - 1];
+    uint64_t           start_generation[LIST_PARALLEL_MAX_THREADS - 1];
+    size_t             worker_count;
+    uint64_t           generation;
+    list_parallel_job* job;
+    size_t             participants;
+    size_t             running;
+    bool               stopping;
+} list_parallel_pool = { .init_once = ONCE_FLAG_INIT };
+
+/**
+ * @defgroup list_parallel_internal Internal Parallel Functions
+ * @brief Helper functions used internally by the parallel algorithms.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_parallel_internal
+ * @brief Creates the pool's locks and condition variables; run once.
+ * @internal
+ */
+static void list_parallel_pool_init(void);
+
+/**
+ * @ingroup list_parallel_internal
+ * @brief Main loop of a pool worker.
+ * @internal
+ *
+ * @param arg The worker's index, cast to a pointer.
+ */
+static int list_parallel_worker_main(void* arg);
+
+/**
+ * @ingroup list_parallel_internal
+ * @brief Splits a buffer into ranges for a new job.
+ * @internal
+ */
+static void list_parallel_job_init(list_parallel_job* job, void* data, size_t size, size_t elem_size);
+
+/**
+ * @ingroup list_parallel_internal
+ * @brief Gets the number of elements in each range for a given element size.
+ * @internal
+ *
+ * @return About `LIST_PARALLEL_CHUNK_BYTES` worth of elements, rounded to whole cache lines.
+ */
+static size_t list_parallel_chunk_elems(size_t elem_size);
+
+/**
+ * @ingroup list_parallel_internal
+ * @brief Claims and processes ranges of a job until none are left.
+ * @internal
+ */
+static void list_parallel_run(list_parallel_job* job);
+
+/**
+ * @ingroup list_parallel_internal
+ * @brief Runs a job on up to `nthreads` threads, including the caller, and waits for it.
+ * @internal
+ */
+static void list_parallel_execute(list_parallel_job* job, size_t nthreads);
+
+static void list_parallel_for_chunk(const list_parallel_job* job, size_t chunk, uint8_t* elems, size_t count, size_t first);
+static void list_parallel_reduce_chunk(const list_parallel_job* job, size_t chunk, uint8_t* elems, size_t count, size_t first);
+static void list_parallel_task_chunk(const list_parallel_job* job, size_t chunk, uint8_t* elems, size_t count, size_t first);
+
+/** @} */ // end of list_parallel_internal
+
+list_status list_parallel_for(
+    list* lst,
+    void (*fn)(void* elems, size_t count, size_t first_index, void* ctx),
+    void* ctx,
+    const size_t nthreads)
+{
+    if (lst == nullptr || fn == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+    if (lst->size == 0) return LIST_OK;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    list_parallel_job job;
+    list_parallel_job_init(&job, lst->data, lst->size, lst->elem_size);
+    job.run_chunk = list_parallel_for_chunk;
+    job.for_fn = fn;
+    job.ctx = ctx;
+
+    list_parallel_execute(&job, nthreads);
+    return LIST_OK;
+}
+
+list_status list_parallel_reduce(
+    const list* lst,
+    void (*reduce)(const void* elems, size_t count, void* accumulator, void* ctx),
+    void (*combine)(void* accumulator, const void* other, void* ctx),
+    void* result,
+    const size_t result_size,
+    void* ctx,
+    const size_t nthreads)
+{
+    if (lst == nullptr || reduce == nullptr || combine == nullptr || result == nullptr || result_size == 0) {
+        return list_fail(lst, LIST_ERR_INVALID);
+    }
+    if (lst->size == 0) return LIST_OK;
+
+    list_parallel_job job;
+    list_parallel_job_init(&job, lst->data, lst->size, lst->elem_size);
+
+    // A single range needs no partial results
+    if (job.chunk_count == 1) {
+        reduce(lst->data, lst->size, result, ctx);
+        return LIST_OK;
+    }
+
+    if (job.chunk_count > SIZE_MAX / result_size) return list_fail(lst, LIST_ERR_ALLOC);
+    job.partials = malloc(job.chunk_count * result_size);
+    if (job.partials == nullptr) return list_fail(lst, LIST_ERR_ALLOC);
+
+    job.run_chunk = list_parallel_reduce_chunk;
+    job.reduce_fn = reduce;
+    job.identity = result;
+    job.result_size = result_size;
+    job.ctx = ctx;
+
+    list_parallel_execute(&job, nthreads);
+
+    for (size_t k = 0; k < job.chunk_count; k++) {
+        combine(result, job.partials + k * result_size, ctx);
+    }
+
+    free(job.partials);
+    return LIST_OK;
+}
+
+void list_parallel_tasks(const size_t count, void (*task)(size_t index, void* ctx), void* ctx, const size_t nthreads) {
+    if (count == 0) return;
+
+    // Every task is a range of one element with no backing buffer
+    list_parallel_job job;
+    list_parallel_job_init(&job, nullptr, count, 1);
+    job.chunk_elems = 1;
+    job.chunk_count = count;
+    job.run_chunk = list_parallel_task_chunk;
+    job.task_fn = task;
+    job.ctx = ctx;
+
+    list_parallel_execute(&job, nthreads);
+}
+
+size_t list_parallel_hardware_threads(void) {
+#if defined(_SC_NPROCESSORS_ONLN)
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count > 0) return (size_t) count;
+#endif
+    return 1;
+}
+
+void list_parallel_shutdown(void) {
+    call_once(&list_parallel_pool.init_once, list_parallel_pool_init);
+    if (!list_parallel_pool.ready) return;
+
+    mtx_lock(&list_parallel_pool.submit);
+
+    mtx_lock(&list_parallel_pool.lock);
+    list_parallel_pool.stopping = true;
+    cnd_broadcast(&list_parallel_pool.wake);
+    mtx_unlock(&list_parallel_pool.lock);
+
+    for (size_t i = 0; i < list_parallel_pool.worker_count; i++) {
+        thrd_join(list_parallel_pool.workers[i], nullptr);
+    }
+
+    mtx_lock(&list_parallel_pool.lock);
+    list_parallel_pool.worker_count = 0;
+    list_parallel_pool.stopping = false;
+    mtx_unlock(&list_parallel_pool.lock);
+
+    mtx_unlock(&list_parallel_pool.submit);
+}
+
+static void list_parallel_pool_init(void) {
+    list_parallel_pool.ready =
+        mtx_init(&list_parallel_pool.submit, mtx_plain) == thrd_success &&
+        mtx_init(&list_parallel_pool.lock, mtx_plain) == thrd_success &&
+        cnd_init(&list_parallel_pool.wake) == thrd_success &&
+        cnd_init(&list_parallel_pool.done) == thrd_success;
+}
+
+static int list_parallel_worker_main(void* arg) {
+    const size_t id = (size_t) (uintptr_t) arg;
+
+    mtx_lock(&list_parallel_pool.lock);
+    uint64_t seen = list_parallel_pool.start_generation[id];
+    for (;;) {
+        while (list_parallel_pool.generation == seen && !list_parallel_pool.stopping) {
+            cnd_wait(&list_parallel_pool.wake, &list_parallel_pool.lock);
+        }
+        if (list_parallel_pool.stopping) break;
+
+        seen = list_parallel_pool.generation;
+        if (id >= list_parallel_pool.participants) continue;
+
+        list_parallel_job* job = list_parallel_pool.job;
+        mtx_unlock(&list_parallel_pool.lock);
+        list_parallel_run(job);
+        mtx_lock(&list_parallel_pool.lock);
+
+        if (--list_parallel_pool.running == 0) cnd_signal(&list_parallel_pool.done);
+    }
+    mtx_unlock(&list_parallel_pool.lock);
+
+    return 0;
+}
+
+static void list_parallel_job_init(list_parallel_job* job, void* data, const size_t size, const size_t elem_size) {
+    job->data = data;
+    job->size = size;
+    job->elem_size = elem_size;
+    job->chunk_elems = list_parallel_chunk_elems(elem_size);
+    job->chunk_count = (size - 1) / job->chunk_elems + 1;
+    atomic_init(&job->next_chunk, 0);
+    job->run_chunk = nullptr;
+    job->for_fn = nullptr;
+    job->reduce_fn = nullptr;
+    job->task_fn = nullptr;
+    job->partials = nullptr;
+    job->identity = nullptr;
+    job->result_size = 0;
+    job->ctx = nullptr;
+}
+
+static size_t list_parallel_chunk_elems(const size_t elem_size) {
+    // The fewest elements that fill a whole number of 64-byte lines
+    size_t a = elem_size;
+    size_t b = 64;
+    while (b != 0) {
+        const size_t t = a % b;
+        a = b;
+        b = t;
+    }
+    const size_t line_elems = 64 / a;
+
+    size_t elems = LIST_PARALLEL_CHUNK_BYTES / elem_size;
+    if (elems < line_elems) elems = line_elems;
+    return elems / line_elems * line_elems;
+}
+
+static void list_parallel_run(list_parallel_job* job) {
+    for (;;) {
+        const size_t chunk = atomic_fetch_add_explicit(&job->next_chunk, 1, memory_order_relaxed);
+        if (chunk >= job->chunk_count) return;
+
+        const size_t first = chunk * job->chunk_elems;
+        const size_t remaining = job->size - first;
+        const size_t count = remaining < job->chunk_elems ? remaining : job->chunk_elems;
+        uint8_t* elems = job->data != nullptr ? job->data + first * job->elem_size : nullptr;
+        job->run_chunk(job, chunk, elems, count, first);
+    }
+}
+
+static void list_parallel_execute(list_parallel_job* job, const size_t nthreads) {
+    size_t threads = nthreads == 0 ? list_parallel_hardware_threads() : nthreads;
+    if (threads > LIST_PARALLEL_MAX_THREADS) threads = LIST_PARALLEL_MAX_THREADS;
+    if (threads > job->chunk_count) threads = job->chunk_count;
+
+    if (threads > 1) call_once(&list_parallel_pool.init_once, list_parallel_pool_init);
+
+    // Busy or nested calls fall back to the calling thread rather than waiting
+    if (threads <= 1 || !list_parallel_pool.ready || mtx_trylock(&list_parallel_pool.submit) != thrd_success) {
+        list_parallel_run(job);
+        return;
+    }
+
+    mtx_lock(&list_parallel_pool.lock);
+    while (list_parallel_pool.worker_count < threads - 1) {
+        const size_t id = list_parallel_pool.worker_count;
+        list_parallel_pool.start_generation[id] = list_parallel_pool.generation;
+        if (thrd_create(&list_parallel_pool.workers[id], list_parallel_worker_main, (void*) (uintptr_t) id) != thrd_success) {
+            break;
+        }
+        list_parallel_pool.worker_count++;
+    }
+
+    const size_t helpers = threads - 1;
+    list_parallel_pool.participants =
+        helpers < list_parallel_pool.worker_count ? helpers : list_parallel_pool.worker_count;
+    list_parallel_pool.running = list_parallel_pool.participants;
+    list_parallel_pool.job = job;
+    list_parallel_pool.generation++;
+    cnd_broadcast(&list_parallel_pool.wake);
+    mtx_unlock(&list_parallel_pool.lock);
+
+    list_parallel_run(job);
+
+    mtx_lock(&list_parallel_pool.lock);
+    while (list_parallel_pool.running > 0) cnd_wait(&list_parallel_pool.done, &list_parallel_pool.lock);
+    list_parallel_pool.job = nullptr;
+    mtx_unlock(&list_parallel_pool.lock);
+
+    mtx_unlock(&list_parallel_pool.submit);
+}
+
+static void list_parallel_for_chunk(
+    const list_parallel_job* job,
+    [[maybe_unused]] const size_t chunk,
+    uint8_t* elems,
+    const size_t count,
+    const size_t first)
+{
+    job->for_fn(elems, count, first, job->ctx);
+}
+
+static void list_parallel_reduce_chunk(
+    const list_parallel_job* job,
+    const size_t chunk,
+    uint8_t* elems,
+    const size_t count,
+    [[maybe_unused]] const size_t first)
+{
+    void* accumulator = job->partials + chunk * job->result_size;
+    memcpy(accumulator, job->identity, job->result_size);
+    job->reduce_fn(elems, count, accumulator, job->ctx);
+}
+
+static void list_parallel_task_chunk(
+    const list_parallel_job* job,
+    const size_t chunk,
+    [[maybe_unused]] uint8_t* elems,
+    [[maybe_unused]] const size_t count,
+    [[maybe_unused]] const size_t first)
+{
+    job->task_fn(chunk, job->ctx);
+}
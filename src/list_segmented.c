@@ -0,0 +1,294 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include "list_segmented.h"
+#include "list_internal.h"
+
+/**
+ * @brief Header in front of every chunk, counting the lists that hold it.
+ * @internal
+ *
+ * Padded to `max_align_t` so the elements after it keep malloc's alignment.
+ */
+typedef union list_segmented_chunk_header {
+    atomic_size_t refs;
+    max_align_t   align;
+} list_segmented_chunk_header;
+
+/**
+ * @defgroup list_segmented_internal Internal Segmented List Functions
+ * @brief Helper functions used internally by the segmented list implementation.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_segmented_internal
+ * @brief Gets the number of elements chunk `k` can hold.
+ * @internal
+ */
+static size_t list_segmented_chunk_capacity(const list_segmented* seg, size_t k);
+
+/**
+ * @ingroup list_segmented_internal
+ * @brief Gets the index of the first element stored in chunk `k`.
+ * @internal
+ */
+static size_t list_segmented_chunk_start(const list_segmented* seg, size_t k);
+
+/**
+ * @ingroup list_segmented_internal
+ * @brief Gets the address of the element at `index`, which must be below the list's capacity.
+ * @internal
+ */
+static uint8_t* list_segmented_slot(const list_segmented* seg, size_t index);
+
+/**
+ * @ingroup list_segmented_internal
+ * @brief Gets the header of a chunk.
+ * @internal
+ */
+static list_segmented_chunk_header* list_segmented_header(uint8_t* chunk);
+
+/**
+ * @ingroup list_segmented_internal
+ * @brief Allocates chunk `k` with a single holder.
+ * @internal
+ *
+ * @return Pointer to the chunk's first element, or `NULL` if allocation fails.
+ */
+static uint8_t* list_segmented_chunk_alloc(const list_segmented* seg, size_t k);
+
+/**
+ * @ingroup list_segmented_internal
+ * @brief Drops one reference to a chunk, freeing it once the last holder lets go.
+ * @internal
+ */
+static void list_segmented_chunk_release(uint8_t* chunk);
+
+/**
+ * @ingroup list_segmented_internal
+ * @brief Makes chunk `k` private to the list before it is written.
+ * @internal
+ *
+ * Only called while bit `k` of `shared_chunks` is set. A chunk no other list
+ * holds any more is kept; otherwise its elements below the size are copied.
+ *
+ * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if the copy cannot be allocated.
+ */
+static list_status list_segmented_own_chunk(list_segmented* seg, size_t k);
+
+/** @} */ // end of list_segmented_internal
+
+list_status list_segmented_init(list_segmented* seg, const size_t elem_size) {
+    return list_segmented_init_with_capacity(seg, LIST_SEGMENTED_DEFAULT_CHUNK, elem_size);
+}
+
+list_status list_segmented_init_with_capacity(list_segmented* seg, const size_t capacity, const size_t elem_size) {
+    if (seg == nullptr || elem_size == 0 || capacity > LIST_SEGMENTED_MAX_FIRST_CHUNK) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    unsigned shift = 0;
+    while (((size_t) 1 << shift) < capacity) shift++;
+
+    for (size_t k = 0; k < LIST_SEGMENTED_MAX_CHUNKS; k++) {
+        seg->chunks[k] = nullptr;
+    }
+    seg->size = 0;
+    seg->chunk_count = 0;
+    seg->elem_size = elem_size;
+    seg->first_chunk_shift = shift;
+    seg->shared_chunks = 0;
+
+    return LIST_OK;
+}
+
+void list_segmented_destroy(list_segmented* seg) {
+    if (seg == nullptr) return;
+
+    for (size_t k = 0; k < seg->chunk_count; k++) {
+        list_segmented_chunk_release(seg->chunks[k]);
+        seg->chunks[k] = nullptr;
+    }
+    seg->size = 0;
+    seg->chunk_count = 0;
+    seg->shared_chunks = 0;
+}
+
+size_t list_segmented_size(const list_segmented* seg) {
+    if (seg == nullptr) return 0;
+    return seg->size;
+}
+
+size_t list_segmented_capacity(const list_segmented* seg) {
+    if (seg == nullptr) return 0;
+    return list_segmented_chunk_start(seg, seg->chunk_count);
+}
+
+list_status list_segmented_push(list_segmented* seg, const void* value) {
+    if (seg == nullptr || value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    if (seg->size == list_segmented_capacity(seg)) {
+        const size_t k = seg->chunk_count;
+        if (k == LIST_SEGMENTED_MAX_CHUNKS) return list_fail(nullptr, LIST_ERR_ALLOC);
+
+        uint8_t* chunk = list_segmented_chunk_alloc(seg, k);
+        if (chunk == nullptr) return list_fail(nullptr, LIST_ERR_ALLOC);
+
+        seg->chunks[k] = chunk;
+        seg->chunk_count++;
+    }
+
+    size_t k;
+    size_t offset;
+    list_chunk_locate(seg->first_chunk_shift, seg->size, &k, &offset);
+    if ((seg->shared_chunks & ((uint64_t) 1 << k)) != 0) {
+        const list_status err = list_segmented_own_chunk(seg, k);
+        if (err != LIST_OK) return err;
+    }
+
+    memcpy(seg->chunks[k] + offset * seg->elem_size, value, seg->elem_size);
+    seg->size++;
+
+    return LIST_OK;
+}
+
+list_status list_segmented_pop(list_segmented* seg, void* out_value) {
+    if (seg == nullptr || seg->size == 0) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    seg->size--;
+    if (out_value != nullptr) {
+        memcpy(out_value, list_segmented_slot(seg, seg->size), seg->elem_size);
+    }
+
+    // Release the last chunk only once the one beneath it is empty too
+    const size_t count = seg->chunk_count;
+    if (count >= 2 && seg->size <= list_segmented_chunk_start(seg, count - 2)) {
+        list_segmented_chunk_release(seg->chunks[count - 1]);
+        seg->chunks[count - 1] = nullptr;
+        seg->shared_chunks &= ~((uint64_t) 1 << (count - 1));
+        seg->chunk_count--;
+    }
+
+    return LIST_OK;
+}
+
+list_status list_segmented_get(const list_segmented* seg, const size_t index, void* out_value) {
+    if (seg == nullptr || out_value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+    if (index >= seg->size) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+
+    memcpy(out_value, list_segmented_slot(seg, index), seg->elem_size);
+    return LIST_OK;
+}
+
+list_status list_segmented_set(list_segmented* seg, const size_t index, const void* value) {
+    if (seg == nullptr || value == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+    if (index >= seg->size) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+
+    size_t k;
+    size_t offset;
+    list_chunk_locate(seg->first_chunk_shift, index, &k, &offset);
+    if ((seg->shared_chunks & ((uint64_t) 1 << k)) != 0) {
+        const list_status err = list_segmented_own_chunk(seg, k);
+        if (err != LIST_OK) return err;
+    }
+
+    memcpy(seg->chunks[k] + offset * seg->elem_size, value, seg->elem_size);
+    return LIST_OK;
+}
+
+void* list_segmented_at(const list_segmented* seg, const size_t index) {
+    if (seg == nullptr || index >= seg->size) return nullptr;
+    return list_segmented_slot(seg, index);
+}
+
+void list_segmented_clear(list_segmented* seg) {
+    if (seg == nullptr) return;
+    seg->size = 0;
+}
+
+list_status list_segmented_snapshot(list_segmented* src, list_segmented* out) {
+    if (src == nullptr || out == nullptr || src == out) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    // Only a holder can take a new reference, so relaxed ordering is enough
+    for (size_t k = 0; k < src->chunk_count; k++) {
+        atomic_fetch_add_explicit(&list_segmented_header(src->chunks[k])->refs, 1, memory_order_relaxed);
+    }
+
+    src->shared_chunks = ((uint64_t) 1 << src->chunk_count) - 1;
+    *out = *src;
+
+    return LIST_OK;
+}
+
+list_status list_segmented_unshare(list_segmented* seg) {
+    if (seg == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    for (size_t k = 0; k < seg->chunk_count; k++) {
+        if ((seg->shared_chunks & ((uint64_t) 1 << k)) == 0) continue;
+
+        const list_status err = list_segmented_own_chunk(seg, k);
+        if (err != LIST_OK) return err;
+    }
+
+    return LIST_OK;
+}
+
+static size_t list_segmented_chunk_capacity(const list_segmented* seg, const size_t k) {
+    return (size_t) 1 << (seg->first_chunk_shift + k);
+}
+
+static size_t list_segmented_chunk_start(const list_segmented* seg, const size_t k) {
+    return (((size_t) 1 << k) - 1) << seg->first_chunk_shift;
+}
+
+static uint8_t* list_segmented_slot(const list_segmented* seg, const size_t index) {
+    size_t k;
+    size_t offset;
+    list_chunk_locate(seg->first_chunk_shift, index, &k, &offset);
+    return seg->chunks[k] + offset * seg->elem_size;
+}
+
+static list_segmented_chunk_header* list_segmented_header(uint8_t* chunk) {
+    return (list_segmented_chunk_header*) (chunk - sizeof(list_segmented_chunk_header));
+}
+
+static uint8_t* list_segmented_chunk_alloc(const list_segmented* seg, const size_t k) {
+    const size_t chunk_capacity = list_segmented_chunk_capacity(seg, k);
+    if (chunk_capacity > (SIZE_MAX - sizeof(list_segmented_chunk_header)) / seg->elem_size) return nullptr;
+
+    list_segmented_chunk_header* header = malloc(sizeof *header + chunk_capacity * seg->elem_size);
+    if (header == nullptr) return nullptr;
+
+    atomic_init(&header->refs, 1);
+    return (uint8_t*) (header + 1);
+}
+
+static void list_segmented_chunk_release(uint8_t* chunk) {
+    list_segmented_chunk_header* header = list_segmented_header(chunk);
+
+    // Release publishes this holder's reads; acquire makes everyone else's visible to the last one
+    if (atomic_fetch_sub_explicit(&header->refs, 1, memory_order_acq_rel) == 1) free(header);
+}
+
+static list_status list_segmented_own_chunk(list_segmented* seg, const size_t k) {
+    uint8_t* chunk = seg->chunks[k];
+
+    // Acquire pairs with the release of the other holders, whose reads must finish before we write
+    if (atomic_load_explicit(&list_segmented_header(chunk)->refs, memory_order_acquire) > 1) {
+        uint8_t* copy = list_segmented_chunk_alloc(seg, k);
+        if (copy == nullptr) return list_fail(nullptr, LIST_ERR_ALLOC);
+
+        const size_t start = list_segmented_chunk_start(seg, k);
+        const size_t capacity = list_segmented_chunk_capacity(seg, k);
+        const size_t used = seg->size <= start ? 0 : seg->size - start;
+        memcpy(copy, chunk, (used < capacity ? used : capacity) * seg->elem_size);
+
+        list_segmented_chunk_release(chunk);
+        seg->chunks[k] = copy;
+    }
+
+    seg->shared_chunks &= ~((uint64_t) 1 << k);
+    return LIST_OK;
+}
@@ -0,0 +1,308 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "list_serialize.h"
+#include "list_internal.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <errno.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define LIST_SERIALIZE_HAVE_FD 1
+#endif
+
+/**
+ * @brief Identifies a serialized list ("LSTB" in little-endian byte order).
+ * @internal
+ */
+#define LIST_SERIALIZE_MAGIC UINT32_C(0x4254534c)
+
+/**
+ * @brief The header that precedes every serialized list.
+ * @internal
+ */
+typedef struct list_serialize_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint64_t elem_size;
+    uint64_t count;
+    uint64_t checksum;
+} list_serialize_header;
+
+/**
+ * @defgroup list_serialize_internal Internal Serialization Functions
+ * @brief Helper functions used internally by the serialization implementation.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_serialize_internal
+ * @brief Computes the 64-bit FNV-1a hash of a buffer.
+ * @internal
+ */
+static uint64_t list_serialize_checksum(const void* data, size_t size);
+
+/**
+ * @ingroup list_serialize_internal
+ * @brief Fills in the header describing a list.
+ * @internal
+ *
+ * @return `LIST_OK` on success, `LIST_ERR_INVALID` on unknown flags.
+ */
+static list_status list_serialize_make_header(const list* lst, unsigned flags, list_serialize_header* out_header);
+
+/**
+ * @ingroup list_serialize_internal
+ * @brief Validates a header read from a buffer or stream.
+ * @internal
+ *
+ * @param header The header to check.
+ * @param out_payload_size Receives the size of the payload that follows it in bytes.
+ * @return `LIST_OK` if the header is valid, `LIST_ERR_INVALID` otherwise.
+ */
+static list_status list_serialize_check_header(const list_serialize_header* header, size_t* out_payload_size);
+
+/**
+ * @ingroup list_serialize_internal
+ * @brief Checks the payload against the stored checksum, if there is one.
+ * @internal
+ */
+static bool list_serialize_checksum_matches(const list_serialize_header* header, const void* payload, size_t size);
+
+#if defined(LIST_SERIALIZE_HAVE_FD)
+/**
+ * @ingroup list_serialize_internal
+ * @brief Reads exactly `size` bytes, retrying on short reads and interrupts.
+ * @internal
+ *
+ * @return `true` on success, `false` on error or end of file.
+ */
+static bool list_serialize_read_all(int fd, void* buffer, size_t size);
+#endif
+
+/** @} */ // end of list_serialize_internal
+
+static_assert(sizeof(list_serialize_header) == LIST_SERIALIZE_HEADER_SIZE, "serialized header layout changed");
+
+size_t list_serialized_size(const list* lst) {
+    if (lst == nullptr) return 0;
+    if (lst->size > (SIZE_MAX - LIST_SERIALIZE_HEADER_SIZE) / lst->elem_size) return 0;
+
+    return LIST_SERIALIZE_HEADER_SIZE + lst->size * lst->elem_size;
+}
+
+list_status list_save(
+    const list* lst,
+    void* buffer,
+    const size_t buffer_size,
+    const unsigned flags,
+    size_t* out_written)
+{
+    if (lst == nullptr || buffer == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    const size_t total = list_serialized_size(lst);
+    if (total == 0 || buffer_size < total) return list_fail(lst, LIST_ERR_INVALID);
+
+    list_serialize_header header;
+    const list_status err = list_serialize_make_header(lst, flags, &header);
+    if (err != LIST_OK) return err;
+
+    memcpy(buffer, &header, sizeof header);
+    if (lst->size > 0) {
+        memcpy((uint8_t*) buffer + sizeof header, lst->data, lst->size * lst->elem_size);
+    }
+
+    if (out_written != nullptr) *out_written = total;
+    return LIST_OK;
+}
+
+list_status list_load(list* lst, const void* buffer, const size_t buffer_size) {
+    if (lst == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    list_view view;
+    list_status err = list_view_from_buffer(&view, buffer, buffer_size);
+    if (err != LIST_OK) return err;
+
+    err = list_init_with_capacity(lst, view.size, view.elem_size);
+    if (err != LIST_OK) return err;
+
+    return list_push_n(lst, view.data, view.size);
+}
+
+list_status list_view_from_buffer(list_view* view, const void* buffer, const size_t buffer_size) {
+    if (view == nullptr || buffer == nullptr || buffer_size < LIST_SERIALIZE_HEADER_SIZE) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    list_serialize_header header;
+    memcpy(&header, buffer, sizeof header);
+
+    size_t payload_size;
+    const list_status err = list_serialize_check_header(&header, &payload_size);
+    if (err != LIST_OK) return err;
+    if (payload_size > buffer_size - sizeof header) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    const uint8_t* payload = (const uint8_t*) buffer + sizeof header;
+    if (!list_serialize_checksum_matches(&header, payload, payload_size)) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    view->data = payload;
+    view->size = (size_t) header.count;
+    view->elem_size = (size_t) header.elem_size;
+    return LIST_OK;
+}
+
+list_view list_view_of(const list* lst) {
+    if (lst == nullptr) return (list_view) { .data = nullptr, .size = 0, .elem_size = 0 };
+    return (list_view) { .data = lst->data, .size = lst->size, .elem_size = lst->elem_size };
+}
+
+const void* list_view_at(const list_view* view, const size_t index) {
+    if (view == nullptr || view->data == nullptr || index >= view->size) return nullptr;
+    return (const uint8_t*) view->data + index * view->elem_size;
+}
+
+#if defined(LIST_SERIALIZE_HAVE_FD)
+
+list_status list_write_fd(const list* lst, const int fd, const unsigned flags) {
+    if (lst == nullptr || fd < 0 || list_serialized_size(lst) == 0) return list_fail(lst, LIST_ERR_INVALID);
+
+    list_serialize_header header;
+    const list_status err = list_serialize_make_header(lst, flags, &header);
+    if (err != LIST_OK) return err;
+
+    struct iovec parts[2] = {
+        { .iov_base = &header,    .iov_len = sizeof header },
+        { .iov_base = lst->data,  .iov_len = lst->size * lst->elem_size },
+    };
+    struct iovec* pending = parts;
+    int pending_count = lst->size > 0 ? 2 : 1;
+
+    while (pending_count > 0) {
+        const ssize_t written = writev(fd, pending, pending_count);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return list_fail(lst, LIST_ERR_IO);
+        }
+
+        // Skip whatever the descriptor accepted and resubmit the rest
+        size_t done = (size_t) written;
+        while (pending_count > 0 && done >= pending->iov_len) {
+            done -= pending->iov_len;
+            pending++;
+            pending_count--;
+        }
+        if (pending_count > 0) {
+            pending->iov_base = (uint8_t*) pending->iov_base + done;
+            pending->iov_len -= done;
+        }
+    }
+
+    return LIST_OK;
+}
+
+list_status list_read_fd(list* lst, const int fd) {
+    if (lst == nullptr || fd < 0) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    list_serialize_header header;
+    if (!list_serialize_read_all(fd, &header, sizeof header)) return list_fail(nullptr, LIST_ERR_IO);
+
+    size_t payload_size;
+    list_status err = list_serialize_check_header(&header, &payload_size);
+    if (err != LIST_OK) return err;
+
+    err = list_init_with_capacity(lst, (size_t) header.count, (size_t) header.elem_size);
+    if (err != LIST_OK) return err;
+
+    if (!list_serialize_read_all(fd, lst->data, payload_size)) {
+        list_destroy(lst);
+        return list_fail(nullptr, LIST_ERR_IO);
+    }
+    if (!list_serialize_checksum_matches(&header, lst->data, payload_size)) {
+        list_destroy(lst);
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    lst->size = (size_t) header.count;
+    return LIST_OK;
+}
+
+static bool list_serialize_read_all(const int fd, void* buffer, const size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        const ssize_t n = read(fd, (uint8_t*) buffer + done, size - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        done += (size_t) n;
+    }
+    return true;
+}
+
+#else
+
+list_status list_write_fd(const list* lst, [[maybe_unused]] const int fd, [[maybe_unused]] const unsigned flags) {
+    return list_fail(lst, LIST_ERR_IO);
+}
+
+list_status list_read_fd([[maybe_unused]] list* lst, [[maybe_unused]] const int fd) {
+    return list_fail(nullptr, LIST_ERR_IO);
+}
+
+#endif
+
+static uint64_t list_serialize_checksum(const void* data, const size_t size) {
+    const uint8_t* bytes = data;
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+static list_status list_serialize_make_header(
+    const list* lst,
+    const unsigned flags,
+    list_serialize_header* out_header)
+{
+    if ((flags & ~LIST_SERIALIZE_CHECKSUM) != 0) return list_fail(lst, LIST_ERR_INVALID);
+
+    *out_header = (list_serialize_header) {
+        .magic     = LIST_SERIALIZE_MAGIC,
+        .version   = LIST_SERIALIZE_VERSION,
+        .flags     = (uint16_t) flags,
+        .elem_size = lst->elem_size,
+        .count     = lst->size,
+        .checksum  = 0,
+    };
+    if ((flags & LIST_SERIALIZE_CHECKSUM) != 0) {
+        out_header->checksum = list_serialize_checksum(lst->data, lst->size * lst->elem_size);
+    }
+
+    return LIST_OK;
+}
+
+static list_status list_serialize_check_header(const list_serialize_header* header, size_t* out_payload_size) {
+    if (header->magic != LIST_SERIALIZE_MAGIC || header->version != LIST_SERIALIZE_VERSION) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+    if ((header->flags & ~LIST_SERIALIZE_CHECKSUM) != 0 || header->elem_size == 0 || header->elem_size > SIZE_MAX) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+    if (header->count > (SIZE_MAX - LIST_SERIALIZE_HEADER_SIZE) / header->elem_size) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    *out_payload_size = (size_t) (header->count * header->elem_size);
+    return LIST_OK;
+}
+
+static bool list_serialize_checksum_matches(
+    const list_serialize_header* header,
+    const void* payload,
+    const size_t size)
+{
+    if ((header->flags & LIST_SERIALIZE_CHECKSUM) == 0) return true;
+    return list_serialize_checksum(payload, size) == header->checksum;
+}
@@ -0,0 +1,690 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list.h"
+#include "list_internal.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#if defined(__SSE2__) || defined(_M_X64)
+#define LIST_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__)
+#define LIST_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define LIST_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief Size in bytes of the widest vector used by any kernel.
+ */
+#define LIST_SIMD_MAX_VECTOR 32
+
+/**
+ * @brief One set of search and fill kernels.
+ * @internal
+ *
+ * The vector kernels only handle element sizes of 1, 2, 4 and 8 bytes and
+ * receive `value` already repeated across a `LIST_SIMD_MAX_VECTOR`-byte
+ * pattern, so that each vector can be loaded straight from it.
+ *
+ * @var list_simd_kernels::name
+ *      Name reported by `list_simd_backend` and matched against `LIST_SIMD`.
+ */
+typedef struct list_simd_kernels {
+    const char* name;
+    size_t    (*find)(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* pattern);
+    size_t    (*count)(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* pattern);
+    void      (*fill)(uint8_t* dst, size_t count, size_t elem_size, const uint8_t* pattern);
+    void      (*unpack128)(const uint32_t* words, unsigned width, uint32_t* out);
+} list_simd_kernels;
+
+/**
+ * @defgroup list_simd_internal Internal SIMD Functions
+ * @brief Kernels behind `list_find`, `list_count`, `list_fill` and `list_packed`, and their dispatch.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Gets the kernels for the running CPU, selecting them on first use.
+ * @internal
+ *
+ * The best supported tier is used unless the `LIST_SIMD` environment
+ * variable names another supported one.
+ */
+static const list_simd_kernels* list_simd_kernels_get(void);
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Checks whether the vector kernels handle an element size.
+ * @internal
+ */
+static bool list_simd_vectorizable(size_t elem_size);
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Repeats one element across a `LIST_SIMD_MAX_VECTOR`-byte pattern.
+ * @internal
+ */
+static void list_simd_broadcast(uint8_t* pattern, size_t elem_size, const void* value);
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Index of the lowest set bit of a non-zero mask.
+ * @internal
+ */
+static unsigned list_simd_ctz(uint64_t mask);
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Number of set bits in a mask.
+ * @internal
+ */
+static unsigned list_simd_popcount(uint64_t mask);
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Element-by-element search, used for odd element sizes and vector tails.
+ * @internal
+ */
+static size_t list_simd_scalar_find(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* value);
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Element-by-element count, used for odd element sizes and vector tails.
+ * @internal
+ */
+static size_t list_simd_scalar_count(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* value);
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Fills by copying the first element, then doubling the filled prefix.
+ * @internal
+ */
+static void list_simd_scalar_fill(uint8_t* dst, size_t count, size_t elem_size, const uint8_t* value);
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Unpacks one 128-value block lane by lane.
+ * @internal
+ */
+static void list_simd_scalar_unpack128(const uint32_t* words, unsigned width, uint32_t* out);
+
+#if defined(LIST_SIMD_SSE2)
+static size_t list_simd_sse2_find(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* pattern);
+static size_t list_simd_sse2_count(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* pattern);
+static void list_simd_sse2_fill(uint8_t* dst, size_t count, size_t elem_size, const uint8_t* pattern);
+static void list_simd_sse2_unpack128(const uint32_t* words, unsigned width, uint32_t* out);
+#endif
+
+#if defined(LIST_SIMD_AVX2)
+static size_t list_simd_avx2_find(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* pattern);
+static size_t list_simd_avx2_count(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* pattern);
+static void list_simd_avx2_fill(uint8_t* dst, size_t count, size_t elem_size, const uint8_t* pattern);
+static void list_simd_avx2_unpack128(const uint32_t* words, unsigned width, uint32_t* out);
+#endif
+
+#if defined(LIST_SIMD_NEON)
+static size_t list_simd_neon_find(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* pattern);
+static size_t list_simd_neon_count(const uint8_t* data, size_t count, size_t elem_size, const uint8_t* pattern);
+static void list_simd_neon_fill(uint8_t* dst, size_t count, size_t elem_size, const uint8_t* pattern);
+static void list_simd_neon_unpack128(const uint32_t* words, unsigned width, uint32_t* out);
+#endif
+
+/** @} */
+
+static const list_simd_kernels list_simd_scalar_kernels = {
+    "scalar", list_simd_scalar_find, list_simd_scalar_count, list_simd_scalar_fill, list_simd_scalar_unpack128
+};
+
+#if defined(LIST_SIMD_SSE2)
+static const list_simd_kernels list_simd_sse2_kernels = {
+    "sse2", list_simd_sse2_find, list_simd_sse2_count, list_simd_sse2_fill, list_simd_sse2_unpack128
+};
+#endif
+
+#if defined(LIST_SIMD_AVX2)
+static const list_simd_kernels list_simd_avx2_kernels = {
+    "avx2", list_simd_avx2_find, list_simd_avx2_count, list_simd_avx2_fill, list_simd_avx2_unpack128
+};
+#endif
+
+#if defined(LIST_SIMD_NEON)
+static const list_simd_kernels list_simd_neon_kernels = {
+    "neon", list_simd_neon_find, list_simd_neon_count, list_simd_neon_fill, list_simd_neon_unpack128
+};
+#endif
+
+static _Atomic(const list_simd_kernels*) list_simd_active = nullptr;
+
+size_t list_simd_find(const void* data, const size_t count, const size_t elem_size, const void* value) {
+    if (count == 0) return LIST_NOT_FOUND;
+    if (!list_simd_vectorizable(elem_size)) return list_simd_scalar_find(data, count, elem_size, value);
+
+    alignas(LIST_SIMD_MAX_VECTOR) uint8_t pattern[LIST_SIMD_MAX_VECTOR];
+    list_simd_broadcast(pattern, elem_size, value);
+
+    return list_simd_kernels_get()->find(data, count, elem_size, pattern);
+}
+
+size_t list_simd_count(const void* data, const size_t count, const size_t elem_size, const void* value) {
+    if (count == 0) return 0;
+    if (!list_simd_vectorizable(elem_size)) return list_simd_scalar_count(data, count, elem_size, value);
+
+    alignas(LIST_SIMD_MAX_VECTOR) uint8_t pattern[LIST_SIMD_MAX_VECTOR];
+    list_simd_broadcast(pattern, elem_size, value);
+
+    return list_simd_kernels_get()->count(data, count, elem_size, pattern);
+}
+
+void list_simd_fill(void* dst, const size_t count, const size_t elem_size, const void* value) {
+    if (count == 0) return;
+    if (!list_simd_vectorizable(elem_size)) {
+        list_simd_scalar_fill(dst, count, elem_size, value);
+        return;
+    }
+
+    alignas(LIST_SIMD_MAX_VECTOR) uint8_t pattern[LIST_SIMD_MAX_VECTOR];
+    list_simd_broadcast(pattern, elem_size, value);
+
+    list_simd_kernels_get()->fill(dst, count, elem_size, pattern);
+}
+
+void list_simd_unpack128(const uint32_t* words, const unsigned width, uint32_t* out) {
+    if (width == 0) {
+        memset(out, 0, LIST_SIMD_PACK_BLOCK * sizeof *out);
+        return;
+    }
+
+    list_simd_kernels_get()->unpack128(words, width, out);
+}
+
+const char* list_simd_backend(void) {
+    return list_simd_kernels_get()->name;
+}
+
+static const list_simd_kernels* list_simd_kernels_get(void) {
+    const list_simd_kernels* active = atomic_load_explicit(&list_simd_active, memory_order_acquire);
+    if (active != nullptr) return active;
+
+    // Supported tiers, best first
+    const list_simd_kernels* tiers[4];
+    size_t tier_count = 0;
+
+#if defined(LIST_SIMD_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) tiers[tier_count++] = &list_simd_avx2_kernels;
+#endif
+#if defined(LIST_SIMD_SSE2)
+    tiers[tier_count++] = &list_simd_sse2_kernels;
+#endif
+#if defined(LIST_SIMD_NEON)
+    tiers[tier_count++] = &list_simd_neon_kernels;
+#endif
+    tiers[tier_count++] = &list_simd_scalar_kernels;
+
+    active = tiers[0];
+
+    const char* forced = getenv("LIST_SIMD");
+    if (forced != nullptr) {
+        for (size_t i = 0; i < tier_count; i++) {
+            if (strcmp(forced, tiers[i]->name) == 0) {
+                active = tiers[i];
+                break;
+            }
+        }
+    }
+
+    // Racing first calls select the same kernels, so the last store wins harmlessly
+    atomic_store_explicit(&list_simd_active, active, memory_order_release);
+    return active;
+}
+
+static bool list_simd_vectorizable(const size_t elem_size) {
+    return elem_size == 1 || elem_size == 2 || elem_size == 4 || elem_size == 8;
+}
+
+static void list_simd_broadcast(uint8_t* pattern, const size_t elem_size, const void* value) {
+    for (size_t offset = 0; offset < LIST_SIMD_MAX_VECTOR; offset += elem_size) {
+        memcpy(pattern + offset, value, elem_size);
+    }
+}
+
+static unsigned list_simd_ctz(const uint64_t mask) {
+#if defined(__GNUC__)
+    return (unsigned) __builtin_ctzll(mask);
+#else
+    unsigned result = 0;
+    while (((mask >> result) & 1) == 0) result++;
+    return result;
+#endif
+}
+
+static unsigned list_simd_popcount(uint64_t mask) {
+#if defined(__GNUC__)
+    return (unsigned) __builtin_popcountll(mask);
+#else
+    unsigned result = 0;
+    for (; mask != 0; mask &= mask - 1) result++;
+    return result;
+#endif
+}
+
+// Word-sized elements are compared as integers, which compilers vectorize
+// far better than a memcmp per element
+#define LIST_SIMD_SCALAR_SCAN(type, on_match)                  \
+    do {                                                        \
+        type needle;                                            \
+        memcpy(&needle, value, sizeof needle);                  \
+        for (size_t i = 0; i < count; i++) {                    \
+            type element;                                       \
+            memcpy(&element, data + i * sizeof element, sizeof element); \
+            if (element == needle) { on_match; }                \
+        }                                                       \
+    } while (0)
+
+static size_t list_simd_scalar_find(const uint8_t* data, const size_t count, const size_t elem_size, const uint8_t* value) {
+    switch (elem_size) {
+        case 1: {
+            const uint8_t* match = memchr(data, *value, count);
+            return match == nullptr ? LIST_NOT_FOUND : (size_t) (match - data);
+        }
+        case 2: LIST_SIMD_SCALAR_SCAN(uint16_t, return i); break;
+        case 4: LIST_SIMD_SCALAR_SCAN(uint32_t, return i); break;
+        case 8: LIST_SIMD_SCALAR_SCAN(uint64_t, return i); break;
+        default:
+            for (size_t i = 0; i < count; i++) {
+                if (memcmp(data + i * elem_size, value, elem_size) == 0) return i;
+            }
+    }
+
+    return LIST_NOT_FOUND;
+}
+
+static size_t list_simd_scalar_count(const uint8_t* data, const size_t count, const size_t elem_size, const uint8_t* value) {
+    size_t matches = 0;
+
+    switch (elem_size) {
+        case 1: LIST_SIMD_SCALAR_SCAN(uint8_t, matches++); break;
+        case 2: LIST_SIMD_SCALAR_SCAN(uint16_t, matches++); break;
+        case 4: LIST_SIMD_SCALAR_SCAN(uint32_t, matches++); break;
+        case 8: LIST_SIMD_SCALAR_SCAN(uint64_t, matches++); break;
+        default:
+            for (size_t i = 0; i < count; i++) {
+                matches += memcmp(data + i * elem_size, value, elem_size) == 0;
+            }
+    }
+
+    return matches;
+}
+
+#undef LIST_SIMD_SCALAR_SCAN
+
+static void list_simd_scalar_fill(uint8_t* dst, const size_t count, const size_t elem_size, const uint8_t* value) {
+    const size_t bytes = count * elem_size;
+    size_t filled = elem_size;
+
+    memcpy(dst, value, elem_size);
+
+    while (filled < bytes) {
+        const size_t chunk = filled < bytes - filled ? filled : bytes - filled;
+        memcpy(dst + filled, dst, chunk);
+        filled += chunk;
+    }
+}
+
+static void list_simd_scalar_unpack128(const uint32_t* words, const unsigned width, uint32_t* out) {
+    const uint32_t mask = width == 32 ? UINT32_MAX : ((uint32_t) 1 << width) - 1;
+
+    for (unsigned step = 0; step < LIST_SIMD_PACK_BLOCK / 4; step++) {
+        const unsigned bit = step * width;
+        const unsigned word = bit / 32;
+        const unsigned shift = bit % 32;
+
+        for (unsigned lane = 0; lane < 4; lane++) {
+            uint32_t value = words[word * 4 + lane] >> shift;
+            if (shift + width > 32) value |= words[(word + 1) * 4 + lane] << (32 - shift);
+            out[step * 4 + lane] = value & mask;
+        }
+    }
+}
+
+// The vector unpackers below are branch-free: a value that does not spill
+// into the next word ORs in bits above `width` (or none, for a 32-bit
+// shift), which the mask then clears. The next row is clamped to the last
+// one so the final steps never read past the block.
+
+#if defined(LIST_SIMD_SSE2)
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Compares 16 bytes element-wise; every byte of a matching element is set.
+ * @internal
+ *
+ * SSE2 has no 64-bit compare, so 8-byte elements match when both of their
+ * 32-bit halves do.
+ */
+static inline __m128i list_simd_sse2_cmpeq(const __m128i a, const __m128i b, const size_t elem_size) {
+    switch (elem_size) {
+        case 1: return _mm_cmpeq_epi8(a, b);
+        case 2: return _mm_cmpeq_epi16(a, b);
+        case 4: return _mm_cmpeq_epi32(a, b);
+        default: {
+            const __m128i halves = _mm_cmpeq_epi32(a, b);
+            return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+}
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Byte-match mask of 64 bytes, one bit per byte.
+ * @internal
+ */
+static inline uint64_t list_simd_sse2_mask64(const uint8_t* data, const __m128i needle, const size_t elem_size) {
+    uint64_t mask = 0;
+
+    for (unsigned v = 0; v < 4; v++) {
+        const __m128i chunk = _mm_loadu_si128((const __m128i*) (data + v * 16));
+        const uint64_t bits = (uint16_t) _mm_movemask_epi8(list_simd_sse2_cmpeq(chunk, needle, elem_size));
+        mask |= bits << (v * 16);
+    }
+
+    return mask;
+}
+
+static size_t list_simd_sse2_find(const uint8_t* data, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const __m128i needle = _mm_load_si128((const __m128i*) pattern);
+    const size_t bytes = count * elem_size;
+    size_t i = 0;
+
+    for (; i + 64 <= bytes; i += 64) {
+        const uint64_t mask = list_simd_sse2_mask64(data + i, needle, elem_size);
+        if (mask != 0) return (i + list_simd_ctz(mask)) / elem_size;
+    }
+
+    for (; i + 16 <= bytes; i += 16) {
+        const __m128i chunk = _mm_loadu_si128((const __m128i*) (data + i));
+        const uint64_t mask = (uint16_t) _mm_movemask_epi8(list_simd_sse2_cmpeq(chunk, needle, elem_size));
+        if (mask != 0) return (i + list_simd_ctz(mask)) / elem_size;
+    }
+
+    const size_t tail = list_simd_scalar_find(data + i, (bytes - i) / elem_size, elem_size, pattern);
+    return tail == LIST_NOT_FOUND ? LIST_NOT_FOUND : i / elem_size + tail;
+}
+
+static size_t list_simd_sse2_count(const uint8_t* data, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const __m128i needle = _mm_load_si128((const __m128i*) pattern);
+    const size_t bytes = count * elem_size;
+    size_t matched_bytes = 0;
+    size_t i = 0;
+
+    for (; i + 64 <= bytes; i += 64) {
+        matched_bytes += list_simd_popcount(list_simd_sse2_mask64(data + i, needle, elem_size));
+    }
+
+    for (; i + 16 <= bytes; i += 16) {
+        const __m128i chunk = _mm_loadu_si128((const __m128i*) (data + i));
+        matched_bytes += list_simd_popcount((uint16_t) _mm_movemask_epi8(list_simd_sse2_cmpeq(chunk, needle, elem_size)));
+    }
+
+    return matched_bytes / elem_size + list_simd_scalar_count(data + i, (bytes - i) / elem_size, elem_size, pattern);
+}
+
+static void list_simd_sse2_fill(uint8_t* dst, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const __m128i value = _mm_load_si128((const __m128i*) pattern);
+    const size_t bytes = count * elem_size;
+    size_t i = 0;
+
+    for (; i + 64 <= bytes; i += 64) {
+        _mm_storeu_si128((__m128i*) (dst + i), value);
+        _mm_storeu_si128((__m128i*) (dst + i + 16), value);
+        _mm_storeu_si128((__m128i*) (dst + i + 32), value);
+        _mm_storeu_si128((__m128i*) (dst + i + 48), value);
+    }
+
+    for (; i + 16 <= bytes; i += 16) {
+        _mm_storeu_si128((__m128i*) (dst + i), value);
+    }
+
+    // The remainder is whole elements, and the pattern starts on an element
+    memcpy(dst + i, pattern, bytes - i);
+}
+
+static void list_simd_sse2_unpack128(const uint32_t* words, const unsigned width, uint32_t* out) {
+    const __m128i mask = _mm_set1_epi32((int) (width == 32 ? UINT32_MAX : ((uint32_t) 1 << width) - 1));
+    const __m128i* rows = (const __m128i*) words;
+
+    for (unsigned step = 0; step < LIST_SIMD_PACK_BLOCK / 4; step++) {
+        const unsigned bit = step * width;
+        const unsigned word = bit / 32;
+        const unsigned shift = bit % 32;
+        const unsigned next = word + 1 < width ? word + 1 : word;
+
+        const __m128i low = _mm_srl_epi32(_mm_loadu_si128(rows + word), _mm_cvtsi32_si128((int) shift));
+        const __m128i high = _mm_sll_epi32(_mm_loadu_si128(rows + next), _mm_cvtsi32_si128((int) (32 - shift)));
+        _mm_storeu_si128((__m128i*) (out + step * 4), _mm_and_si128(_mm_or_si128(low, high), mask));
+    }
+}
+
+#endif
+
+#if defined(LIST_SIMD_AVX2)
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Compares 32 bytes element-wise; every byte of a matching element is set.
+ * @internal
+ */
+__attribute__((target("avx2")))
+static inline __m256i list_simd_avx2_cmpeq(const __m256i a, const __m256i b, const size_t elem_size) {
+    switch (elem_size) {
+        case 1: return _mm256_cmpeq_epi8(a, b);
+        case 2: return _mm256_cmpeq_epi16(a, b);
+        case 4: return _mm256_cmpeq_epi32(a, b);
+        default: return _mm256_cmpeq_epi64(a, b);
+    }
+}
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Byte-match mask of 32 bytes, one bit per byte.
+ * @internal
+ */
+__attribute__((target("avx2")))
+static inline uint64_t list_simd_avx2_mask32(const uint8_t* data, const __m256i needle, const size_t elem_size) {
+    const __m256i chunk = _mm256_loadu_si256((const __m256i*) data);
+    return (uint32_t) _mm256_movemask_epi8(list_simd_avx2_cmpeq(chunk, needle, elem_size));
+}
+
+__attribute__((target("avx2")))
+static size_t list_simd_avx2_find(const uint8_t* data, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const __m256i needle = _mm256_load_si256((const __m256i*) pattern);
+    const size_t bytes = count * elem_size;
+    size_t i = 0;
+
+    for (; i + 64 <= bytes; i += 64) {
+        const uint64_t mask = list_simd_avx2_mask32(data + i, needle, elem_size)
+                            | list_simd_avx2_mask32(data + i + 32, needle, elem_size) << 32;
+        if (mask != 0) return (i + list_simd_ctz(mask)) / elem_size;
+    }
+
+    if (i + 32 <= bytes) {
+        const uint64_t mask = list_simd_avx2_mask32(data + i, needle, elem_size);
+        if (mask != 0) return (i + list_simd_ctz(mask)) / elem_size;
+        i += 32;
+    }
+
+    const size_t tail = list_simd_scalar_find(data + i, (bytes - i) / elem_size, elem_size, pattern);
+    return tail == LIST_NOT_FOUND ? LIST_NOT_FOUND : i / elem_size + tail;
+}
+
+__attribute__((target("avx2")))
+static size_t list_simd_avx2_count(const uint8_t* data, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const __m256i needle = _mm256_load_si256((const __m256i*) pattern);
+    const size_t bytes = count * elem_size;
+    size_t matched_bytes = 0;
+    size_t i = 0;
+
+    for (; i + 64 <= bytes; i += 64) {
+        matched_bytes += list_simd_popcount(list_simd_avx2_mask32(data + i, needle, elem_size)
+                                          | list_simd_avx2_mask32(data + i + 32, needle, elem_size) << 32);
+    }
+
+    if (i + 32 <= bytes) {
+        matched_bytes += list_simd_popcount(list_simd_avx2_mask32(data + i, needle, elem_size));
+        i += 32;
+    }
+
+    return matched_bytes / elem_size + list_simd_scalar_count(data + i, (bytes - i) / elem_size, elem_size, pattern);
+}
+
+__attribute__((target("avx2")))
+static void list_simd_avx2_fill(uint8_t* dst, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const __m256i value = _mm256_load_si256((const __m256i*) pattern);
+    const size_t bytes = count * elem_size;
+    size_t i = 0;
+
+    for (; i + 64 <= bytes; i += 64) {
+        _mm256_storeu_si256((__m256i*) (dst + i), value);
+        _mm256_storeu_si256((__m256i*) (dst + i + 32), value);
+    }
+
+    if (i + 32 <= bytes) {
+        _mm256_storeu_si256((__m256i*) (dst + i), value);
+        i += 32;
+    }
+
+    memcpy(dst + i, pattern, bytes - i);
+}
+
+__attribute__((target("avx2")))
+static void list_simd_avx2_unpack128(const uint32_t* words, const unsigned width, uint32_t* out) {
+    const __m256i mask = _mm256_set1_epi32((int) (width == 32 ? UINT32_MAX : ((uint32_t) 1 << width) - 1));
+    const __m128i* rows = (const __m128i*) words;
+
+    // Two steps at a time: the low half unpacks `step`, the high half `step + 1`
+    for (unsigned step = 0; step < LIST_SIMD_PACK_BLOCK / 4; step += 2) {
+        unsigned word[2];
+        unsigned next[2];
+        int shift[2];
+        for (unsigned half = 0; half < 2; half++) {
+            const unsigned bit = (step + half) * width;
+            word[half] = bit / 32;
+            next[half] = word[half] + 1 < width ? word[half] + 1 : word[half];
+            shift[half] = (int) (bit % 32);
+        }
+
+        const __m256i low = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(rows + word[0])), _mm_loadu_si128(rows + word[1]), 1);
+        const __m256i high = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(rows + next[0])), _mm_loadu_si128(rows + next[1]), 1);
+        const __m256i right = _mm256_setr_epi32(
+            shift[0], shift[0], shift[0], shift[0], shift[1], shift[1], shift[1], shift[1]);
+        const __m256i left = _mm256_sub_epi32(_mm256_set1_epi32(32), right);
+
+        const __m256i value = _mm256_or_si256(_mm256_srlv_epi32(low, right), _mm256_sllv_epi32(high, left));
+        _mm256_storeu_si256((__m256i*) (out + step * 4), _mm256_and_si256(value, mask));
+    }
+}
+
+#endif
+
+#if defined(LIST_SIMD_NEON)
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Compares 16 bytes element-wise; every byte of a matching element is set.
+ * @internal
+ */
+static inline uint8x16_t list_simd_neon_cmpeq(const uint8x16_t a, const uint8x16_t b, const size_t elem_size) {
+    switch (elem_size) {
+        case 1: return vceqq_u8(a, b);
+        case 2: return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+        case 4: return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+        default: return vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(a), vreinterpretq_u64_u8(b)));
+    }
+}
+
+/**
+ * @ingroup list_simd_internal
+ * @brief Byte-match mask of 16 bytes, four bits per byte.
+ * @internal
+ *
+ * NEON has no movemask; narrowing each 16-bit lane by 4 bits keeps one
+ * nibble of every byte.
+ */
+static inline uint64_t list_simd_neon_mask16(const uint8_t* data, const uint8x16_t needle, const size_t elem_size) {
+    const uint8x16_t eq = list_simd_neon_cmpeq(vld1q_u8(data), needle, elem_size);
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+static size_t list_simd_neon_find(const uint8_t* data, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const uint8x16_t needle = vld1q_u8(pattern);
+    const size_t bytes = count * elem_size;
+    size_t i = 0;
+
+    for (; i + 16 <= bytes; i += 16) {
+        const uint64_t mask = list_simd_neon_mask16(data + i, needle, elem_size);
+        if (mask != 0) return (i + list_simd_ctz(mask) / 4) / elem_size;
+    }
+
+    const size_t tail = list_simd_scalar_find(data + i, (bytes - i) / elem_size, elem_size, pattern);
+    return tail == LIST_NOT_FOUND ? LIST_NOT_FOUND : i / elem_size + tail;
+}
+
+static size_t list_simd_neon_count(const uint8_t* data, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const uint8x16_t needle = vld1q_u8(pattern);
+    const size_t bytes = count * elem_size;
+    size_t matched_nibbles = 0;
+    size_t i = 0;
+
+    for (; i + 16 <= bytes; i += 16) {
+        matched_nibbles += list_simd_popcount(list_simd_neon_mask16(data + i, needle, elem_size));
+    }
+
+    return matched_nibbles / 4 / elem_size + list_simd_scalar_count(data + i, (bytes - i) / elem_size, elem_size, pattern);
+}
+
+static void list_simd_neon_fill(uint8_t* dst, const size_t count, const size_t elem_size, const uint8_t* pattern) {
+    const uint8x16_t value = vld1q_u8(pattern);
+    const size_t bytes = count * elem_size;
+    size_t i = 0;
+
+    for (; i + 64 <= bytes; i += 64) {
+        vst1q_u8(dst + i, value);
+        vst1q_u8(dst + i + 16, value);
+        vst1q_u8(dst + i + 32, value);
+        vst1q_u8(dst + i + 48, value);
+    }
+
+    for (; i + 16 <= bytes; i += 16) {
+        vst1q_u8(dst + i, value);
+    }
+
+    memcpy(dst + i, pattern, bytes - i);
+}
+
+static void list_simd_neon_unpack128(const uint32_t* words, const unsigned width, uint32_t* out) {
+    const uint32x4_t mask = vdupq_n_u32(width == 32 ? UINT32_MAX : ((uint32_t) 1 << width) - 1);
+
+    for (unsigned step = 0; step < LIST_SIMD_PACK_BLOCK / 4; step++) {
+        const unsigned bit = step * width;
+        const unsigned word = bit / 32;
+        const unsigned shift = bit % 32;
+        const unsigned next = word + 1 < width ? word + 1 : word;
+
+        // vshlq shifts right for negative counts and clears lanes shifted by 32
+        const uint32x4_t low = vshlq_u32(vld1q_u32(words + word * 4), vdupq_n_s32(-(int32_t) shift));
+        const uint32x4_t high = vshlq_u32(vld1q_u32(words + next * 4), vdupq_n_s32((int32_t) (32 - shift)));
+        vst1q_u32(out + step * 4, vandq_u32(vorrq_u32(low, high), mask));
+    }
+}
+
+#endif
@@ -0,0 +1,236 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list_snapshot.h"
+#include "list_internal.h"
+
+/**
+ * @brief A buffer shared by a list and its snapshots.
+ * @internal
+ *
+ * Every holder points its `allocator` at the block, which is how
+ * `list_is_shared` recognizes a shared buffer without a field in `list`.
+ *
+ * @var list_shared_block::allocator
+ *      The allocator installed in every holder; its context is this block.
+ *
+ * @var list_shared_block::refs
+ *      The number of lists holding `data`.
+ *
+ * @var list_shared_block::data
+ *      The shared buffer.
+ *
+ * @var list_shared_block::bytes
+ *      Size of the shared buffer in bytes.
+ *
+ * @var list_shared_block::underlying
+ *      The allocator the buffer came from, restored in a holder once it detaches.
+ */
+typedef struct list_shared_block {
+    list_allocator        allocator;
+    atomic_size_t         refs;
+    void*                 data;
+    size_t                bytes;
+    const list_allocator* underlying;
+} list_shared_block;
+
+/**
+ * @defgroup list_snapshot_internal Internal Snapshot Functions
+ * @brief Helper functions used internally by the copy-on-write snapshots.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_snapshot_internal
+ * @brief Gets the shared block behind a list for which `list_is_shared` holds.
+ * @internal
+ */
+static list_shared_block* list_shared_block_of(const list* lst);
+
+/**
+ * @ingroup list_snapshot_internal
+ * @brief Moves a list's buffer into a new shared block with a single holder.
+ * @internal
+ *
+ * Inline storage cannot be reached from other lists, so its elements are
+ * copied to the heap first.
+ *
+ * @return `LIST_OK` on success, `LIST_ERR_ALLOC` if allocation fails.
+ */
+static list_status list_shared_wrap(list* lst);
+
+/**
+ * @ingroup list_snapshot_internal
+ * @brief Drops one reference to a block, freeing it once the last holder lets go.
+ * @internal
+ *
+ * The shared buffer is freed along with the block unless it is `kept`,
+ * which is how the last holder takes the buffer back without copying.
+ */
+static void list_shared_release(list_shared_block* block, const void* kept);
+
+static void* list_shared_realloc_cb(void* ctx, void* ptr, size_t old_size, size_t new_size);
+static void  list_shared_free_cb(void* ctx, void* ptr, size_t size);
+
+/** @} */ // end of list_snapshot_internal
+
+list_status list_snapshot(list* src, list* out) {
+    if (src == nullptr || out == nullptr || src == out || list_is_mapped(src)) return list_fail(src, LIST_ERR_INVALID);
+
+    if (src->data != nullptr && !list_is_shared(src)) {
+        const list_status err = list_shared_wrap(src);
+        if (err != LIST_OK) return err;
+    }
+
+    // Only a holder can take a new reference, so relaxed ordering is enough
+    if (list_is_shared(src)) atomic_fetch_add_explicit(&list_shared_block_of(src)->refs, 1, memory_order_relaxed);
+
+    *out = *src;
+#ifdef LIST_ENABLE_STATS
+    list_stats_reset(out);
+#endif
+
+    return LIST_OK;
+}
+
+list_status list_unshare(list* lst) {
+    if (lst == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+    if (!list_is_shared(lst)) return LIST_OK;
+
+    list_shared_block* block = list_shared_block_of(lst);
+    const list_allocator* underlying = block->underlying;
+
+    // Acquire pairs with the release of the other holders, whose reads must finish before we write
+    if (lst->data == block->data && atomic_load_explicit(&block->refs, memory_order_acquire) > 1) {
+        const size_t bytes = lst->capacity * lst->elem_size;
+        const size_t used = lst->size * lst->elem_size;
+
+        uint8_t* copy = underlying == nullptr ? malloc(bytes) : underlying->alloc(underlying->ctx, bytes);
+        if (copy == nullptr) return list_fail(lst, LIST_ERR_ALLOC);
+
+        memcpy(copy, lst->data, used);
+        if ((lst->flags & LIST_FLAG_ZERO_FILL) != 0) {
+            memset(copy + used, 0, bytes - used);
+            LIST_STATS_ZERO(lst, bytes - used);
+        }
+        LIST_STATS_RESIZE(lst, bytes, bytes, true);
+
+        lst->data = copy;
+    }
+
+    lst->allocator = underlying;
+    list_shared_release(block, lst->data);
+
+    return LIST_OK;
+}
+
+bool list_shares_buffer(const list* lst) {
+    if (lst == nullptr || !list_is_shared(lst)) return false;
+
+    const list_shared_block* block = list_shared_block_of(lst);
+    return lst->data == block->data && atomic_load_explicit(&block->refs, memory_order_acquire) > 1;
+}
+
+void list_shared_drop(list* lst) {
+    list_shared_block* block = list_shared_block_of(lst);
+
+    lst->allocator = block->underlying;
+    if (lst->data == block->data) lst->data = nullptr;
+    list_shared_release(block, lst->data);
+}
+
+void list_shared_forget(list* lst) {
+    lst->allocator = list_shared_block_of(lst)->underlying;
+}
+
+void* list_snapshot_alloc_cb_(void* ctx, const size_t size) {
+    const list_shared_block* block = ctx;
+
+    if (block->underlying == nullptr) return malloc(size);
+    return block->underlying->alloc(block->underlying->ctx, size);
+}
+
+static list_shared_block* list_shared_block_of(const list* lst) {
+    return lst->allocator->ctx;
+}
+
+static list_status list_shared_wrap(list* lst) {
+    list_shared_block* block = malloc(sizeof *block);
+    if (block == nullptr) return list_fail(lst, LIST_ERR_ALLOC);
+
+    const size_t bytes = lst->capacity * lst->elem_size;
+    void* data = lst->data;
+
+#if LIST_INLINE_BYTES > 0
+    if (data == lst->inline_data) {
+        data = malloc(bytes);
+        if (data == nullptr) {
+            free(block);
+            return list_fail(lst, LIST_ERR_ALLOC);
+        }
+        memcpy(data, lst->inline_data, bytes);
+        LIST_STATS_RESIZE(lst, bytes, bytes, true);
+    }
+#endif
+
+    block->allocator = (list_allocator) {
+        .alloc   = list_snapshot_alloc_cb_,
+        .realloc = list_shared_realloc_cb,
+        .free    = list_shared_free_cb,
+        .ctx     = block,
+    };
+    atomic_init(&block->refs, 1);
+    block->data = data;
+    block->bytes = bytes;
+    block->underlying = lst->allocator;
+
+    lst->data = data;
+    lst->allocator = &block->allocator;
+
+    return LIST_OK;
+}
+
+static void list_shared_release(list_shared_block* block, const void* kept) {
+    // Release publishes this holder's reads; acquire makes everyone else's visible to the last one
+    if (atomic_fetch_sub_explicit(&block->refs, 1, memory_order_acq_rel) != 1) return;
+
+    if (block->data != kept) {
+        const list_allocator* underlying = block->underlying;
+        if (underlying == nullptr) {
+            free(block->data);
+        } else {
+            underlying->free(underlying->ctx, block->data, block->bytes);
+        }
+    }
+    free(block);
+}
+
+// Every mutating list_ function detaches before resizing, so the callbacks
+// below only see the shared buffer if the list was written behind their back
+
+static void* list_shared_realloc_cb(void* ctx, void* ptr, const size_t old_size, const size_t new_size) {
+    const list_shared_block* block = ctx;
+
+    if (ptr != block->data) {
+        if (block->underlying == nullptr) return realloc(ptr, new_size);
+        return block->underlying->realloc(block->underlying->ctx, ptr, old_size, new_size);
+    }
+
+    // The other holders still read the shared buffer, so move to a fresh one
+    void* moved = list_snapshot_alloc_cb_(ctx, new_size);
+    if (moved != nullptr) memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    return moved;
+}
+
+static void list_shared_free_cb(void* ctx, void* ptr, const size_t size) {
+    const list_shared_block* block = ctx;
+
+    if (ptr == block->data) return;
+    if (block->underlying == nullptr) {
+        free(ptr);
+    } else {
+        block->underlying->free(block->underlying->ctx, ptr, size);
+    }
+}
@@ -0,0 +1,143 @@
+#include <stdint.h>
+#include <string.h>
+#include "list_soa.h"
+#include "list_internal.h"
+
+list_status list_soa_init(list_soa* soa, const list_soa_field* fields, const size_t field_count) {
+    return list_soa_init_with_capacity(soa, fields, field_count, 0);
+}
+
+list_status list_soa_init_with_capacity(
+    list_soa* soa,
+    const list_soa_field* fields,
+    const size_t field_count,
+    const size_t capacity)
+{
+    if (soa == nullptr || fields == nullptr || field_count == 0 || field_count > LIST_SOA_MAX_FIELDS) {
+        return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    for (size_t f = 0; f < field_count; f++) {
+        if (fields[f].size == 0) return list_fail(nullptr, LIST_ERR_INVALID);
+    }
+
+    soa->field_count = 0;
+    soa->size = 0;
+
+    for (size_t f = 0; f < field_count; f++) {
+        const list_status err = list_init_with_capacity(&soa->columns[f], capacity, fields[f].size);
+        if (err != LIST_OK) {
+            list_soa_destroy(soa);
+            return err;
+        }
+        soa->offsets[f] = fields[f].offset;
+        soa->field_count++;
+    }
+
+    return LIST_OK;
+}
+
+void list_soa_destroy(list_soa* soa) {
+    if (soa == nullptr) return;
+
+    for (size_t f = 0; f < soa->field_count; f++) {
+        list_destroy(&soa->columns[f]);
+    }
+    soa->size = 0;
+}
+
+size_t list_soa_size(const list_soa* soa) {
+    return soa != nullptr ? soa->size : 0;
+}
+
+list_status list_soa_push(list_soa* soa, const void* row) {
+    if (soa == nullptr || row == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    // Reserve in every column first, so a failure leaves them all the same length
+    for (size_t f = 0; f < soa->field_count; f++) {
+        if (soa->columns[f].capacity > soa->size) continue;
+
+        const list_status err = list_ensure_capacity(&soa->columns[f], soa->size + 1);
+        if (err != LIST_OK) return err;
+    }
+
+    for (size_t f = 0; f < soa->field_count; f++) {
+        list* column = &soa->columns[f];
+        memcpy((uint8_t*) column->data + soa->size * column->elem_size,
+               (const uint8_t*) row + soa->offsets[f],
+               column->elem_size);
+        column->size++;
+    }
+    soa->size++;
+
+    return LIST_OK;
+}
+
+list_status list_soa_pop(list_soa* soa, void* out_row) {
+    if (soa == nullptr || soa->size == 0) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    for (size_t f = 0; f < soa->field_count; f++) {
+        void* field = out_row != nullptr ? (uint8_t*) out_row + soa->offsets[f] : nullptr;
+        list_pop(&soa->columns[f], field);
+    }
+    soa->size--;
+
+    return LIST_OK;
+}
+
+list_status list_soa_get(const list_soa* soa, const size_t index, void* out_row) {
+    if (soa == nullptr || out_row == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    if (index >= soa->size) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+
+    for (size_t f = 0; f < soa->field_count; f++) {
+        const list* column = &soa->columns[f];
+        memcpy((uint8_t*) out_row + soa->offsets[f],
+               (const uint8_t*) column->data + index * column->elem_size,
+               column->elem_size);
+    }
+
+    return LIST_OK;
+}
+
+list_status list_soa_set(list_soa* soa, const size_t index, const void* row) {
+    if (soa == nullptr || row == nullptr) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    if (index >= soa->size) return list_fail(nullptr, LIST_OUT_OF_BOUNDS);
+
+    for (size_t f = 0; f < soa->field_count; f++) {
+        list* column = &soa->columns[f];
+        memcpy((uint8_t*) column->data + index * column->elem_size,
+               (const uint8_t*) row + soa->offsets[f],
+               column->elem_size);
+    }
+
+    return LIST_OK;
+}
+
+void* list_soa_at(const list_soa* soa, const size_t index, const size_t field) {
+    if (soa == nullptr || field >= soa->field_count) return nullptr;
+
+    return list_at(&soa->columns[field], index);
+}
+
+void* list_soa_column(const list_soa* soa, const size_t field) {
+    if (soa == nullptr || field >= soa->field_count || soa->size == 0) return nullptr;
+
+    return soa->columns[field].data;
+}
+
+const list* list_soa_column_list(const list_soa* soa, const size_t field) {
+    if (soa == nullptr || field >= soa->field_count) return nullptr;
+
+    return &soa->columns[field];
+}
+
+void list_soa_clear(list_soa* soa) {
+    if (soa == nullptr) return;
+
+    for (size_t f = 0; f < soa->field_count; f++) {
+        list_clear(&soa->columns[f]);
+    }
+    soa->size = 0;
+}
@@ -0,0 +1,340 @@
+#include <stdint.h>
+#include <string.h>
+#include "list_sort.h"
+#include "list_parallel.h"
+#include "list_internal.h"
+
+/**
+ * @brief Shared state of a parallel merge sort.
+ * @internal
+ *
+ * @var list_sort_merge_ctx::bounds
+ *      `run_count + 1` element indices; run `i` covers `[bounds[i], bounds[i + 1])`.
+ *
+ * @var list_sort_merge_ctx::width
+ *      Number of initial runs in each of the two inputs of the current merge round.
+ */
+typedef struct list_sort_merge_ctx {
+    uint8_t*      src;
+    uint8_t*      dst;
+    size_t        elem_size;
+    const size_t* bounds;
+    size_t        run_count;
+    size_t        width;
+    int         (*cmp)(const void* a, const void* b);
+} list_sort_merge_ctx;
+
+/**
+ * @defgroup list_sort_internal Internal Sorting Functions
+ * @brief Helper functions used internally by the sorting implementation.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_sort_internal
+ * @brief Gets the size in bytes of a key type, or 0 if the type is unknown.
+ * @internal
+ */
+static size_t list_sort_key_size(list_key_type key_type);
+
+/**
+ * @ingroup list_sort_internal
+ * @brief Maps keys to unsigned integers with the same order, or back again.
+ * @internal
+ *
+ * Signed keys have their sign bit flipped. Floating point keys additionally
+ * have all other bits flipped when negative, which turns IEEE total order
+ * into unsigned order.
+ *
+ * @param data Pointer to the keys.
+ * @param count Number of keys.
+ * @param key_type The type of the keys.
+ * @param to_unsigned `true` to map keys to unsigned integers, `false` to map them back.
+ */
+static void list_sort_map_keys(void* data, size_t count, list_key_type key_type, bool to_unsigned);
+
+/**
+ * @ingroup list_sort_internal
+ * @brief LSD radix sort of unsigned 32-bit keys, one byte per pass.
+ * @internal
+ *
+ * @param keys Keys to sort; holds the sorted keys on return.
+ * @param scratch Buffer for `count` keys.
+ * @param count Number of keys.
+ */
+static void list_sort_radix32(uint32_t* keys, uint32_t* scratch, size_t count);
+
+/**
+ * @ingroup list_sort_internal
+ * @brief LSD radix sort of unsigned 64-bit keys, one byte per pass.
+ * @internal
+ *
+ * @param keys Keys to sort; holds the sorted keys on return.
+ * @param scratch Buffer for `count` keys.
+ * @param count Number of keys.
+ */
+static void list_sort_radix64(uint64_t* keys, uint64_t* scratch, size_t count);
+
+/**
+ * @ingroup list_sort_internal
+ * @brief Sorts one initial run of a parallel merge sort in place.
+ * @internal
+ */
+static void list_sort_run_task(size_t index, void* ctx);
+
+/**
+ * @ingroup list_sort_internal
+ * @brief Merges one pair of adjacent runs from `src` into `dst`.
+ * @internal
+ */
+static void list_sort_merge_task(size_t index, void* ctx);
+
+/** @} */ // end of list_sort_internal
+
+list_status list_sort(list* lst, int (*cmp)(const void* a, const void* b)) {
+    if (lst == nullptr || cmp == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+    if (lst->size < 2) return LIST_OK;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    qsort(lst->data, lst->size, lst->elem_size, cmp);
+    return LIST_OK;
+}
+
+list_status list_sort_keys(list* lst, const list_key_type key_type) {
+    if (lst == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    const size_t key_size = list_sort_key_size(key_type);
+    if (key_size == 0 || key_size != lst->elem_size) return list_fail(lst, LIST_ERR_INVALID);
+    if (lst->size < 2) return LIST_OK;
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    void* scratch = malloc(lst->size * lst->elem_size);
+    if (scratch == nullptr) return list_fail(lst, LIST_ERR_ALLOC);
+
+    list_sort_map_keys(lst->data, lst->size, key_type, true);
+    if (key_size == sizeof(uint32_t)) {
+        list_sort_radix32(lst->data, scratch, lst->size);
+    } else {
+        list_sort_radix64(lst->data, scratch, lst->size);
+    }
+    list_sort_map_keys(lst->data, lst->size, key_type, false);
+
+    free(scratch);
+    return LIST_OK;
+}
+
+list_status list_sort_parallel(list* lst, int (*cmp)(const void* a, const void* b), const size_t nthreads) {
+    if (lst == nullptr || cmp == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    size_t runs = nthreads == 0 ? list_parallel_hardware_threads() : nthreads;
+    if (runs > LIST_PARALLEL_MAX_THREADS) runs = LIST_PARALLEL_MAX_THREADS;
+    if (lst->size < LIST_SORT_PARALLEL_THRESHOLD || runs < 2) return list_sort(lst, cmp);
+    if (list_own(lst) != LIST_OK) return LIST_ERR_ALLOC;
+
+    uint8_t* scratch = malloc(lst->size * lst->elem_size);
+    if (scratch == nullptr) return list_fail(lst, LIST_ERR_ALLOC);
+
+    size_t bounds[LIST_PARALLEL_MAX_THREADS + 1];
+    for (size_t i = 0; i <= runs; i++) bounds[i] = lst->size / runs * i + (i * (lst->size % runs)) / runs;
+
+    list_sort_merge_ctx ctx = {
+        .src       = lst->data,
+        .dst       = scratch,
+        .elem_size = lst->elem_size,
+        .bounds    = bounds,
+        .run_count = runs,
+        .width     = 1,
+        .cmp       = cmp,
+    };
+    list_parallel_tasks(runs, list_sort_run_task, &ctx, runs);
+
+    // Each round merges pairs of sorted runs, doubling their length
+    for (; ctx.width < runs; ctx.width *= 2) {
+        const size_t merges = (runs + 2 * ctx.width - 1) / (2 * ctx.width);
+        list_parallel_tasks(merges, list_sort_merge_task, &ctx, runs);
+
+        uint8_t* swap = ctx.src;
+        ctx.src = ctx.dst;
+        ctx.dst = swap;
+    }
+
+    if (ctx.src != lst->data) memcpy(lst->data, ctx.src, lst->size * lst->elem_size);
+
+    free(scratch);
+    return LIST_OK;
+}
+
+size_t list_lower_bound(const list* lst, const void* key, int (*cmp)(const void* a, const void* b)) {
+    if (lst == nullptr || key == nullptr || cmp == nullptr) return 0;
+
+    const uint8_t* data = lst->data;
+    size_t first = 0;
+    size_t count = lst->size;
+    while (count > 0) {
+        const size_t half = count / 2;
+        if (cmp(data + (first + half) * lst->elem_size, key) < 0) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+
+    return first;
+}
+
+void* list_bsearch(const list* lst, const void* key, int (*cmp)(const void* a, const void* b)) {
+    if (lst == nullptr || key == nullptr || cmp == nullptr) return nullptr;
+
+    const size_t index = list_lower_bound(lst, key, cmp);
+    if (index >= lst->size) return nullptr;
+
+    void* found = (uint8_t*) lst->data + index * lst->elem_size;
+    return cmp(found, key) == 0 ? found : nullptr;
+}
+
+static size_t list_sort_key_size(const list_key_type key_type) {
+    switch (key_type) {
+        case LIST_KEY_I32:
+        case LIST_KEY_U32:
+        case LIST_KEY_F32:
+            return sizeof(uint32_t);
+        case LIST_KEY_I64:
+        case LIST_KEY_U64:
+        case LIST_KEY_F64:
+            return sizeof(uint64_t);
+        default:
+            return 0;
+    }
+}
+
+static void list_sort_map_keys(void* data, const size_t count, const list_key_type key_type, const bool to_unsigned) {
+    constexpr uint32_t sign32 = UINT32_C(1) << 31;
+    constexpr uint64_t sign64 = UINT64_C(1) << 63;
+    uint32_t* keys32 = data;
+    uint64_t* keys64 = data;
+
+    switch (key_type) {
+        case LIST_KEY_I32:
+            for (size_t i = 0; i < count; i++) keys32[i] ^= sign32;
+            break;
+        case LIST_KEY_I64:
+            for (size_t i = 0; i < count; i++) keys64[i] ^= sign64;
+            break;
+        case LIST_KEY_F32:
+            for (size_t i = 0; i < count; i++) {
+                // Negative floats are those with the sign bit set before mapping, and clear after it
+                const bool negative = ((keys32[i] & sign32) != 0) == to_unsigned;
+                keys32[i] ^= negative ? ~UINT32_C(0) : sign32;
+            }
+            break;
+        case LIST_KEY_F64:
+            for (size_t i = 0; i < count; i++) {
+                const bool negative = ((keys64[i] & sign64) != 0) == to_unsigned;
+                keys64[i] ^= negative ? ~UINT64_C(0) : sign64;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void list_sort_radix32(uint32_t* keys, uint32_t* scratch, const size_t count) {
+    size_t histograms[sizeof(uint32_t)][256] = { 0 };
+    for (size_t i = 0; i < count; i++) {
+        for (size_t b = 0; b < sizeof(uint32_t); b++) histograms[b][(keys[i] >> (8 * b)) & 0xff]++;
+    }
+
+    uint32_t* src = keys;
+    uint32_t* dst = scratch;
+    for (size_t b = 0; b < sizeof(uint32_t); b++) {
+        size_t* histogram = histograms[b];
+
+        // Every key has the same byte here, so this pass would not reorder anything
+        if (histogram[(src[0] >> (8 * b)) & 0xff] == count) continue;
+
+        size_t offset = 0;
+        for (size_t d = 0; d < 256; d++) {
+            const size_t n = histogram[d];
+            histogram[d] = offset;
+            offset += n;
+        }
+        for (size_t i = 0; i < count; i++) dst[histogram[(src[i] >> (8 * b)) & 0xff]++] = src[i];
+
+        uint32_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != keys) memcpy(keys, src, count * sizeof *keys);
+}
+
+static void list_sort_radix64(uint64_t* keys, uint64_t* scratch, const size_t count) {
+    size_t histograms[sizeof(uint64_t)][256] = { 0 };
+    for (size_t i = 0; i < count; i++) {
+        for (size_t b = 0; b < sizeof(uint64_t); b++) histograms[b][(keys[i] >> (8 * b)) & 0xff]++;
+    }
+
+    uint64_t* src = keys;
+    uint64_t* dst = scratch;
+    for (size_t b = 0; b < sizeof(uint64_t); b++) {
+        size_t* histogram = histograms[b];
+
+        // Every key has the same byte here, so this pass would not reorder anything
+        if (histogram[(src[0] >> (8 * b)) & 0xff] == count) continue;
+
+        size_t offset = 0;
+        for (size_t d = 0; d < 256; d++) {
+            const size_t n = histogram[d];
+            histogram[d] = offset;
+            offset += n;
+        }
+        for (size_t i = 0; i < count; i++) dst[histogram[(src[i] >> (8 * b)) & 0xff]++] = src[i];
+
+        uint64_t* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != keys) memcpy(keys, src, count * sizeof *keys);
+}
+
+static void list_sort_run_task(const size_t index, void* ctx) {
+    const list_sort_merge_ctx* merge = ctx;
+    const size_t first = merge->bounds[index];
+    const size_t count = merge->bounds[index + 1] - first;
+
+    qsort(merge->src + first * merge->elem_size, count, merge->elem_size, merge->cmp);
+}
+
+static void list_sort_merge_task(const size_t index, void* ctx) {
+    const list_sort_merge_ctx* merge = ctx;
+    const size_t elem_size = merge->elem_size;
+
+    const size_t left_run = index * 2 * merge->width;
+    const size_t right_run = left_run + merge->width < merge->run_count ? left_run + merge->width : merge->run_count;
+    const size_t end_run = right_run + merge->width < merge->run_count ? right_run + merge->width : merge->run_count;
+
+    const uint8_t* left = merge->src + merge->bounds[left_run] * elem_size;
+    const uint8_t* left_end = merge->src + merge->bounds[right_run] * elem_size;
+    const uint8_t* right = left_end;
+    const uint8_t* right_end = merge->src + merge->bounds[end_run] * elem_size;
+    uint8_t* out = merge->dst + merge->bounds[left_run] * elem_size;
+
+    // Taking from the left run on ties keeps the merge stable
+    while (left < left_end && right < right_end) {
+        if (merge->cmp(right, left) < 0) {
+            memcpy(out, right, elem_size);
+            right += elem_size;
+        } else {
+            memcpy(out, left, elem_size);
+            left += elem_size;
+        }
+        out += elem_size;
+    }
+
+    memcpy(out, left, (size_t) (left_end - left));
+    out += left_end - left;
+    memcpy(out, right, (size_t) (right_end - right));
+}
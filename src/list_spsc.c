@@ -0,0 +1,148 @@
+#include <stdint.h>
+#include <string.h>
+#include "list_spsc.h"
+#include "list_internal.h"
+
+/**
+ * @defgroup list_spsc_internal Internal SPSC Queue Functions
+ * @brief Helper functions used internally by the SPSC queue implementation.
+ * @internal
+ * @{
+ */
+
+/**
+ * @ingroup list_spsc_internal
+ * @brief Copies `count` elements from `src` into the ring, starting at `slot`.
+ * @internal
+ *
+ * Takes at most two `memcpy`s, split around the wrap.
+ */
+static void list_spsc_write(const list_spsc* q, size_t slot, const void* src, size_t count);
+
+/**
+ * @ingroup list_spsc_internal
+ * @brief Copies `count` elements from the ring, starting at `slot`, to `dst`.
+ * @internal
+ *
+ * Takes at most two `memcpy`s, split around the wrap.
+ */
+static void list_spsc_read(const list_spsc* q, size_t slot, void* dst, size_t count);
+
+/**
+ * @ingroup list_spsc_internal
+ * @brief Advances a ring slot by `count` elements.
+ * @internal
+ */
+static size_t list_spsc_advance(const list_spsc* q, size_t slot, size_t count);
+
+/** @} */ // end of list_spsc_internal
+
+list_status list_spsc_init(list_spsc* q, const size_t capacity, const size_t elem_size) {
+    if (q == nullptr || capacity == 0) return list_fail(nullptr, LIST_ERR_INVALID);
+
+    const list_status err = list_init_with_capacity(&q->buf, capacity, elem_size);
+    if (err != LIST_OK) return err;
+
+    q->capacity = q->buf.capacity;
+    atomic_init(&q->tail, 0);
+    q->tail_slot = 0;
+    q->head_cache = 0;
+    atomic_init(&q->head, 0);
+    q->head_slot = 0;
+    q->tail_cache = 0;
+
+    return LIST_OK;
+}
+
+void list_spsc_destroy(list_spsc* q) {
+    if (q == nullptr) return;
+
+    list_destroy(&q->buf);
+    q->capacity = 0;
+    atomic_store_explicit(&q->tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&q->head, 0, memory_order_relaxed);
+}
+
+size_t list_spsc_capacity(const list_spsc* q) {
+    return q != nullptr ? q->capacity : 0;
+}
+
+size_t list_spsc_size(const list_spsc* q) {
+    if (q == nullptr) return 0;
+
+    // Read head first: tail only grows, so the difference never underflows
+    const size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+    const size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    return tail - head;
+}
+
+bool list_spsc_try_push(list_spsc* q, const void* value) {
+    return list_spsc_push_n(q, value, 1) == 1;
+}
+
+bool list_spsc_try_pop(list_spsc* q, void* out_value) {
+    return list_spsc_pop_n(q, out_value, 1) == 1;
+}
+
+size_t list_spsc_push_n(list_spsc* q, const void* values, size_t count) {
+    if (q == nullptr || values == nullptr || q->capacity == 0) return 0;
+
+    const size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+
+    // Only look at the consumer's cache line when the cached head says we're full
+    if (q->capacity - (tail - q->head_cache) < count) {
+        q->head_cache = atomic_load_explicit(&q->head, memory_order_acquire);
+    }
+
+    const size_t free_slots = q->capacity - (tail - q->head_cache);
+    if (count > free_slots) count = free_slots;
+    if (count == 0) return 0;
+
+    list_spsc_write(q, q->tail_slot, values, count);
+    q->tail_slot = list_spsc_advance(q, q->tail_slot, count);
+
+    atomic_store_explicit(&q->tail, tail + count, memory_order_release);
+    return count;
+}
+
+size_t list_spsc_pop_n(list_spsc* q, void* out_values, size_t max_count) {
+    if (q == nullptr || out_values == nullptr || q->capacity == 0) return 0;
+
+    const size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+
+    // Only look at the producer's cache line when the cached tail says we're short
+    if (q->tail_cache - head < max_count) {
+        q->tail_cache = atomic_load_explicit(&q->tail, memory_order_acquire);
+    }
+
+    const size_t available = q->tail_cache - head;
+    if (max_count > available) max_count = available;
+    if (max_count == 0) return 0;
+
+    list_spsc_read(q, q->head_slot, out_values, max_count);
+    q->head_slot = list_spsc_advance(q, q->head_slot, max_count);
+
+    atomic_store_explicit(&q->head, head + max_count, memory_order_release);
+    return max_count;
+}
+
+static void list_spsc_write(const list_spsc* q, const size_t slot, const void* src, const size_t count) {
+    const size_t elem_size = q->buf.elem_size;
+    const size_t first = count < q->capacity - slot ? count : q->capacity - slot;
+
+    memcpy((uint8_t*) q->buf.data + slot * elem_size, src, first * elem_size);
+    if (count > first) memcpy(q->buf.data, (const uint8_t*) src + first * elem_size, (count - first) * elem_size);
+}
+
+static void list_spsc_read(const list_spsc* q, const size_t slot, void* dst, const size_t count) {
+    const size_t elem_size = q->buf.elem_size;
+    const size_t first = count < q->capacity - slot ? count : q->capacity - slot;
+
+    memcpy(dst, (const uint8_t*) q->buf.data + slot * elem_size, first * elem_size);
+    if (count > first) memcpy((uint8_t*) dst + first * elem_size, q->buf.data, (count - first) * elem_size);
+}
+
+static size_t list_spsc_advance(const list_spsc* q, const size_t slot, const size_t count) {
+    const size_t next = slot + count;
+    return next >= q->capacity ? next - q->capacity : next;
+}
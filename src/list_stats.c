@@ -0,0 +1,125 @@
+#include <stdatomic.h>
+#include <string.h>
+#include "list.h"
+#include "list_internal.h"
+
+#ifdef LIST_ENABLE_STATS
+
+/**
+ * @brief Process-wide counters, updated atomically so lists on any thread can report into them.
+ * @internal
+ */
+static struct {
+    atomic_uint_fast64_t resizes;
+    atomic_uint_fast64_t grows;
+    atomic_uint_fast64_t shrinks;
+    atomic_uint_fast64_t moves;
+    atomic_uint_fast64_t bytes_copied;
+    atomic_uint_fast64_t bytes_zeroed;
+    atomic_uint_fast64_t peak_capacity;
+    atomic_uint_fast64_t failures[LIST_STATUS_COUNT];
+} list_global_stats;
+
+static void list_stats_add(atomic_uint_fast64_t* counter, const uint64_t n) {
+    atomic_fetch_add_explicit(counter, n, memory_order_relaxed);
+}
+
+static void list_stats_max(atomic_uint_fast64_t* counter, const uint64_t n) {
+    uint_fast64_t current = atomic_load_explicit(counter, memory_order_relaxed);
+    while (current < n &&
+           !atomic_compare_exchange_weak_explicit(counter, &current, n, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+void list_stats_on_resize(list* lst, const size_t old_bytes, const size_t new_bytes, const bool moved) {
+    const bool grew = new_bytes > old_bytes;
+    const uint64_t copied = moved ? (grew ? old_bytes : new_bytes) : 0;
+
+    lst->stats.resizes++;
+    lst->stats.grows += grew;
+    lst->stats.shrinks += !grew;
+    lst->stats.moves += moved;
+    lst->stats.bytes_copied += copied;
+    if (new_bytes > lst->stats.peak_capacity) lst->stats.peak_capacity = new_bytes;
+
+    list_stats_add(&list_global_stats.resizes, 1);
+    list_stats_add(grew ? &list_global_stats.grows : &list_global_stats.shrinks, 1);
+    if (moved) {
+        list_stats_add(&list_global_stats.moves, 1);
+        list_stats_add(&list_global_stats.bytes_copied, copied);
+    }
+    list_stats_max(&list_global_stats.peak_capacity, new_bytes);
+}
+
+void list_stats_on_zero(list* lst, const size_t bytes) {
+    lst->stats.bytes_zeroed += bytes;
+    list_stats_add(&list_global_stats.bytes_zeroed, bytes);
+}
+
+void list_stats_on_failure(const list* lst, const list_status err) {
+    if ((unsigned) err >= LIST_STATUS_COUNT) return;
+
+    // Read-only calls count their failures too; lists are never defined const, and the counter is atomic
+    if (lst != nullptr) list_stats_add((atomic_uint_fast64_t*) &lst->failure_counts[err], 1);
+    list_stats_add(&list_global_stats.failures[err], 1);
+}
+
+list_status list_stats_get(const list* lst, list_stats* out_stats) {
+    if (out_stats == nullptr) return list_fail(lst, LIST_ERR_INVALID);
+
+    if (lst != nullptr) {
+        *out_stats = lst->stats;
+        for (size_t i = 0; i < LIST_STATUS_COUNT; i++) {
+            out_stats->failures[i] = atomic_load_explicit(&lst->failure_counts[i], memory_order_relaxed);
+        }
+        return LIST_OK;
+    }
+
+    out_stats->resizes = atomic_load_explicit(&list_global_stats.resizes, memory_order_relaxed);
+    out_stats->grows = atomic_load_explicit(&list_global_stats.grows, memory_order_relaxed);
+    out_stats->shrinks = atomic_load_explicit(&list_global_stats.shrinks, memory_order_relaxed);
+    out_stats->moves = atomic_load_explicit(&list_global_stats.moves, memory_order_relaxed);
+    out_stats->bytes_copied = atomic_load_explicit(&list_global_stats.bytes_copied, memory_order_relaxed);
+    out_stats->bytes_zeroed = atomic_load_explicit(&list_global_stats.bytes_zeroed, memory_order_relaxed);
+    out_stats->peak_capacity = atomic_load_explicit(&list_global_stats.peak_capacity, memory_order_relaxed);
+    for (size_t i = 0; i < LIST_STATUS_COUNT; i++) {
+        out_stats->failures[i] = atomic_load_explicit(&list_global_stats.failures[i], memory_order_relaxed);
+    }
+
+    return LIST_OK;
+}
+
+void list_stats_reset(list* lst) {
+    if (lst != nullptr) {
+        memset(&lst->stats, 0, sizeof lst->stats);
+        for (size_t i = 0; i < LIST_STATUS_COUNT; i++) {
+            atomic_store_explicit(&lst->failure_counts[i], 0, memory_order_relaxed);
+        }
+        return;
+    }
+
+    atomic_store_explicit(&list_global_stats.resizes, 0, memory_order_relaxed);
+    atomic_store_explicit(&list_global_stats.grows, 0, memory_order_relaxed);
+    atomic_store_explicit(&list_global_stats.shrinks, 0, memory_order_relaxed);
+    atomic_store_explicit(&list_global_stats.moves, 0, memory_order_relaxed);
+    atomic_store_explicit(&list_global_stats.bytes_copied, 0, memory_order_relaxed);
+    atomic_store_explicit(&list_global_stats.bytes_zeroed, 0, memory_order_relaxed);
+    atomic_store_explicit(&list_global_stats.peak_capacity, 0, memory_order_relaxed);
+    for (size_t i = 0; i < LIST_STATUS_COUNT; i++) {
+        atomic_store_explicit(&list_global_stats.failures[i], 0, memory_order_relaxed);
+    }
+}
+
+#else
+
+list_status list_stats_get([[maybe_unused]] const list* lst, list_stats* out_stats) {
+    if (out_stats == nullptr) return LIST_ERR_INVALID;
+
+    memset(out_stats, 0, sizeof *out_stats);
+    return LIST_OK;
+}
+
+void list_stats_reset([[maybe_unused]] list* lst) {
+}
+
+#endif
@@ -1,3 +1,9 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 #include "list.h"
 #include "unity.h"
 
@@ -12,6 +18,27 @@ void tearDown(void) {
     list_destroy(&test_list);
 }
 
+typedef struct counting_allocator_state {
+    size_t allocs;
+    size_t reallocs;
+    size_t frees;
+} counting_allocator_state;
+
+static void* counting_alloc(void* ctx, const size_t size) {
+    ((counting_allocator_state*) ctx)->allocs++;
+    return malloc(size);
+}
+
+static void* counting_realloc(void* ctx, void* ptr, [[maybe_unused]] const size_t old_size, const size_t new_size) {
+    ((counting_allocator_state*) ctx)->reallocs++;
+    return realloc(ptr, new_size);
+}
+
+static void counting_free(void* ctx, void* ptr, [[maybe_unused]] const size_t size) {
+    ((counting_allocator_state*) ctx)->frees++;
+    free(ptr);
+}
+
 static void populate_list_with_data(void) {
     for (int32_t i = 0; i < 10; i++) {
         int32_t value = i * 10;
@@ -57,6 +84,7 @@ void test_list_init_sets_defaults(void) {
     TEST_ASSERT_EQUAL_UINT64(0, lst.size);
     TEST_ASSERT_EQUAL_UINT64(0, lst.capacity);
     TEST_ASSERT_EQUAL_UINT64(sizeof(int32_t), lst.elem_size);
+    TEST_ASSERT_EQUAL_UINT(LIST_FLAG_NONE, lst.flags);
 
     list_destroy(&lst);
 }
@@ -117,6 +145,699 @@ void test_list_clear_empties_list(void) {
     TEST_ASSERT_EQUAL_UINT64(0, test_list.size);
 }
 
+void test_list_push_n_appends_all_values(void) {
+    const int32_t values[] = { 1, 2, 3, 4, 5 };
+    const list_status status = list_push_n(&test_list, values, 5);
+
+    TEST_ASSERT_EQUAL(LIST_OK, status);
+    TEST_ASSERT_EQUAL_UINT64(5, test_list.size);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(values, test_list.data, 5);
+}
+
+void test_list_push_n_resizes_once_to_fit(void) {
+    int32_t values[100];
+    for (int32_t i = 0; i < 100; i++) values[i] = i;
+
+    list_push_n(&test_list, values, 100);
+
+    TEST_ASSERT_EQUAL_UINT64(100, test_list.size);
+    TEST_ASSERT_EQUAL_UINT64(100, test_list.capacity);
+    assert_list_get_status_and_value(99, LIST_OK, 99);
+}
+
+void test_list_push_n_keeps_amortized_growth(void) {
+    populate_list_with_data();
+
+    const int32_t values[] = { 100, 110, 120, 130, 140, 150, 160 };
+    list_push_n(&test_list, values, 7);
+
+    TEST_ASSERT_EQUAL_UINT64(17, test_list.size);
+    TEST_ASSERT_EQUAL_UINT64(32, test_list.capacity);
+    assert_list_get_status_and_value(16, LIST_OK, 160);
+}
+
+void test_list_push_n_returns_error_when_values_null(void) {
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_push_n(&test_list, nullptr, 3));
+    TEST_ASSERT_EQUAL(LIST_OK, list_push_n(&test_list, nullptr, 0));
+    TEST_ASSERT_EQUAL_UINT64(0, test_list.size);
+}
+
+void test_list_extend_appends_other_list(void) {
+    populate_list_with_data();
+
+    list other;
+    list_init(&other, sizeof(int32_t));
+    constexpr int32_t value = 500;
+    list_push(&other, &value);
+    list_push(&other, &value);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_extend(&test_list, &other));
+    TEST_ASSERT_EQUAL_UINT64(12, test_list.size);
+    assert_list_get_status_and_value(9, LIST_OK, 90);
+    assert_list_get_status_and_value(11, LIST_OK, 500);
+
+    list_destroy(&other);
+}
+
+void test_list_extend_with_itself_duplicates_contents(void) {
+    populate_list_with_data();
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_extend(&test_list, &test_list));
+    TEST_ASSERT_EQUAL_UINT64(20, test_list.size);
+    assert_list_get_status_and_value(10, LIST_OK, 0);
+    assert_list_get_status_and_value(19, LIST_OK, 90);
+}
+
+void test_list_extend_returns_error_when_elem_size_differs(void) {
+    list other;
+    list_init(&other, sizeof(int64_t));
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_extend(&test_list, &other));
+
+    list_destroy(&other);
+}
+
+void test_list_pop_shrinks_capacity_by_default(void) {
+    populate_list_with_data();
+
+    for (int i = 0; i < 7; i++) list_pop(&test_list, nullptr);
+
+    TEST_ASSERT_EQUAL_UINT64(3, test_list.size);
+    TEST_ASSERT_EQUAL_UINT64(8, test_list.capacity);
+}
+
+void test_list_pop_never_shrinks_with_never_policy(void) {
+    populate_list_with_data();
+    TEST_ASSERT_EQUAL(LIST_OK, list_set_shrink_policy(&test_list, LIST_SHRINK_NEVER, 0));
+
+    for (int i = 0; i < 10; i++) list_pop(&test_list, nullptr);
+
+    TEST_ASSERT_EQUAL_UINT64(0, test_list.size);
+    TEST_ASSERT_EQUAL_UINT64(16, test_list.capacity);
+}
+
+void test_list_pop_retains_min_capacity(void) {
+    populate_list_with_data();
+    TEST_ASSERT_EQUAL(LIST_OK, list_set_shrink_policy(&test_list, LIST_SHRINK_RETAIN_MIN, 12));
+
+    for (int i = 0; i < 10; i++) list_pop(&test_list, nullptr);
+
+    TEST_ASSERT_EQUAL_UINT64(0, test_list.size);
+    TEST_ASSERT_EQUAL_UINT64(12, test_list.capacity);
+}
+
+void test_list_shrink_to_fit_matches_size(void) {
+    populate_list_with_data();
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_shrink_to_fit(&test_list));
+    TEST_ASSERT_EQUAL_UINT64(10, test_list.capacity);
+    assert_list_get_status_and_value(9, LIST_OK, 90);
+
+    list_clear(&test_list);
+    TEST_ASSERT_EQUAL(LIST_OK, list_shrink_to_fit(&test_list));
+    TEST_ASSERT_EQUAL_UINT64(0, test_list.capacity);
+    TEST_ASSERT_NULL(test_list.data);
+}
+
+void test_list_init_with_allocator_routes_all_buffer_operations(void) {
+    counting_allocator_state state = { 0 };
+    const list_allocator allocator = {
+        .alloc = counting_alloc,
+        .realloc = counting_realloc,
+        .free = counting_free,
+        .ctx = &state,
+    };
+
+    list lst;
+    TEST_ASSERT_EQUAL(LIST_OK, list_init_with_allocator(&lst, 0, sizeof(int32_t), &allocator));
+
+    for (int32_t i = 0; i < 4; i++) list_push(&lst, &i);
+    list_destroy(&lst);
+
+    TEST_ASSERT_EQUAL_UINT64(1, state.allocs);
+    TEST_ASSERT_EQUAL_UINT64(2, state.reallocs);
+    TEST_ASSERT_EQUAL_UINT64(1, state.frees);
+}
+
+void test_list_init_with_allocator_rejects_incomplete_allocator(void) {
+    const list_allocator allocator = { .alloc = counting_alloc };
+
+    list lst;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_init_with_allocator(&lst, 0, sizeof(int32_t), &allocator));
+}
+
+void test_list_at_returns_pointer_into_buffer(void) {
+    populate_list_with_data();
+
+    int32_t* element = list_at(&test_list, 4);
+    TEST_ASSERT_NOT_NULL(element);
+    TEST_ASSERT_EQUAL_INT32(40, *element);
+
+    *element = 444;
+    assert_list_get_status_and_value(4, LIST_OK, 444);
+}
+
+void test_list_at_returns_null_when_index_out_of_bounds(void) {
+    populate_list_with_data();
+    TEST_ASSERT_NULL(list_at(&test_list, 10));
+}
+
+void test_list_data_and_end_span_all_elements(void) {
+    populate_list_with_data();
+
+    int32_t sum = 0;
+    for (const int32_t* p = list_data(&test_list); p != list_end(&test_list); p++) {
+        sum += *p;
+    }
+
+    TEST_ASSERT_EQUAL_INT32(450, sum);
+    TEST_ASSERT_EQUAL_INT32(90, *(int32_t*) list_at_unchecked(&test_list, 9));
+}
+
+void test_list_emplace_back_reserves_new_slot(void) {
+    populate_list_with_data();
+
+    int32_t* slot = list_emplace_back(&test_list);
+    TEST_ASSERT_NOT_NULL(slot);
+    *slot = 100;
+
+    TEST_ASSERT_EQUAL_UINT64(11, test_list.size);
+    assert_list_get_status_and_value(10, LIST_OK, 100);
+}
+
+static bool is_multiple_of_three(const void* elem, [[maybe_unused]] void* ctx) {
+    return *(const int32_t*) elem % 3 == 0;
+}
+
+static bool count_calls_and_keep([[maybe_unused]] const void* elem, void* ctx) {
+    ++*(size_t*) ctx;
+    return false;
+}
+
+void test_list_insert_at_shifts_later_elements(void) {
+    populate_list_with_data();
+
+    const int32_t value = 5;
+    TEST_ASSERT_EQUAL(LIST_OK, list_insert_at(&test_list, 1, &value));
+    TEST_ASSERT_EQUAL(LIST_OK, list_insert_at(&test_list, 0, &value));
+    TEST_ASSERT_EQUAL(LIST_OK, list_insert_at(&test_list, list_size(&test_list), &value));
+
+    const int32_t expected[] = { 5, 0, 5, 10, 20, 30, 40, 50, 60, 70, 80, 90, 5 };
+    TEST_ASSERT_EQUAL_UINT64(13, test_list.size);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, test_list.data, 13);
+
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_insert_at(&test_list, 14, &value));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_insert_at(&test_list, 0, nullptr));
+}
+
+void test_list_insert_range_inserts_block(void) {
+    populate_list_with_data();
+
+    const int32_t values[] = { -1, -2, -3 };
+    TEST_ASSERT_EQUAL(LIST_OK, list_insert_range(&test_list, 2, values, 3));
+    TEST_ASSERT_EQUAL(LIST_OK, list_insert_range(&test_list, 5, nullptr, 0));
+
+    const int32_t expected[] = { 0, 10, -1, -2, -3, 20, 30, 40, 50, 60, 70, 80, 90 };
+    TEST_ASSERT_EQUAL_UINT64(13, test_list.size);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, test_list.data, 13);
+
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_insert_range(&test_list, 14, values, 3));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_insert_range(&test_list, 0, nullptr, 1));
+}
+
+void test_list_erase_at_returns_removed_value(void) {
+    populate_list_with_data();
+
+    int32_t removed = -1;
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_at(&test_list, 3, &removed));
+    TEST_ASSERT_EQUAL_INT32(30, removed);
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_at(&test_list, 0, nullptr));
+
+    const int32_t expected[] = { 10, 20, 40, 50, 60, 70, 80, 90 };
+    TEST_ASSERT_EQUAL_UINT64(8, test_list.size);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, test_list.data, 8);
+
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_erase_at(&test_list, 8, nullptr));
+}
+
+void test_list_erase_range_removes_block(void) {
+    populate_list_with_data();
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_range(&test_list, 2, 5));
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_range(&test_list, 5, 0));
+
+    const int32_t expected[] = { 0, 10, 70, 80, 90 };
+    TEST_ASSERT_EQUAL_UINT64(5, test_list.size);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, test_list.data, 5);
+
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_erase_range(&test_list, 3, 3));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_erase_range(&test_list, 6, 0));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_erase_range(&test_list, 1, SIZE_MAX));
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_range(&test_list, 0, 5));
+    TEST_ASSERT_EQUAL_UINT64(0, test_list.size);
+}
+
+void test_list_swap_remove_moves_last_element(void) {
+    populate_list_with_data();
+
+    int32_t removed = -1;
+    TEST_ASSERT_EQUAL(LIST_OK, list_swap_remove(&test_list, 2, &removed));
+    TEST_ASSERT_EQUAL_INT32(20, removed);
+    TEST_ASSERT_EQUAL(LIST_OK, list_swap_remove(&test_list, 8, &removed));
+    TEST_ASSERT_EQUAL_INT32(80, removed);
+
+    const int32_t expected[] = { 0, 10, 90, 30, 40, 50, 60, 70 };
+    TEST_ASSERT_EQUAL_UINT64(8, test_list.size);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected, test_list.data, 8);
+
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_swap_remove(&test_list, 8, nullptr));
+}
+
+void test_list_erase_if_compacts_in_order(void) {
+    for (int32_t i = 0; i < 100; i++) list_push(&test_list, &i);
+
+    size_t removed = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_if(&test_list, is_multiple_of_three, nullptr, &removed));
+    TEST_ASSERT_EQUAL_UINT64(34, removed);
+    TEST_ASSERT_EQUAL_UINT64(66, test_list.size);
+
+    for (size_t i = 0; i < test_list.size; i++) {
+        const int32_t expected = (int32_t) (i / 2 * 3 + i % 2 + 1);
+        TEST_ASSERT_EQUAL_INT32(expected, ((int32_t*) test_list.data)[i]);
+    }
+
+    size_t calls = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_if(&test_list, count_calls_and_keep, &calls, &removed));
+    TEST_ASSERT_EQUAL_UINT64(0, removed);
+    TEST_ASSERT_EQUAL_UINT64(66, calls);
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_erase_if(&test_list, nullptr, nullptr, &removed));
+    TEST_ASSERT_EQUAL_UINT64(0, removed);
+}
+
+void test_list_gather_and_scatter(void) {
+    for (int32_t i = 0; i < 100; i++) list_push(&test_list, &i);
+
+    const size_t indices[] = { 99, 0, 42, 42, 7, 63, 1, 98, 50, 3, 17, 81, 5, 64, 23, 88, 11, 70, 36, 2 };
+    enum { n = sizeof(indices) / sizeof(indices[0]) };
+
+    int32_t gathered[n];
+    TEST_ASSERT_EQUAL(LIST_OK, list_gather(&test_list, indices, n, gathered, nullptr));
+    for (size_t i = 0; i < n; i++) TEST_ASSERT_EQUAL_INT32((int32_t) indices[i], gathered[i]);
+
+    int32_t values[n];
+    for (size_t i = 0; i < n; i++) values[i] = -(int32_t) i;
+    TEST_ASSERT_EQUAL(LIST_OK, list_scatter(&test_list, indices, n, values, nullptr));
+
+    // The repeated index 42 keeps the later value
+    TEST_ASSERT_EQUAL_INT32(-3, ((int32_t*) test_list.data)[42]);
+    TEST_ASSERT_EQUAL_INT32(-19, ((int32_t*) test_list.data)[2]);
+    TEST_ASSERT_EQUAL_INT32(4, ((int32_t*) test_list.data)[4]);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_gather(&test_list, nullptr, 0, nullptr, nullptr));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_gather(&test_list, indices, n, nullptr, nullptr));
+}
+
+void test_list_gather_reports_first_bad_index(void) {
+    for (int32_t i = 0; i < 10; i++) list_push(&test_list, &i);
+
+    const size_t indices[] = { 1, 2, 10, 3, 500 };
+    int32_t out[5] = { -1, -1, -1, -1, -1 };
+    size_t bad = 0;
+
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_gather(&test_list, indices, 5, out, &bad));
+    TEST_ASSERT_EQUAL_UINT64(2, bad);
+    TEST_ASSERT_EQUAL_INT32(-1, out[0]);
+
+    const int32_t values[5] = { 7, 7, 7, 7, 7 };
+    bad = 0;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_scatter(&test_list, indices, 5, values, &bad));
+    TEST_ASSERT_EQUAL_UINT64(2, bad);
+    TEST_ASSERT_EQUAL_INT32(1, ((int32_t*) test_list.data)[1]);
+}
+
+void test_list_gather_odd_element_size(void) {
+    typedef struct { uint8_t bytes[12]; } wide;
+
+    list lst;
+    list_init(&lst, sizeof(wide));
+    for (uint8_t i = 0; i < 40; i++) {
+        wide w;
+        memset(&w, i, sizeof(w));
+        list_push(&lst, &w);
+    }
+
+    size_t indices[40];
+    for (size_t i = 0; i < 40; i++) indices[i] = 39 - i;
+
+    wide out[40];
+    TEST_ASSERT_EQUAL(LIST_OK, list_gather(&lst, indices, 40, out, nullptr));
+    for (size_t i = 0; i < 40; i++) TEST_ASSERT_EACH_EQUAL_UINT8(39 - i, out[i].bytes, sizeof(out[i].bytes));
+
+    list_destroy(&lst);
+}
+
+void test_list_move_transfers_buffer(void) {
+    for (int32_t i = 0; i < 100; i++) list_push(&test_list, &i);
+    const void* buffer = test_list.data;
+
+    list moved;
+    TEST_ASSERT_EQUAL(LIST_OK, list_move(&moved, &test_list));
+    TEST_ASSERT_EQUAL_PTR(buffer, moved.data);
+    TEST_ASSERT_EQUAL_UINT64(100, list_size(&moved));
+    TEST_ASSERT_EQUAL_INT32(99, ((int32_t*) moved.data)[99]);
+
+    // The source stays usable
+    TEST_ASSERT_NULL(test_list.data);
+    TEST_ASSERT_EQUAL_UINT64(0, list_size(&test_list));
+    const int32_t value = 7;
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&test_list, &value));
+    TEST_ASSERT_EQUAL_INT32(7, ((int32_t*) test_list.data)[0]);
+
+    list_destroy(&moved);
+}
+
+void test_list_move_and_swap_small_lists(void) {
+    // Small enough to live in inline storage when it is enabled
+    for (int32_t i = 0; i < 3; i++) list_push(&test_list, &i);
+
+    list moved;
+    TEST_ASSERT_EQUAL(LIST_OK, list_move(&moved, &test_list));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(((int32_t[]) { 0, 1, 2 }), moved.data, 3);
+    TEST_ASSERT_TRUE((uint8_t*) moved.data < (uint8_t*) &test_list ||
+                     (uint8_t*) moved.data >= (uint8_t*) (&test_list + 1));
+
+    list large;
+    list_init(&large, sizeof(int32_t));
+    for (int32_t i = 0; i < 1000; i++) list_push(&large, &i);
+    const void* large_buffer = large.data;
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_swap(&moved, &large));
+    TEST_ASSERT_EQUAL_PTR(large_buffer, moved.data);
+    TEST_ASSERT_EQUAL_UINT64(1000, list_size(&moved));
+    TEST_ASSERT_EQUAL_UINT64(3, list_size(&large));
+    TEST_ASSERT_EQUAL_INT32_ARRAY(((int32_t[]) { 0, 1, 2 }), large.data, 3);
+
+    // Both keep working after the exchange
+    for (int32_t i = 3; i < 50; i++) list_push(&large, &i);
+    TEST_ASSERT_EQUAL_INT32(49, ((int32_t*) large.data)[49]);
+    TEST_ASSERT_EQUAL(LIST_OK, list_swap(&large, &large));
+
+    list_destroy(&large);
+    list_destroy(&moved);
+}
+
+void test_list_release_and_adopt_round_trip(void) {
+    for (int32_t i = 0; i < 100; i++) list_push(&test_list, &i);
+
+    size_t size = 0;
+    size_t capacity = 0;
+    int32_t* buffer = list_release(&test_list, &size, &capacity);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_EQUAL_UINT64(100, size);
+    TEST_ASSERT_TRUE(capacity >= size);
+    TEST_ASSERT_NULL(test_list.data);
+    TEST_ASSERT_EQUAL_UINT64(0, list_capacity(&test_list));
+
+    list adopted;
+    TEST_ASSERT_EQUAL(LIST_OK, list_adopt(&adopted, buffer, size, capacity, sizeof(int32_t)));
+    TEST_ASSERT_EQUAL_PTR(buffer, adopted.data);
+    for (int32_t i = 100; i < 300; i++) list_push(&adopted, &i);
+    TEST_ASSERT_EQUAL_INT32(250, ((int32_t*) adopted.data)[250]);
+    list_destroy(&adopted);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_adopt(&adopted, nullptr, 0, 0, sizeof(int32_t)));
+    list_destroy(&adopted);
+
+    int32_t* raw = malloc(4 * sizeof(int32_t));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_adopt(&adopted, raw, 5, 4, sizeof(int32_t)));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_adopt(&adopted, nullptr, 0, 4, sizeof(int32_t)));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_adopt(&adopted, raw, 0, 4, 0));
+    free(raw);
+}
+
+void test_list_adopt_with_allocator_frees_through_it(void) {
+    counting_allocator_state state = { 0 };
+    const list_allocator allocator = { counting_alloc, counting_realloc, counting_free, &state };
+
+    list lst;
+    list_init_with_allocator(&lst, 16, sizeof(int32_t), &allocator);
+    for (int32_t i = 0; i < 10; i++) list_push(&lst, &i);
+
+    size_t size = 0;
+    size_t capacity = 0;
+    void* buffer = list_release(&lst, &size, &capacity);
+    list_destroy(&lst);
+    TEST_ASSERT_EQUAL_UINT64(0, state.frees);
+
+    list adopted;
+    TEST_ASSERT_EQUAL(LIST_OK, list_adopt_with_allocator(&adopted, buffer, size, capacity, sizeof(int32_t), &allocator));
+    for (int32_t i = 10; i < 40; i++) list_push(&adopted, &i);
+    TEST_ASSERT_TRUE(state.reallocs > 0);
+
+    list other;
+    TEST_ASSERT_EQUAL(LIST_OK, list_move(&other, &adopted));
+    TEST_ASSERT_EQUAL_PTR(&allocator, adopted.allocator);
+    list_destroy(&adopted);
+    TEST_ASSERT_EQUAL_UINT64(0, state.frees);
+
+    list_destroy(&other);
+    TEST_ASSERT_EQUAL_UINT64(1, state.frees);
+}
+
+void test_list_reserve_grows_once(void) {
+    counting_allocator_state state = { 0 };
+    const list_allocator allocator = { counting_alloc, counting_realloc, counting_free, &state };
+
+    list lst;
+    list_init_with_allocator(&lst, 0, sizeof(int32_t), &allocator);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_reserve(&lst, 1000));
+    TEST_ASSERT_EQUAL_UINT64(1000, list_capacity(&lst));
+    for (int32_t i = 0; i < 1000; i++) list_push(&lst, &i);
+    TEST_ASSERT_EQUAL_UINT64(1, state.allocs + state.reallocs);
+
+    // Never shrinks, and growing past the capacity keeps the growth factor
+    TEST_ASSERT_EQUAL(LIST_OK, list_reserve(&lst, 10));
+    TEST_ASSERT_EQUAL_UINT64(1000, list_capacity(&lst));
+    TEST_ASSERT_EQUAL(LIST_OK, list_reserve(&lst, 1001));
+    TEST_ASSERT_EQUAL_UINT64(2000, list_capacity(&lst));
+    TEST_ASSERT_EQUAL_INT32(999, ((int32_t*) lst.data)[999]);
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_reserve(nullptr, 1));
+    list_destroy(&lst);
+}
+
+void test_list_resize_to_fills_and_truncates(void) {
+    const int32_t fill = -5;
+    TEST_ASSERT_EQUAL(LIST_OK, list_resize_to(&test_list, 10, &fill));
+    TEST_ASSERT_EQUAL_UINT64(10, list_size(&test_list));
+    TEST_ASSERT_EACH_EQUAL_INT32(-5, test_list.data, 10);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_resize_to(&test_list, 15, nullptr));
+    TEST_ASSERT_EACH_EQUAL_INT32(0, (int32_t*) test_list.data + 10, 5);
+    TEST_ASSERT_EQUAL_INT32(-5, ((int32_t*) test_list.data)[9]);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_resize_to(&test_list, 2, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(2, list_size(&test_list));
+    TEST_ASSERT_TRUE(list_capacity(&test_list) < 15);
+    TEST_ASSERT_EQUAL_INT32(-5, ((int32_t*) test_list.data)[1]);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_resize_to(&test_list, 0, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(0, list_size(&test_list));
+}
+
+void test_list_clear_and_release_frees_buffer(void) {
+    populate_list_with_data();
+
+    list_clear_and_release(&test_list);
+    TEST_ASSERT_EQUAL_UINT64(0, list_size(&test_list));
+    TEST_ASSERT_EQUAL_UINT64(0, list_capacity(&test_list));
+    TEST_ASSERT_NULL(test_list.data);
+
+    const int32_t value = 3;
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&test_list, &value));
+    TEST_ASSERT_EQUAL_INT32(3, ((int32_t*) test_list.data)[0]);
+    list_clear_and_release(nullptr);
+}
+
+void test_list_init_with_flags_zero_fills_capacity(void) {
+    list lst;
+    TEST_ASSERT_EQUAL(LIST_OK, list_init_with_flags(&lst, 4, sizeof(int32_t), LIST_FLAG_ZERO_FILL));
+
+    const int32_t zeros[8] = { 0 };
+    TEST_ASSERT_EQUAL_INT32_ARRAY(zeros, lst.data, 4);
+
+    for (int32_t i = 1; i <= 5; i++) list_push(&lst, &i);
+
+    TEST_ASSERT_EQUAL_UINT64(8, lst.capacity);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(zeros, (int32_t*) lst.data + 5, 3);
+
+    list_destroy(&lst);
+}
+
+void test_list_set_flags_zero_fills_existing_slack(void) {
+    populate_list_with_data();
+    memset((int32_t*) test_list.data + 10, 0xff, 6 * sizeof(int32_t));
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_set_flags(&test_list, LIST_FLAG_ZERO_FILL));
+
+    const int32_t zeros[6] = { 0 };
+    TEST_ASSERT_EQUAL_INT32_ARRAY(zeros, (int32_t*) test_list.data + 10, 6);
+    assert_list_get_status_and_value(9, LIST_OK, 90);
+}
+
+void test_list_set_flags_rejects_unknown_flags(void) {
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_set_flags(&test_list, 1u << 31));
+}
+
+void test_list_stats_count_grows_shrinks_and_failures(void) {
+#ifdef LIST_ENABLE_STATS
+    list_stats_reset(nullptr);
+    populate_list_with_data();
+    for (int i = 0; i < 7; i++) list_pop(&test_list, nullptr);
+    assert_list_get_status_and_value(10, LIST_OUT_OF_BOUNDS, 0);
+
+    list_stats stats;
+    TEST_ASSERT_EQUAL(LIST_OK, list_stats_get(&test_list, &stats));
+    TEST_ASSERT_EQUAL_UINT64(6, stats.resizes);
+    TEST_ASSERT_EQUAL_UINT64(5, stats.grows);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.shrinks);
+    TEST_ASSERT_EQUAL_UINT64(16 * sizeof(int32_t), stats.peak_capacity);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.failures[LIST_OUT_OF_BOUNDS]);
+
+    list_stats global;
+    list_stats_get(nullptr, &global);
+    TEST_ASSERT_EQUAL_UINT64(6, global.resizes);
+    TEST_ASSERT_EQUAL_UINT64(1, global.failures[LIST_OUT_OF_BOUNDS]);
+
+    list_stats_reset(&test_list);
+    list_stats_get(&test_list, &stats);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.resizes);
+#else
+    list_stats stats;
+    TEST_ASSERT_EQUAL(LIST_OK, list_stats_get(&test_list, &stats));
+    TEST_ASSERT_EQUAL_UINT64(0, stats.resizes);
+#endif
+}
+
+void test_list_growth_factor_controls_capacity(void) {
+    TEST_ASSERT_EQUAL(LIST_OK, list_set_growth_policy(&test_list, 1.5, LIST_ROUND_NONE));
+    populate_list_with_data();
+
+    // 1, 2, 3, 4, 6, 9, 13
+    TEST_ASSERT_EQUAL_UINT64(13, test_list.capacity);
+    assert_list_get_status_and_value(9, LIST_OK, 90);
+}
+
+void test_list_set_growth_policy_rejects_invalid_factor(void) {
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_set_growth_policy(&test_list, 1.0, LIST_ROUND_NONE));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_set_growth_policy(&test_list, NAN, LIST_ROUND_NONE));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_set_growth_policy(&test_list, 2.0, (list_capacity_rounding) 99));
+}
+
+void test_list_page_rounding_rounds_large_buffers(void) {
+    list lst;
+    list_init(&lst, 1);
+    list_set_growth_policy(&lst, 2.0, LIST_ROUND_PAGE);
+
+    uint8_t* bytes = calloc(200000, 1);
+    list_push_n(&lst, bytes, 200000);
+
+    TEST_ASSERT_EQUAL_UINT64(49 * LIST_PAGE_SIZE, lst.capacity);
+
+    free(bytes);
+    list_destroy(&lst);
+}
+
+void test_list_usable_size_rounding_never_loses_capacity(void) {
+    list lst;
+    list_init(&lst, 1);
+    list_set_growth_policy(&lst, 2.0, LIST_ROUND_USABLE_SIZE);
+
+    constexpr uint8_t value = 7;
+    list_push(&lst, &value);
+
+    TEST_ASSERT_TRUE(lst.capacity >= 1);
+#if LIST_INLINE_BYTES > 0
+    TEST_ASSERT_EQUAL_UINT64(LIST_INLINE_BYTES, lst.capacity);
+#elif defined(__GLIBC__)
+    // Rounding must claim the whole block malloc handed out, not just more than asked for
+    TEST_ASSERT_EQUAL_UINT64(malloc_usable_size(lst.data), lst.capacity);
+#endif
+
+    list_destroy(&lst);
+}
+
+#if LIST_INLINE_BYTES > 0
+void test_list_small_buffers_stay_inline(void) {
+    constexpr size_t inline_count = LIST_INLINE_BYTES / sizeof(int);
+
+    list lst;
+    list_init(&lst, sizeof(int));
+    for (int i = 0; i < (int) inline_count; i++) list_push(&lst, &i);
+
+    TEST_ASSERT_EQUAL_PTR(lst.inline_data, lst.data);
+
+    list_destroy(&lst);
+    TEST_ASSERT_NULL(lst.data);
+}
+
+void test_list_spills_to_heap_and_returns_inline(void) {
+    constexpr size_t inline_count = LIST_INLINE_BYTES / sizeof(int);
+
+    list lst;
+    list_init(&lst, sizeof(int));
+    for (int i = 0; i < (int) (4 * inline_count); i++) list_push(&lst, &i);
+
+    TEST_ASSERT_TRUE(lst.data != (void*) lst.inline_data);
+
+    // Popping shrinks the buffer until it fits inline again
+    while (lst.size > 1) list_pop(&lst, nullptr);
+    TEST_ASSERT_EQUAL_PTR(lst.inline_data, lst.data);
+
+    int first = -1;
+    list_get(&lst, 0, &first);
+    TEST_ASSERT_EQUAL_INT(0, first);
+
+    list_destroy(&lst);
+}
+
+void test_list_adopted_heap_buffer_grows_into_inline_storage(void) {
+    int* buf = malloc(2 * sizeof(int));
+    buf[0] = 10;
+    buf[1] = 11;
+
+    list lst;
+    TEST_ASSERT_EQUAL(LIST_OK, list_adopt(&lst, buf, 2, 2, sizeof(int)));
+
+    // The grown buffer still fits inline, so only the two adopted elements are copied in
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&lst, &(int) { 12 }));
+    if (lst.capacity * sizeof(int) <= LIST_INLINE_BYTES) TEST_ASSERT_EQUAL_PTR(lst.inline_data, lst.data);
+    for (int i = 0; i < 3; i++) TEST_ASSERT_EQUAL_INT(10 + i, *(const int*) list_at(&lst, (size_t) i));
+
+    list_destroy(&lst);
+}
+
+void test_list_custom_allocator_bypasses_inline_storage(void) {
+    counting_allocator_state state = { 0 };
+    const list_allocator allocator = {
+        .alloc = counting_alloc,
+        .realloc = counting_realloc,
+        .free = counting_free,
+        .ctx = &state,
+    };
+
+    list lst;
+    list_init_with_allocator(&lst, 1, sizeof(int), &allocator);
+
+    TEST_ASSERT_TRUE(lst.data != (void*) lst.inline_data);
+    TEST_ASSERT_EQUAL_UINT64(1, state.allocs);
+
+    list_destroy(&lst);
+}
+#endif
+
 int main(void) {
     UNITY_BEGIN();
 
@@ -129,6 +850,53 @@ int main(void) {
     RUN_TEST(test_list_set_sets_value_at_index);
     RUN_TEST(test_list_set_returns_error_when_index_out_of_bounds);
     RUN_TEST(test_list_clear_empties_list);
+    RUN_TEST(test_list_push_n_appends_all_values);
+    RUN_TEST(test_list_push_n_resizes_once_to_fit);
+    RUN_TEST(test_list_push_n_keeps_amortized_growth);
+    RUN_TEST(test_list_push_n_returns_error_when_values_null);
+    RUN_TEST(test_list_extend_appends_other_list);
+    RUN_TEST(test_list_extend_with_itself_duplicates_contents);
+    RUN_TEST(test_list_extend_returns_error_when_elem_size_differs);
+    RUN_TEST(test_list_pop_shrinks_capacity_by_default);
+    RUN_TEST(test_list_pop_never_shrinks_with_never_policy);
+    RUN_TEST(test_list_pop_retains_min_capacity);
+    RUN_TEST(test_list_shrink_to_fit_matches_size);
+    RUN_TEST(test_list_init_with_allocator_routes_all_buffer_operations);
+    RUN_TEST(test_list_init_with_allocator_rejects_incomplete_allocator);
+    RUN_TEST(test_list_at_returns_pointer_into_buffer);
+    RUN_TEST(test_list_at_returns_null_when_index_out_of_bounds);
+    RUN_TEST(test_list_data_and_end_span_all_elements);
+    RUN_TEST(test_list_emplace_back_reserves_new_slot);
+    RUN_TEST(test_list_insert_at_shifts_later_elements);
+    RUN_TEST(test_list_insert_range_inserts_block);
+    RUN_TEST(test_list_erase_at_returns_removed_value);
+    RUN_TEST(test_list_erase_range_removes_block);
+    RUN_TEST(test_list_swap_remove_moves_last_element);
+    RUN_TEST(test_list_erase_if_compacts_in_order);
+    RUN_TEST(test_list_gather_and_scatter);
+    RUN_TEST(test_list_gather_reports_first_bad_index);
+    RUN_TEST(test_list_gather_odd_element_size);
+    RUN_TEST(test_list_move_transfers_buffer);
+    RUN_TEST(test_list_move_and_swap_small_lists);
+    RUN_TEST(test_list_release_and_adopt_round_trip);
+    RUN_TEST(test_list_adopt_with_allocator_frees_through_it);
+    RUN_TEST(test_list_reserve_grows_once);
+    RUN_TEST(test_list_resize_to_fills_and_truncates);
+    RUN_TEST(test_list_clear_and_release_frees_buffer);
+    RUN_TEST(test_list_init_with_flags_zero_fills_capacity);
+    RUN_TEST(test_list_set_flags_zero_fills_existing_slack);
+    RUN_TEST(test_list_set_flags_rejects_unknown_flags);
+    RUN_TEST(test_list_stats_count_grows_shrinks_and_failures);
+    RUN_TEST(test_list_growth_factor_controls_capacity);
+    RUN_TEST(test_list_set_growth_policy_rejects_invalid_factor);
+    RUN_TEST(test_list_page_rounding_rounds_large_buffers);
+    RUN_TEST(test_list_usable_size_rounding_never_loses_capacity);
+#if LIST_INLINE_BYTES > 0
+    RUN_TEST(test_list_small_buffers_stay_inline);
+    RUN_TEST(test_list_spills_to_heap_and_returns_inline);
+    RUN_TEST(test_list_adopted_heap_buffer_grows_into_inline_storage);
+    RUN_TEST(test_list_custom_allocator_bypasses_inline_storage);
+#endif
 
     return UNITY_END();
 }
@@ -0,0 +1,115 @@
+#include <stddef.h>
+#include "list.h"
+#include "list_arena.h"
+#include "unity.h"
+
+static list_arena test_arena;
+
+void setUp(void) {
+    list_arena_init(&test_arena, 1024);
+}
+
+void tearDown(void) {
+    list_arena_destroy(&test_arena);
+}
+
+static void push_sequence(list* lst, const int32_t count) {
+    for (int32_t i = 0; i < count; i++) {
+        list_push(lst, &i);
+    }
+}
+
+void test_list_arena_init_rejects_zero_block_size(void) {
+    list_arena arena;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_arena_init(&arena, 0));
+}
+
+void test_list_arena_alloc_returns_aligned_distinct_blocks(void) {
+    void* a = list_arena_alloc(&test_arena, 3);
+    void* b = list_arena_alloc(&test_arena, 5);
+
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_TRUE(a != b);
+    TEST_ASSERT_EQUAL_UINT64(0, (uintptr_t) b % alignof(max_align_t));
+}
+
+void test_list_arena_serves_oversized_requests(void) {
+    uint8_t* big = list_arena_alloc(&test_arena, 4096);
+    TEST_ASSERT_NOT_NULL(big);
+    big[4095] = 1;
+}
+
+void test_list_arena_reset_reuses_memory(void) {
+    void* first = list_arena_alloc(&test_arena, 64);
+    list_arena_reset(&test_arena);
+    void* again = list_arena_alloc(&test_arena, 64);
+
+    TEST_ASSERT_EQUAL_PTR(first, again);
+}
+
+void test_list_arena_backs_growing_list(void) {
+    list lst;
+    TEST_ASSERT_EQUAL(LIST_OK, list_init_with_allocator(&lst, 0, sizeof(int32_t), list_arena_allocator(&test_arena)));
+
+    push_sequence(&lst, 1000);
+
+    TEST_ASSERT_EQUAL_UINT64(1000, lst.size);
+    for (int32_t i = 0; i < 1000; i++) {
+        int32_t value = -1;
+        list_get(&lst, (size_t) i, &value);
+        TEST_ASSERT_EQUAL_INT32(i, value);
+    }
+
+    // Lists do not need destroying once the arena is reset
+    list_arena_reset(&test_arena);
+}
+
+void test_list_pool_recycles_released_blocks(void) {
+    list_pool pool;
+    list_pool_init(&pool, &test_arena);
+
+    list a;
+    list_init_with_allocator(&a, 8, sizeof(int32_t), list_pool_allocator(&pool));
+    void* first_buffer = a.data;
+    list_destroy(&a);
+
+    list b;
+    list_init_with_allocator(&b, 8, sizeof(int32_t), list_pool_allocator(&pool));
+    TEST_ASSERT_EQUAL_PTR(first_buffer, b.data);
+
+    list_destroy(&b);
+    list_pool_reset(&pool);
+}
+
+void test_list_pool_preserves_contents_across_size_classes(void) {
+    list_pool pool;
+    list_pool_init(&pool, &test_arena);
+
+    list lst;
+    list_init_with_allocator(&lst, 0, sizeof(int32_t), list_pool_allocator(&pool));
+    push_sequence(&lst, 5000);
+
+    int32_t value = -1;
+    list_get(&lst, 4999, &value);
+    TEST_ASSERT_EQUAL_INT32(4999, value);
+    list_get(&lst, 3, &value);
+    TEST_ASSERT_EQUAL_INT32(3, value);
+
+    list_destroy(&lst);
+    list_pool_reset(&pool);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_arena_init_rejects_zero_block_size);
+    RUN_TEST(test_list_arena_alloc_returns_aligned_distinct_blocks);
+    RUN_TEST(test_list_arena_serves_oversized_requests);
+    RUN_TEST(test_list_arena_reset_reuses_memory);
+    RUN_TEST(test_list_arena_backs_growing_list);
+    RUN_TEST(test_list_pool_recycles_released_blocks);
+    RUN_TEST(test_list_pool_preserves_contents_across_size_classes);
+
+    return UNITY_END();
+}
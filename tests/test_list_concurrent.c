@@ -0,0 +1,185 @@
+#include <stdlib.h>
+#include <threads.h>
+#include "list_concurrent.h"
+#include "unity.h"
+
+enum { producer_count = 4 };
+static constexpr uint32_t pushes_per_producer = 20000;
+
+static concurrent_list test_list;
+
+typedef struct producer_args {
+    concurrent_list* cl;
+    uint32_t id;
+} producer_args;
+
+void setUp(void) {
+    concurrent_list_init_with_capacity(&test_list, 16, sizeof(uint64_t));
+}
+
+void tearDown(void) {
+    concurrent_list_destroy(&test_list);
+}
+
+static int producer(void* arg) {
+    const producer_args* args = arg;
+    for (uint32_t i = 0; i < pushes_per_producer; i++) {
+        const uint64_t value = ((uint64_t) (args->id + 1) << 32) | i;
+        if (concurrent_list_push(args->cl, &value) != LIST_OK) return 1;
+    }
+    return 0;
+}
+
+static void count_nonzero(const void* elems, const size_t count, [[maybe_unused]] const size_t first_index, void* ctx) {
+    const uint64_t* values = elems;
+    for (size_t i = 0; i < count; i++) {
+        if (values[i] != 0) ++*(size_t*) ctx;
+    }
+}
+
+void test_concurrent_list_push_and_get_value(void) {
+    for (uint64_t i = 1; i <= 100; i++) {
+        TEST_ASSERT_EQUAL(LIST_OK, concurrent_list_push(&test_list, &i));
+    }
+
+    uint64_t value = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, concurrent_list_get(&test_list, 99, &value));
+    TEST_ASSERT_EQUAL_UINT64(100, value);
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, concurrent_list_get(&test_list, 100, &value));
+    TEST_ASSERT_EQUAL_UINT64(100, concurrent_list_size(&test_list));
+}
+
+void test_concurrent_list_snapshot_spans_chunks(void) {
+    for (uint64_t i = 1; i <= 1000; i++) concurrent_list_push(&test_list, &i);
+
+    concurrent_list_snapshot snap;
+    TEST_ASSERT_EQUAL(LIST_OK, concurrent_list_snapshot_take(&test_list, &snap));
+    TEST_ASSERT_EQUAL_UINT64(1000, snap.size);
+    TEST_ASSERT_EQUAL_UINT64(17, *(const uint64_t*) concurrent_list_snapshot_at(&snap, 16));
+    TEST_ASSERT_EQUAL_UINT64(1000, *(const uint64_t*) concurrent_list_snapshot_at(&snap, 999));
+    TEST_ASSERT_NULL(concurrent_list_snapshot_at(&snap, 1000));
+
+    size_t seen = 0;
+    concurrent_list_snapshot_for_each(&snap, count_nonzero, &seen);
+    TEST_ASSERT_EQUAL_UINT64(1000, seen);
+}
+
+void test_concurrent_list_keeps_every_push_from_many_threads(void) {
+    thrd_t threads[producer_count];
+    producer_args args[producer_count];
+
+    for (int t = 0; t < producer_count; t++) {
+        args[t] = (producer_args) { .cl = &test_list, .id = (uint32_t) t };
+        TEST_ASSERT_EQUAL(thrd_success, thrd_create(&threads[t], producer, &args[t]));
+    }
+
+    // Snapshots taken mid-flight must only ever expose fully written elements
+    for (int i = 0; i < 100; i++) {
+        concurrent_list_snapshot snap;
+        concurrent_list_snapshot_take(&test_list, &snap);
+
+        size_t seen = 0;
+        concurrent_list_snapshot_for_each(&snap, count_nonzero, &seen);
+        TEST_ASSERT_EQUAL_UINT64(snap.size, seen);
+    }
+
+    for (int t = 0; t < producer_count; t++) {
+        int result = -1;
+        thrd_join(threads[t], &result);
+        TEST_ASSERT_EQUAL_INT(0, result);
+    }
+
+    concurrent_list_snapshot snap;
+    concurrent_list_snapshot_take(&test_list, &snap);
+    TEST_ASSERT_EQUAL_UINT64(producer_count * pushes_per_producer, snap.size);
+
+    // Every producer's values must appear exactly once
+    uint64_t sums[producer_count] = { 0 };
+    for (size_t i = 0; i < snap.size; i++) {
+        const uint64_t value = *(const uint64_t*) concurrent_list_snapshot_at(&snap, i);
+        sums[(value >> 32) - 1] += value & 0xffffffffu;
+    }
+    for (int t = 0; t < producer_count; t++) {
+        TEST_ASSERT_EQUAL_UINT64((uint64_t) pushes_per_producer * (pushes_per_producer - 1) / 2, sums[t]);
+    }
+}
+
+static void* failing_alloc(void* ctx, const size_t size) {
+    return *(const bool*) ctx ? nullptr : malloc(size);
+}
+
+static void* failing_realloc(void* ctx, void* ptr, [[maybe_unused]] const size_t old_size, const size_t new_size) {
+    return *(const bool*) ctx ? nullptr : realloc(ptr, new_size);
+}
+
+static void failing_free([[maybe_unused]] void* ctx, void* ptr, [[maybe_unused]] const size_t size) {
+    free(ptr);
+}
+
+void test_concurrent_list_failed_push_leaves_a_dead_chunk(void) {
+    bool fail = false;
+    const list_allocator allocator = {
+        .alloc   = failing_alloc,
+        .realloc = failing_realloc,
+        .free    = failing_free,
+        .ctx     = &fail,
+    };
+
+    concurrent_list cl;
+    TEST_ASSERT_EQUAL(LIST_OK, concurrent_list_init_with_allocator(&cl, 16, sizeof(uint64_t), &allocator));
+    for (uint64_t i = 1; i <= 16; i++) TEST_ASSERT_EQUAL(LIST_OK, concurrent_list_push(&cl, &i));
+
+    // The second chunk (indices 16 to 47) cannot be allocated
+    fail = true;
+    const uint64_t lost = 99;
+    TEST_ASSERT_EQUAL(LIST_ERR_ALLOC, concurrent_list_push(&cl, &lost));
+
+    // Later pushes reserve past the dead chunk and stay visible
+    fail = false;
+    const uint64_t next = 17;
+    TEST_ASSERT_EQUAL(LIST_OK, concurrent_list_push(&cl, &next));
+    TEST_ASSERT_EQUAL_UINT64(49, concurrent_list_size(&cl));
+
+    concurrent_list_snapshot snap;
+    TEST_ASSERT_EQUAL(LIST_OK, concurrent_list_snapshot_take(&cl, &snap));
+    TEST_ASSERT_EQUAL_UINT64(49, snap.size);
+    TEST_ASSERT_EQUAL_UINT64(16, *(const uint64_t*) concurrent_list_snapshot_at(&snap, 15));
+    TEST_ASSERT_NULL(concurrent_list_snapshot_at(&snap, 16));
+    TEST_ASSERT_EQUAL_UINT64(17, *(const uint64_t*) concurrent_list_snapshot_at(&snap, 48));
+
+    uint64_t out = 0;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, concurrent_list_get(&cl, 16, &out));
+
+    size_t seen = 0;
+    concurrent_list_snapshot_for_each(&snap, count_nonzero, &seen);
+    TEST_ASSERT_EQUAL_UINT64(17, seen);
+
+    concurrent_list_destroy(&cl);
+}
+
+void test_concurrent_list_rejects_invalid_arguments(void) {
+    concurrent_list cl;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, concurrent_list_init(&cl, 0));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, concurrent_list_push(&test_list, nullptr));
+    TEST_ASSERT_EQUAL(
+        LIST_ERR_INVALID, concurrent_list_init_with_capacity(&cl, CONCURRENT_LIST_MAX_FIRST_CHUNK + 1, sizeof(int)));
+}
+
+void test_concurrent_list_get_rejects_indices_past_the_end(void) {
+    uint64_t out = 0;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, concurrent_list_get(&test_list, 0, &out));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, concurrent_list_get(&test_list, SIZE_MAX, &out));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_concurrent_list_push_and_get_value);
+    RUN_TEST(test_concurrent_list_snapshot_spans_chunks);
+    RUN_TEST(test_concurrent_list_keeps_every_push_from_many_threads);
+    RUN_TEST(test_concurrent_list_failed_push_leaves_a_dead_chunk);
+    RUN_TEST(test_concurrent_list_rejects_invalid_arguments);
+    RUN_TEST(test_concurrent_list_get_rejects_indices_past_the_end);
+
+    return UNITY_END();
+}
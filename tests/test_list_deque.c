@@ -0,0 +1,212 @@
+#include <stdint.h>
+#include <string.h>
+#include "list_deque.h"
+#include "unity.h"
+
+static list_deque test_deque;
+
+void setUp(void) {
+    list_deque_init(&test_deque, sizeof(int32_t));
+}
+
+void tearDown(void) {
+    list_deque_destroy(&test_deque);
+}
+
+static void assert_contents(const int32_t* expected, const size_t count) {
+    TEST_ASSERT_EQUAL_UINT64(count, list_deque_size(&test_deque));
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t value = -1;
+        TEST_ASSERT_EQUAL(LIST_OK, list_deque_get(&test_deque, i, &value));
+        TEST_ASSERT_EQUAL_INT32(expected[i], value);
+    }
+}
+
+/**
+ * Leaves the deque wrapped, holding `count` elements 0..count-1 with the
+ * first `front` of them stored at the end of a ring of `capacity` slots.
+ */
+static void make_wrapped(const size_t capacity, const size_t count, const size_t front) {
+    list_deque_destroy(&test_deque);
+    list_deque_init_with_capacity(&test_deque, capacity, sizeof(int32_t));
+
+    for (int32_t i = (int32_t) front; i < (int32_t) count; i++) list_deque_push_back(&test_deque, &i);
+    for (int32_t i = (int32_t) front - 1; i >= 0; i--) list_deque_push_front(&test_deque, &i);
+
+    TEST_ASSERT_EQUAL_UINT64(capacity, list_deque_capacity(&test_deque));
+    TEST_ASSERT_EQUAL_UINT64(front == 0 ? 0 : capacity - front, test_deque.head);
+}
+
+void test_list_deque_works_as_fifo_queue(void) {
+    for (int32_t round = 0; round < 100; round++) {
+        for (int32_t i = 0; i < 3; i++) {
+            const int32_t value = round * 3 + i;
+            TEST_ASSERT_EQUAL(LIST_OK, list_deque_push_back(&test_deque, &value));
+        }
+        for (int32_t i = 0; i < 2; i++) {
+            int32_t value = -1;
+            TEST_ASSERT_EQUAL(LIST_OK, list_deque_pop_front(&test_deque, &value));
+            TEST_ASSERT_EQUAL_INT32(round * 2 + i, value);
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT64(100, list_deque_size(&test_deque));
+    int32_t first = -1;
+    list_deque_get(&test_deque, 0, &first);
+    TEST_ASSERT_EQUAL_INT32(200, first);
+}
+
+void test_list_deque_push_and_pop_at_both_ends(void) {
+    const int32_t values[] = { 1, 2, 3, 4 };
+
+    list_deque_push_back(&test_deque, &values[2]);
+    list_deque_push_front(&test_deque, &values[1]);
+    list_deque_push_back(&test_deque, &values[3]);
+    list_deque_push_front(&test_deque, &values[0]);
+    assert_contents(values, 4);
+
+    int32_t out = -1;
+    TEST_ASSERT_EQUAL(LIST_OK, list_deque_pop_back(&test_deque, &out));
+    TEST_ASSERT_EQUAL_INT32(4, out);
+    TEST_ASSERT_EQUAL(LIST_OK, list_deque_pop_front(&test_deque, &out));
+    TEST_ASSERT_EQUAL_INT32(1, out);
+    TEST_ASSERT_EQUAL(LIST_OK, list_deque_pop_front(&test_deque, nullptr));
+    TEST_ASSERT_EQUAL(LIST_OK, list_deque_pop_back(&test_deque, nullptr));
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_deque_pop_front(&test_deque, &out));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_deque_pop_back(&test_deque, &out));
+}
+
+void test_list_deque_indexes_across_the_wrap(void) {
+    make_wrapped(8, 6, 3);
+
+    const int32_t expected[] = { 0, 1, 2, 3, 4, 5 };
+    assert_contents(expected, 6);
+
+    const int32_t value = 42;
+    TEST_ASSERT_EQUAL(LIST_OK, list_deque_set(&test_deque, 4, &value));
+    TEST_ASSERT_EQUAL_INT32(42, *(int32_t*) list_deque_at(&test_deque, 4));
+    TEST_ASSERT_EQUAL_PTR(test_deque.buf.data, list_deque_at(&test_deque, 3));
+
+    int32_t out;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_deque_get(&test_deque, 6, &out));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_deque_set(&test_deque, 6, &value));
+    TEST_ASSERT_NULL(list_deque_at(&test_deque, 6));
+}
+
+void test_list_deque_grows_while_wrapped(void) {
+    // Short wrapped part, appended after the old end, then a long one, moved to the new end
+    const size_t fronts[] = { 6, 2 };
+
+    for (size_t f = 0; f < 2; f++) {
+        make_wrapped(8, 8, fronts[f]);
+
+        const int32_t next = 8;
+        TEST_ASSERT_EQUAL(LIST_OK, list_deque_push_back(&test_deque, &next));
+        TEST_ASSERT_TRUE(list_deque_capacity(&test_deque) > 8);
+
+        const int32_t expected[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+        assert_contents(expected, 9);
+    }
+
+    make_wrapped(8, 8, 5);
+    const int32_t before = -1;
+    TEST_ASSERT_EQUAL(LIST_OK, list_deque_push_front(&test_deque, &before));
+    const int32_t expected[] = { -1, 0, 1, 2, 3, 4, 5, 6, 7 };
+    assert_contents(expected, 9);
+}
+
+void test_list_deque_make_contiguous_linearizes(void) {
+    // Room to shift the wrapped part, room to shift the first part, and a full ring
+    const size_t cases[][3] = { { 16, 10, 3 }, { 16, 10, 7 }, { 8, 8, 3 }, { 9, 8, 5 }, { 8, 5, 0 } };
+
+    for (size_t c = 0; c < sizeof cases / sizeof cases[0]; c++) {
+        make_wrapped(cases[c][0], cases[c][1], cases[c][2]);
+
+        const int32_t* span = list_deque_make_contiguous(&test_deque);
+        TEST_ASSERT_NOT_NULL(span);
+        for (int32_t i = 0; i < (int32_t) cases[c][1]; i++) TEST_ASSERT_EQUAL_INT32(i, span[i]);
+
+        TEST_ASSERT_EQUAL_PTR(span, list_deque_at(&test_deque, 0));
+        TEST_ASSERT_EQUAL_UINT64(cases[c][0], list_deque_capacity(&test_deque));
+    }
+
+    list_deque_clear(&test_deque);
+    TEST_ASSERT_NULL(list_deque_make_contiguous(&test_deque));
+}
+
+void test_list_deque_matches_reference_with_wide_elements(void) {
+    typedef struct { uint8_t bytes[12]; } wide;
+    enum { max_elements = 512 };
+    static wide model[max_elements];
+    size_t model_head = 0;
+    size_t model_size = 0;
+    uint32_t rng = 12345;
+
+    list_deque dq;
+    TEST_ASSERT_EQUAL(LIST_OK, list_deque_init(&dq, sizeof(wide)));
+
+    for (uint32_t step = 0; step < 20000; step++) {
+        rng = rng * 1103515245u + 12345u;
+        const uint32_t op = (rng >> 16) % 6;
+
+        wide value;
+        memset(&value, (int) (step & 0xff), sizeof value);
+        value.bytes[0] = (uint8_t) (step >> 8);
+
+        if (op <= 1 && model_size < max_elements / 2) {
+            TEST_ASSERT_EQUAL(LIST_OK, list_deque_push_back(&dq, &value));
+            model[(model_head + model_size++) % max_elements] = value;
+        } else if (op == 2 && model_size < max_elements / 2) {
+            TEST_ASSERT_EQUAL(LIST_OK, list_deque_push_front(&dq, &value));
+            model_head = (model_head + max_elements - 1) % max_elements;
+            model[model_head] = value;
+            model_size++;
+        } else if (op == 3 && model_size > 0) {
+            wide out;
+            TEST_ASSERT_EQUAL(LIST_OK, list_deque_pop_front(&dq, &out));
+            TEST_ASSERT_EQUAL_MEMORY(&model[model_head], &out, sizeof out);
+            model_head = (model_head + 1) % max_elements;
+            model_size--;
+        } else if (op == 4 && model_size > 0) {
+            wide out;
+            TEST_ASSERT_EQUAL(LIST_OK, list_deque_pop_back(&dq, &out));
+            TEST_ASSERT_EQUAL_MEMORY(&model[(model_head + --model_size) % max_elements], &out, sizeof out);
+        } else if (op == 5 && step % 64 == 0) {
+            list_deque_make_contiguous(&dq);
+        }
+
+        TEST_ASSERT_EQUAL_UINT64(model_size, list_deque_size(&dq));
+    }
+
+    for (size_t i = 0; i < model_size; i++) {
+        TEST_ASSERT_EQUAL_MEMORY(&model[(model_head + i) % max_elements], list_deque_at(&dq, i), sizeof(wide));
+    }
+
+    list_deque_destroy(&dq);
+}
+
+void test_list_deque_rejects_invalid_arguments(void) {
+    const int32_t value = 1;
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_deque_init(nullptr, sizeof(int32_t)));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_deque_push_back(nullptr, &value));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_deque_push_front(&test_deque, nullptr));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_deque_get(&test_deque, 0, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(0, list_deque_size(nullptr));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_deque_works_as_fifo_queue);
+    RUN_TEST(test_list_deque_push_and_pop_at_both_ends);
+    RUN_TEST(test_list_deque_indexes_across_the_wrap);
+    RUN_TEST(test_list_deque_grows_while_wrapped);
+    RUN_TEST(test_list_deque_make_contiguous_linearizes);
+    RUN_TEST(test_list_deque_matches_reference_with_wide_elements);
+    RUN_TEST(test_list_deque_rejects_invalid_arguments);
+
+    return UNITY_END();
+}
@@ -0,0 +1,118 @@
+// Built with LIST_FAST, so list_push, list_get, list_set and list_pop below
+// are the inlined unchecked versions from list.h.
+#include <stdint.h>
+#include "list.h"
+#include "list_snapshot.h"
+#include "list_typed.h"
+#include "unity.h"
+
+static list test_list;
+
+void setUp(void) {
+    list_init(&test_list, sizeof(int64_t));
+}
+
+void tearDown(void) {
+    list_destroy(&test_list);
+}
+
+void test_list_fast_push_grows_through_checked_path(void) {
+    for (int64_t i = 0; i < 1000; i++) TEST_ASSERT_EQUAL(LIST_OK, list_push(&test_list, &i));
+
+    TEST_ASSERT_EQUAL_UINT64(1000, list_size(&test_list));
+    for (size_t i = 0; i < 1000; i++) {
+        int64_t value = -1;
+        TEST_ASSERT_EQUAL(LIST_OK, list_get(&test_list, i, &value));
+        TEST_ASSERT_EQUAL_INT64((int64_t) i, value);
+    }
+}
+
+void test_list_fast_set_and_pop(void) {
+    for (int64_t i = 0; i < 8; i++) list_push(&test_list, &i);
+
+    const int64_t replacement = 99;
+    TEST_ASSERT_EQUAL(LIST_OK, list_set(&test_list, 3, &replacement));
+    TEST_ASSERT_EQUAL_INT64(99, ((int64_t*) test_list.data)[3]);
+
+    int64_t value = -1;
+    TEST_ASSERT_EQUAL(LIST_OK, list_pop(&test_list, &value));
+    TEST_ASSERT_EQUAL_INT64(7, value);
+    TEST_ASSERT_EQUAL(LIST_OK, list_pop(&test_list, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(6, list_size(&test_list));
+}
+
+void test_list_fast_pop_still_shrinks(void) {
+    for (int64_t i = 0; i < 64; i++) list_push(&test_list, &i);
+    const size_t full_capacity = list_capacity(&test_list);
+
+    while (list_size(&test_list) > 1) list_pop(&test_list, nullptr);
+
+    TEST_ASSERT_TRUE(list_capacity(&test_list) < full_capacity);
+    TEST_ASSERT_EQUAL_INT64(0, ((int64_t*) test_list.data)[0]);
+}
+
+void test_list_fast_writes_detach_snapshots(void) {
+    // Spare capacity, so the pushes below would not need to grow the buffer
+    list_reserve(&test_list, 16);
+    for (int64_t i = 0; i < 4; i++) list_push(&test_list, &i);
+
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &snap));
+
+    const int64_t replacement = 99;
+    TEST_ASSERT_EQUAL(LIST_OK, list_set(&test_list, 0, &replacement));
+    TEST_ASSERT_EQUAL_INT64(0, ((int64_t*) snap.data)[0]);
+    TEST_ASSERT_EQUAL_INT64(99, ((int64_t*) test_list.data)[0]);
+
+    // Both lists push into the same slot of what used to be one buffer
+    list snap2;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&snap, &snap2));
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&snap, &(int64_t) { 7 }));
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&snap2, &(int64_t) { 9 }));
+    TEST_ASSERT_EQUAL_INT64(7, ((int64_t*) snap.data)[4]);
+    TEST_ASSERT_EQUAL_INT64(9, ((int64_t*) snap2.data)[4]);
+    TEST_ASSERT_EQUAL_UINT64(4, list_size(&test_list));
+
+    list_destroy(&snap);
+    list_destroy(&snap2);
+}
+
+void test_list_fast_checked_calls_remain_available(void) {
+    int64_t value = 1;
+    list_push(&test_list, &value);
+
+    // Parenthesizing the name bypasses the macro and reaches the validating function
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, (list_get)(&test_list, 5, &value));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, (list_push)(&test_list, nullptr));
+}
+
+LIST_DEFINE(int32_t, i32list)
+
+void test_list_fast_typed_lists_keep_checked_errors(void) {
+    i32list l;
+    i32list_init(&l);
+    i32list_push(&l, 7);
+
+    int32_t out = -1;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, i32list_get(&l, 1000000, &out));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, i32list_get(&l, 0, nullptr));
+    TEST_ASSERT_EQUAL_INT32(-1, out);
+
+    TEST_ASSERT_EQUAL(LIST_OK, i32list_pop(&l, &out));
+    TEST_ASSERT_EQUAL_INT32(7, out);
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, i32list_pop(&l, &out));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, i32list_peek(&l, &out));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, i32list_set(&l, 3, 1));
+    i32list_destroy(&l);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_list_fast_push_grows_through_checked_path);
+    RUN_TEST(test_list_fast_set_and_pop);
+    RUN_TEST(test_list_fast_pop_still_shrinks);
+    RUN_TEST(test_list_fast_writes_detach_snapshots);
+    RUN_TEST(test_list_fast_checked_calls_remain_available);
+    RUN_TEST(test_list_fast_typed_lists_keep_checked_errors);
+    return UNITY_END();
+}
@@ -0,0 +1,110 @@
+#include <stdint.h>
+#include "list_iter.h"
+#include "unity.h"
+
+static list test_list;
+
+void setUp(void) {
+    list_init(&test_list, sizeof(int32_t));
+}
+
+void tearDown(void) {
+    list_destroy(&test_list);
+}
+
+static void push_range(const int32_t count) {
+    for (int32_t i = 0; i < count; i++) list_push(&test_list, &i);
+}
+
+void test_list_iter_walks_forward(void) {
+    push_range(1000);
+
+    list_iter it;
+    list_iter_init(&it, &test_list, LIST_ITER_FORWARD, LIST_ITER_PREFETCH_DISTANCE);
+    TEST_ASSERT_EQUAL_UINT64(1000, list_iter_remaining(&it));
+
+    int32_t expected = 0;
+    for (const int32_t* p; (p = list_iter_next(&it)) != nullptr; expected++) {
+        TEST_ASSERT_EQUAL_PTR(list_at(&test_list, (size_t) expected), p);
+        TEST_ASSERT_EQUAL_INT32(expected, *p);
+    }
+    TEST_ASSERT_EQUAL_INT32(1000, expected);
+    TEST_ASSERT_TRUE(list_iter_done(&it));
+    TEST_ASSERT_NULL(list_iter_next(&it));
+}
+
+void test_list_iter_walks_backward(void) {
+    push_range(333);
+
+    list_iter it;
+    list_iter_init(&it, &test_list, LIST_ITER_REVERSE, 0);
+
+    int32_t expected = 332;
+    while (!list_iter_done(&it)) {
+        const int32_t* p = list_iter_next(&it);
+        TEST_ASSERT_EQUAL_INT32(expected, *p);
+        expected--;
+    }
+    TEST_ASSERT_EQUAL_INT32(-1, expected);
+}
+
+void test_list_iter_empty_lists(void) {
+    list_iter it = list_iter_begin(&test_list);
+    TEST_ASSERT_TRUE(list_iter_done(&it));
+    TEST_ASSERT_NULL(list_iter_next(&it));
+
+    void* span = nullptr;
+    it = list_iter_rbegin(&test_list);
+    TEST_ASSERT_EQUAL_UINT64(0, list_iter_next_span(&it, 16, &span));
+
+    it = list_iter_begin(nullptr);
+    TEST_ASSERT_TRUE(list_iter_done(&it));
+    TEST_ASSERT_EQUAL_UINT64(0, list_iter_remaining(&it));
+}
+
+void test_list_iter_spans_cover_the_list(void) {
+    push_range(1000);
+
+    list_iter it = list_iter_begin(&test_list);
+    int32_t* span;
+    size_t n;
+    int32_t expected = 0;
+    size_t spans = 0;
+    while ((n = list_iter_next_span(&it, 64, (void**) &span)) > 0) {
+        TEST_ASSERT_TRUE(n == 64 || (spans == 15 && n == 1000 - 15 * 64));
+        for (size_t i = 0; i < n; i++) TEST_ASSERT_EQUAL_INT32(expected++, span[i]);
+        spans++;
+    }
+    TEST_ASSERT_EQUAL_UINT64(16, spans);
+
+    // Reverse spans run back to front, each in memory order
+    list_iter_init(&it, &test_list, LIST_ITER_REVERSE, LIST_ITER_PREFETCH_DISTANCE);
+    expected = 999;
+    while ((n = list_iter_next_span(&it, 300, (void**) &span)) > 0) {
+        for (size_t i = n; i-- > 0;) TEST_ASSERT_EQUAL_INT32(expected--, span[i]);
+    }
+    TEST_ASSERT_EQUAL_INT32(-1, expected);
+}
+
+void test_list_iter_mixes_steps_and_spans(void) {
+    push_range(10);
+
+    list_iter it = list_iter_begin(&test_list);
+    TEST_ASSERT_EQUAL_INT32(0, *(int32_t*) list_iter_next(&it));
+
+    int32_t* span = nullptr;
+    TEST_ASSERT_EQUAL_UINT64(4, list_iter_next_span(&it, 4, (void**) &span));
+    TEST_ASSERT_EQUAL_INT32(1, span[0]);
+    TEST_ASSERT_EQUAL_INT32(5, *(int32_t*) list_iter_next(&it));
+    TEST_ASSERT_EQUAL_UINT64(4, list_iter_remaining(&it));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_list_iter_walks_forward);
+    RUN_TEST(test_list_iter_walks_backward);
+    RUN_TEST(test_list_iter_empty_lists);
+    RUN_TEST(test_list_iter_spans_cover_the_list);
+    RUN_TEST(test_list_iter_mixes_steps_and_spans);
+    return UNITY_END();
+}
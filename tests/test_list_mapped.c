@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "list_mapped.h"
+#include "unity.h"
+
+static const char* test_path = "list_mapped_test.bin";
+
+void setUp(void) {
+    remove(test_path);
+}
+
+void tearDown(void) {
+    remove(test_path);
+}
+
+static void fill_mapped(list* lst, const int count) {
+    for (int i = 0; i < count; i++) TEST_ASSERT_EQUAL(LIST_OK, list_push(lst, &i));
+}
+
+void test_list_mapped_reopens_with_contents(void) {
+    list lst;
+    TEST_ASSERT_EQUAL(LIST_OK, list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_CREATE));
+    fill_mapped(&lst, 10000);
+    TEST_ASSERT_EQUAL(LIST_OK, list_close_mapped(&lst));
+    TEST_ASSERT_NULL(lst.data);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_NONE));
+    TEST_ASSERT_EQUAL_UINT64(10000, list_size(&lst));
+    for (int i = 0; i < 10000; i++) {
+        TEST_ASSERT_EQUAL_INT(i, ((const int*) list_data(&lst))[i]);
+    }
+
+    // Keeps growing after reopening
+    fill_mapped(&lst, 100);
+    TEST_ASSERT_EQUAL_UINT64(10100, list_size(&lst));
+    list_destroy(&lst);
+    TEST_ASSERT_NULL(lst.allocator);
+}
+
+void test_list_mapped_destroy_persists_size(void) {
+    list lst;
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_CREATE);
+    fill_mapped(&lst, 50);
+    list_pop(&lst, nullptr);
+    TEST_ASSERT_EQUAL(LIST_OK, list_sync(&lst));
+    list_destroy(&lst);
+
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_NONE);
+    TEST_ASSERT_EQUAL_UINT64(49, list_size(&lst));
+    int last = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_peek(&lst, &last));
+    TEST_ASSERT_EQUAL_INT(48, last);
+    list_close_mapped(&lst);
+}
+
+void test_list_mapped_reopens_after_crash_following_a_shrink(void) {
+    // The child syncs a large list, shrinks the file by popping and dies without syncing again
+    const pid_t pid = fork();
+    TEST_ASSERT_TRUE(pid >= 0);
+    if (pid == 0) {
+        list lst;
+        if (list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_CREATE) != LIST_OK) _exit(1);
+        for (int i = 0; i < 100000; i++) {
+            if (list_push(&lst, &i) != LIST_OK) _exit(1);
+        }
+        if (list_sync(&lst) != LIST_OK) _exit(1);
+        while (list_size(&lst) > 10) list_pop(&lst, nullptr);
+        _exit(list_capacity(&lst) < 100000 ? 0 : 1);
+    }
+    int status = 0;
+    TEST_ASSERT_EQUAL(pid, waitpid(pid, &status, 0));
+    TEST_ASSERT_TRUE(WIFEXITED(status));
+    TEST_ASSERT_EQUAL_INT(0, WEXITSTATUS(status));
+
+    list lst;
+    TEST_ASSERT_EQUAL(LIST_OK, list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_NONE));
+    TEST_ASSERT_TRUE(list_size(&lst) >= 10);
+    TEST_ASSERT_TRUE(list_size(&lst) <= list_capacity(&lst));
+    for (size_t i = 0; i < list_size(&lst); i++) {
+        TEST_ASSERT_EQUAL_INT((int) i, ((const int*) list_data(&lst))[i]);
+    }
+    list_close_mapped(&lst);
+}
+
+void test_list_mapped_move_keeps_file_attached(void) {
+    list lst;
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_CREATE);
+    fill_mapped(&lst, 100);
+
+    list moved;
+    TEST_ASSERT_EQUAL(LIST_OK, list_move(&moved, &lst));
+    TEST_ASSERT_NULL(lst.allocator);
+    TEST_ASSERT_NULL(list_release(&moved, nullptr, nullptr));
+
+    fill_mapped(&moved, 5000);
+    list_destroy(&lst);
+    TEST_ASSERT_EQUAL(LIST_OK, list_close_mapped(&moved));
+
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_NONE);
+    TEST_ASSERT_EQUAL_UINT64(5100, list_size(&lst));
+    TEST_ASSERT_EQUAL_INT(4999, ((const int*) list_data(&lst))[5099]);
+    list_close_mapped(&lst);
+}
+
+void test_list_mapped_truncate_starts_empty(void) {
+    list lst;
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_CREATE);
+    fill_mapped(&lst, 20);
+    list_close_mapped(&lst);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_TRUNCATE));
+    TEST_ASSERT_EQUAL_UINT64(0, list_size(&lst));
+    TEST_ASSERT_NOT_NULL(lst.data);
+    list_close_mapped(&lst);
+}
+
+void test_list_mapped_shrink_to_empty_keeps_file_attached(void) {
+    list lst;
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_CREATE);
+    fill_mapped(&lst, 5000);
+    while (list_size(&lst) > 0) list_pop(&lst, nullptr);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_shrink_to_fit(&lst));
+    TEST_ASSERT_NOT_NULL(lst.data);
+    TEST_ASSERT_EQUAL(LIST_OK, list_sync(&lst));
+
+    fill_mapped(&lst, 10);
+    TEST_ASSERT_EQUAL(LIST_OK, list_sync(&lst));
+    list_destroy(&lst);
+
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_NONE);
+    TEST_ASSERT_EQUAL_UINT64(10, list_size(&lst));
+    TEST_ASSERT_EQUAL_INT(9, ((const int*) list_data(&lst))[9]);
+    list_close_mapped(&lst);
+}
+
+void test_list_mapped_clear_and_release_keeps_file_attached(void) {
+    list lst;
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_CREATE);
+    fill_mapped(&lst, 5000);
+    list_clear_and_release(&lst);
+    TEST_ASSERT_EQUAL_UINT64(0, list_size(&lst));
+
+    fill_mapped(&lst, 10);
+    list_destroy(&lst);
+
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_NONE);
+    TEST_ASSERT_EQUAL_UINT64(10, list_size(&lst));
+    TEST_ASSERT_EQUAL_INT(9, ((const int*) list_data(&lst))[9]);
+    list_close_mapped(&lst);
+}
+
+void test_list_mapped_rejects_mismatched_files(void) {
+    list lst;
+    TEST_ASSERT_EQUAL(LIST_ERR_IO, list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_NONE));
+
+    list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_CREATE);
+    list_close_mapped(&lst);
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_open_mapped(&lst, test_path, sizeof(double), LIST_MAP_NONE));
+
+    FILE* file = fopen(test_path, "wb");
+    fputs("not a list header, just some text that is long enough to fill one", file);
+    fclose(file);
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_open_mapped(&lst, test_path, sizeof(int), LIST_MAP_NONE));
+}
+
+void test_list_mapped_sync_requires_mapped_list(void) {
+    list lst;
+    list_init(&lst, sizeof(int));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_sync(&lst));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_close_mapped(&lst));
+    list_destroy(&lst);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_mapped_reopens_with_contents);
+    RUN_TEST(test_list_mapped_destroy_persists_size);
+    RUN_TEST(test_list_mapped_reopens_after_crash_following_a_shrink);
+    RUN_TEST(test_list_mapped_move_keeps_file_attached);
+    RUN_TEST(test_list_mapped_truncate_starts_empty);
+    RUN_TEST(test_list_mapped_shrink_to_empty_keeps_file_attached);
+    RUN_TEST(test_list_mapped_clear_and_release_keeps_file_attached);
+    RUN_TEST(test_list_mapped_rejects_mismatched_files);
+    RUN_TEST(test_list_mapped_sync_requires_mapped_list);
+
+    return UNITY_END();
+}
@@ -0,0 +1,157 @@
+#include <stdint.h>
+#include <string.h>
+#include "list_packed.h"
+#include "unity.h"
+
+static list_packed test_packed;
+
+void setUp(void) {
+    list_packed_init(&test_packed, sizeof(uint64_t));
+}
+
+void tearDown(void) {
+    list_packed_destroy(&test_packed);
+}
+
+static uint64_t next_random(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static void assert_matches(const list_packed* pk, const uint64_t* expected, const size_t count) {
+    enum { cap = 8192 };
+    static uint64_t decoded[cap];
+    TEST_ASSERT_TRUE(count <= cap);
+
+    TEST_ASSERT_EQUAL_size_t(count, list_packed_size(pk));
+    TEST_ASSERT_EQUAL(LIST_OK, list_packed_decode(pk, 0, count, decoded));
+    TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, decoded, count);
+
+    for (size_t i = 0; i < count; i++) {
+        uint64_t value = 0;
+        TEST_ASSERT_EQUAL(LIST_OK, list_packed_get(pk, i, &value));
+        TEST_ASSERT_EQUAL_UINT64(expected[i], value);
+    }
+}
+
+void test_list_packed_round_trips_sorted_ids(void) {
+    enum { n = 1000 };
+    uint64_t ids[n];
+    uint64_t state = 1;
+    uint64_t id = 1u << 20;
+    for (size_t i = 0; i < n; i++) {
+        id += next_random(&state) % 50;
+        ids[i] = id;
+        TEST_ASSERT_EQUAL(LIST_OK, list_packed_push(&test_packed, &ids[i]));
+    }
+
+    assert_matches(&test_packed, ids, n);
+}
+
+void test_list_packed_handles_every_width(void) {
+    // One block per width from 0 to 32 bits, unsorted so each is frame of reference
+    enum { widths = 33, n = widths * LIST_PACKED_BLOCK };
+    static uint64_t values[n];
+    uint64_t state = 7;
+    for (size_t w = 0; w < widths; w++) {
+        const uint64_t mask = w == 0 ? 0 : (UINT64_MAX >> (64 - w));
+        for (size_t i = 0; i < LIST_PACKED_BLOCK; i++) {
+            values[w * LIST_PACKED_BLOCK + i] = 1000 + (next_random(&state) & mask);
+        }
+        values[w * LIST_PACKED_BLOCK] = 1000 + mask;
+        values[w * LIST_PACKED_BLOCK + 1] = 1000;
+    }
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_packed_push_n(&test_packed, values, n));
+    assert_matches(&test_packed, values, n);
+}
+
+void test_list_packed_keeps_wide_and_extreme_values(void) {
+    enum { n = 3 * LIST_PACKED_BLOCK + 5 };
+    uint64_t values[n];
+    uint64_t state = 99;
+    for (size_t i = 0; i < n; i++) values[i] = next_random(&state);
+    values[0] = 0;
+    values[1] = UINT64_MAX;
+
+    // Mix the push paths: a few single pushes, then a bulk push spanning blocks
+    for (size_t i = 0; i < 10; i++) list_packed_push(&test_packed, &values[i]);
+    TEST_ASSERT_EQUAL(LIST_OK, list_packed_push_n(&test_packed, values + 10, n - 10));
+
+    assert_matches(&test_packed, values, n);
+}
+
+void test_list_packed_decodes_ranges_across_blocks(void) {
+    enum { n = 5 * LIST_PACKED_BLOCK + 17 };
+    uint64_t values[n];
+    for (size_t i = 0; i < n; i++) values[i] = 3 * i;
+    list_packed_push_n(&test_packed, values, n);
+
+    uint64_t out[n];
+    const size_t ranges[][2] = { { 0, 1 }, { 100, 200 }, { 127, 2 }, { 640, 17 }, { 600, 57 }, { 5, n - 5 } };
+    for (size_t r = 0; r < sizeof ranges / sizeof ranges[0]; r++) {
+        memset(out, 0, sizeof out);
+        TEST_ASSERT_EQUAL(LIST_OK, list_packed_decode(&test_packed, ranges[r][0], ranges[r][1], out));
+        TEST_ASSERT_EQUAL_UINT64_ARRAY(values + ranges[r][0], out, ranges[r][1]);
+    }
+
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_packed_decode(&test_packed, n - 1, 2, out));
+    TEST_ASSERT_EQUAL(LIST_OK, list_packed_decode(&test_packed, n, 0, out));
+}
+
+void test_list_packed_compresses_32_bit_ids(void) {
+    enum { n = 100000 };
+    list ids;
+    list_init_with_capacity(&ids, n, sizeof(uint32_t));
+    for (uint32_t i = 0; i < n; i++) {
+        const uint32_t id = 5000000 + 3 * i + (i % 3);
+        list_push(&ids, &id);
+    }
+
+    list_packed pk;
+    TEST_ASSERT_EQUAL(LIST_OK, list_packed_from_list(&pk, &ids));
+    TEST_ASSERT_EQUAL(LIST_OK, list_packed_shrink_to_fit(&pk));
+    TEST_ASSERT_TRUE(list_packed_bytes(&pk) * 4 < n * sizeof(uint32_t));
+
+    for (size_t i = 0; i < n; i += 997) {
+        uint32_t value = 0;
+        TEST_ASSERT_EQUAL(LIST_OK, list_packed_get(&pk, i, &value));
+        TEST_ASSERT_EQUAL_UINT32(*(const uint32_t*) list_at(&ids, i), value);
+    }
+
+    static uint32_t decoded[n];
+    TEST_ASSERT_EQUAL(LIST_OK, list_packed_decode(&pk, 0, n, decoded));
+    TEST_ASSERT_EQUAL_MEMORY(list_data(&ids), decoded, sizeof decoded);
+
+    list_packed_clear(&pk);
+    TEST_ASSERT_EQUAL_size_t(0, list_packed_size(&pk));
+    list_packed_destroy(&pk);
+    list_destroy(&ids);
+}
+
+void test_list_packed_rejects_invalid_arguments(void) {
+    list_packed pk;
+    uint64_t value = 0;
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_packed_init(&pk, 2));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_packed_init(nullptr, 8));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_packed_push(&test_packed, nullptr));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_packed_push_n(&test_packed, nullptr, 3));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_packed_get(&test_packed, 0, &value));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_packed_get(&test_packed, 0, nullptr));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_packed_round_trips_sorted_ids);
+    RUN_TEST(test_list_packed_handles_every_width);
+    RUN_TEST(test_list_packed_keeps_wide_and_extreme_values);
+    RUN_TEST(test_list_packed_decodes_ranges_across_blocks);
+    RUN_TEST(test_list_packed_compresses_32_bit_ids);
+    RUN_TEST(test_list_packed_rejects_invalid_arguments);
+
+    return UNITY_END();
+}
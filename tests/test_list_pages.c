@@ -0,0 +1,100 @@
+#include <stdint.h>
+#include "list_pages.h"
+#include "unity.h"
+
+static list_pages test_pages;
+static list test_list;
+
+void setUp(void) {}
+
+void tearDown(void) {
+    list_destroy(&test_list);
+}
+
+static bool is_aligned(const void* ptr, const size_t alignment) {
+    return ((uintptr_t) ptr & (alignment - 1)) == 0;
+}
+
+/**
+ * Pushes `count` values one at a time, checking the buffer's alignment at
+ * every reallocation, then checks that no value was lost on the way.
+ */
+static void push_and_verify(const size_t count, const size_t alignment) {
+    const void* last_data = nullptr;
+
+    for (uint64_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(LIST_OK, list_push(&test_list, &i));
+        if (test_list.data != last_data) {
+            TEST_ASSERT_TRUE(is_aligned(test_list.data, alignment));
+            last_data = test_list.data;
+        }
+    }
+
+    const uint64_t* values = test_list.data;
+    for (uint64_t i = 0; i < count; i++) {
+        if (values[i] != i) TEST_FAIL_MESSAGE("value lost while growing");
+    }
+}
+
+void test_list_pages_aligns_heap_buffers(void) {
+    const size_t alignments[] = { LIST_CACHE_LINE_SIZE, 256, LIST_PAGE_SIZE };
+
+    for (size_t a = 0; a < sizeof alignments / sizeof alignments[0]; a++) {
+        TEST_ASSERT_EQUAL(LIST_OK, list_pages_init(&test_pages, alignments[a], 0, LIST_PAGES_NONE));
+        TEST_ASSERT_EQUAL(LIST_OK, list_init_with_allocator(&test_list, 3, sizeof(uint64_t), list_pages_allocator(&test_pages)));
+
+        push_and_verify(20000, alignments[a]);
+
+        TEST_ASSERT_EQUAL(LIST_OK, list_shrink_to_fit(&test_list));
+        TEST_ASSERT_TRUE(is_aligned(test_list.data, alignments[a]));
+        list_destroy(&test_list);
+    }
+}
+
+void test_list_pages_maps_large_buffers(void) {
+    const unsigned flag_sets[] = { LIST_PAGES_MAP, LIST_PAGES_HUGEPAGE, LIST_PAGES_HUGETLB };
+
+    for (size_t f = 0; f < sizeof flag_sets / sizeof flag_sets[0]; f++) {
+        TEST_ASSERT_EQUAL(LIST_OK, list_pages_init(&test_pages, LIST_CACHE_LINE_SIZE, 64 * 1024, flag_sets[f]));
+        TEST_ASSERT_EQUAL(LIST_OK, list_init_with_allocator(&test_list, 0, sizeof(uint64_t), list_pages_allocator(&test_pages)));
+
+        // Grows through heap buffers into mapped ones, which are page aligned
+        push_and_verify(300000, LIST_CACHE_LINE_SIZE);
+        TEST_ASSERT_TRUE(is_aligned(test_list.data, LIST_PAGE_SIZE));
+
+        // Shrinking below the threshold moves the contents back to the heap
+        for (size_t i = 0; i < 299000; i++) list_pop(&test_list, nullptr);
+        TEST_ASSERT_EQUAL(LIST_OK, list_shrink_to_fit(&test_list));
+        TEST_ASSERT_TRUE(is_aligned(test_list.data, LIST_CACHE_LINE_SIZE));
+        for (uint64_t i = 0; i < 1000; i++) TEST_ASSERT_EQUAL_UINT64(i, ((uint64_t*) test_list.data)[i]);
+
+        list_destroy(&test_list);
+    }
+}
+
+void test_list_pages_defaults(void) {
+    TEST_ASSERT_EQUAL(LIST_OK, list_pages_init(&test_pages, 0, 0, LIST_PAGES_HUGEPAGE));
+    TEST_ASSERT_EQUAL_UINT64(alignof(max_align_t), test_pages.alignment);
+    TEST_ASSERT_EQUAL_UINT64(LIST_PAGES_DEFAULT_THRESHOLD, test_pages.map_threshold);
+    TEST_ASSERT_TRUE(test_pages.granule >= LIST_HUGE_PAGE_SIZE);
+    TEST_ASSERT_EQUAL_PTR(&test_pages.allocator, list_pages_allocator(&test_pages));
+}
+
+void test_list_pages_rejects_invalid_arguments(void) {
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_pages_init(nullptr, 64, 0, LIST_PAGES_NONE));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_pages_init(&test_pages, 48, 0, LIST_PAGES_NONE));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_pages_init(&test_pages, 2 * LIST_PAGE_SIZE, 0, LIST_PAGES_NONE));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_pages_init(&test_pages, 64, 0, 1u << 7));
+    TEST_ASSERT_NULL(list_pages_allocator(nullptr));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_pages_aligns_heap_buffers);
+    RUN_TEST(test_list_pages_maps_large_buffers);
+    RUN_TEST(test_list_pages_defaults);
+    RUN_TEST(test_list_pages_rejects_invalid_arguments);
+
+    return UNITY_END();
+}
@@ -0,0 +1,101 @@
+#include <stdatomic.h>
+#include "list_parallel.h"
+#include "unity.h"
+
+static constexpr uint64_t element_count = 1000003;
+
+static list test_list;
+
+void setUp(void) {
+    list_init_with_capacity(&test_list, element_count, sizeof(uint64_t));
+    for (uint64_t i = 0; i < element_count; i++) list_push(&test_list, &i);
+}
+
+void tearDown(void) {
+    list_destroy(&test_list);
+}
+
+static void double_range(void* elems, const size_t count, const size_t first_index, void* ctx) {
+    uint64_t* values = elems;
+    for (size_t i = 0; i < count; i++) {
+        if (values[i] != first_index + i) atomic_fetch_add((atomic_size_t*) ctx, 1);
+        values[i] *= 2;
+    }
+}
+
+static void sum_range(const void* elems, const size_t count, void* accumulator, [[maybe_unused]] void* ctx) {
+    const uint64_t* values = elems;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; i++) sum += values[i];
+    *(uint64_t*) accumulator += sum;
+}
+
+static void sum_combine(void* accumulator, const void* other, [[maybe_unused]] void* ctx) {
+    *(uint64_t*) accumulator += *(const uint64_t*) other;
+}
+
+static void sum_range_double(const void* elems, const size_t count, void* accumulator, [[maybe_unused]] void* ctx) {
+    const uint64_t* values = elems;
+    for (size_t i = 0; i < count; i++) *(double*) accumulator += 1.0 / (double) (values[i] + 1);
+}
+
+static void sum_combine_double(void* accumulator, const void* other, [[maybe_unused]] void* ctx) {
+    *(double*) accumulator += *(const double*) other;
+}
+
+static void nested_reduce(void* elems, const size_t count, [[maybe_unused]] size_t first_index, void* ctx) {
+    list inner = { .data = elems, .size = count, .capacity = count, .elem_size = sizeof(uint64_t) };
+    uint64_t sum = 0;
+    list_parallel_reduce(&inner, sum_range, sum_combine, &sum, sizeof sum, nullptr, 4);
+    atomic_fetch_add((_Atomic uint64_t*) ctx, sum);
+}
+
+void test_list_parallel_for_visits_every_element_once(void) {
+    atomic_size_t mismatches = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_parallel_for(&test_list, double_range, &mismatches, 4));
+    TEST_ASSERT_EQUAL_UINT64(0, mismatches);
+
+    const uint64_t* values = list_data(&test_list);
+    for (uint64_t i = 0; i < element_count; i++) TEST_ASSERT_EQUAL_UINT64(2 * i, values[i]);
+}
+
+void test_list_parallel_reduce_sums_elements(void) {
+    uint64_t sum = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_parallel_reduce(&test_list, sum_range, sum_combine, &sum, sizeof sum, nullptr, 0));
+    TEST_ASSERT_EQUAL_UINT64(element_count * (element_count - 1) / 2, sum);
+}
+
+void test_list_parallel_reduce_is_independent_of_thread_count(void) {
+    double serial = 0.0;
+    double parallel = 0.0;
+    list_parallel_reduce(&test_list, sum_range_double, sum_combine_double, &serial, sizeof serial, nullptr, 1);
+    list_parallel_reduce(&test_list, sum_range_double, sum_combine_double, &parallel, sizeof parallel, nullptr, 8);
+
+    TEST_ASSERT_TRUE(serial == parallel);
+}
+
+void test_list_parallel_nested_calls_run_serially(void) {
+    _Atomic uint64_t total = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_parallel_for(&test_list, nested_reduce, &total, 4));
+    TEST_ASSERT_EQUAL_UINT64(element_count * (element_count - 1) / 2, total);
+}
+
+void test_list_parallel_rejects_invalid_arguments(void) {
+    uint64_t sum = 0;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_parallel_for(&test_list, nullptr, nullptr, 0));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_parallel_reduce(&test_list, sum_range, nullptr, &sum, sizeof sum, nullptr, 0));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_parallel_reduce(&test_list, sum_range, sum_combine, &sum, 0, nullptr, 0));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_parallel_for_visits_every_element_once);
+    RUN_TEST(test_list_parallel_reduce_sums_elements);
+    RUN_TEST(test_list_parallel_reduce_is_independent_of_thread_count);
+    RUN_TEST(test_list_parallel_nested_calls_run_serially);
+    RUN_TEST(test_list_parallel_rejects_invalid_arguments);
+
+    list_parallel_shutdown();
+    return UNITY_END();
+}
@@ -0,0 +1,116 @@
+#include "list_segmented.h"
+#include "unity.h"
+
+static list_segmented test_list;
+
+void setUp(void) {
+    list_segmented_init_with_capacity(&test_list, 4, sizeof(int));
+}
+
+void tearDown(void) {
+    list_segmented_destroy(&test_list);
+}
+
+void test_list_segmented_push_and_get_across_chunks(void) {
+    for (int i = 0; i < 1000; i++) {
+        TEST_ASSERT_EQUAL(LIST_OK, list_segmented_push(&test_list, &i));
+    }
+
+    TEST_ASSERT_EQUAL_UINT64(1000, list_segmented_size(&test_list));
+    for (int i = 0; i < 1000; i++) {
+        int value = -1;
+        TEST_ASSERT_EQUAL(LIST_OK, list_segmented_get(&test_list, (size_t) i, &value));
+        TEST_ASSERT_EQUAL_INT(i, value);
+    }
+
+    int value;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_segmented_get(&test_list, 1000, &value));
+}
+
+void test_list_segmented_push_keeps_element_addresses(void) {
+    int first = 7;
+    list_segmented_push(&test_list, &first);
+    const int* pinned = list_segmented_at(&test_list, 0);
+
+    for (int i = 0; i < 10000; i++) list_segmented_push(&test_list, &i);
+
+    TEST_ASSERT_EQUAL_PTR(pinned, list_segmented_at(&test_list, 0));
+    TEST_ASSERT_EQUAL_INT(7, *pinned);
+}
+
+void test_list_segmented_set_overwrites_value(void) {
+    for (int i = 0; i < 10; i++) list_segmented_push(&test_list, &i);
+
+    const int replacement = 99;
+    TEST_ASSERT_EQUAL(LIST_OK, list_segmented_set(&test_list, 5, &replacement));
+    TEST_ASSERT_EQUAL_INT(99, *(const int*) list_segmented_at(&test_list, 5));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_segmented_set(&test_list, 10, &replacement));
+}
+
+void test_list_segmented_pop_releases_chunks_with_hysteresis(void) {
+    for (int i = 0; i < 28; i++) list_segmented_push(&test_list, &i);
+    TEST_ASSERT_EQUAL_UINT64(28, list_segmented_capacity(&test_list));
+
+    // Emptying the last chunk keeps it as a reserve
+    int value = 0;
+    for (int i = 0; i < 16; i++) list_segmented_pop(&test_list, &value);
+    TEST_ASSERT_EQUAL_INT(12, value);
+    TEST_ASSERT_EQUAL_UINT64(28, list_segmented_capacity(&test_list));
+
+    // Emptying the chunk beneath it releases the last one
+    for (int i = 0; i < 8; i++) list_segmented_pop(&test_list, &value);
+    TEST_ASSERT_EQUAL_INT(4, value);
+    TEST_ASSERT_EQUAL_UINT64(12, list_segmented_capacity(&test_list));
+
+    while (list_segmented_size(&test_list) > 0) list_segmented_pop(&test_list, nullptr);
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_segmented_pop(&test_list, nullptr));
+}
+
+void test_list_segmented_clear_keeps_chunks(void) {
+    for (int i = 0; i < 100; i++) list_segmented_push(&test_list, &i);
+    const size_t capacity = list_segmented_capacity(&test_list);
+
+    list_segmented_clear(&test_list);
+
+    TEST_ASSERT_EQUAL_UINT64(0, list_segmented_size(&test_list));
+    TEST_ASSERT_EQUAL_UINT64(capacity, list_segmented_capacity(&test_list));
+    TEST_ASSERT_NULL(list_segmented_at(&test_list, 0));
+}
+
+void test_list_segmented_rejects_invalid_arguments(void) {
+    list_segmented seg;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_segmented_init(&seg, 0));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_segmented_init(nullptr, sizeof(int)));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_segmented_push(&test_list, nullptr));
+    TEST_ASSERT_EQUAL(
+        LIST_ERR_INVALID, list_segmented_init_with_capacity(&seg, LIST_SEGMENTED_MAX_FIRST_CHUNK + 1, sizeof(int)));
+}
+
+void test_list_segmented_accepts_largest_first_chunk(void) {
+    list_segmented seg;
+    TEST_ASSERT_EQUAL(
+        LIST_OK, list_segmented_init_with_capacity(&seg, LIST_SEGMENTED_MAX_FIRST_CHUNK, sizeof(int)));
+
+    constexpr int value = 5;
+    int out = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_segmented_push(&seg, &value));
+    TEST_ASSERT_EQUAL(LIST_OK, list_segmented_get(&seg, 0, &out));
+    TEST_ASSERT_EQUAL_INT(5, out);
+    TEST_ASSERT_EQUAL_UINT64(LIST_SEGMENTED_MAX_FIRST_CHUNK, list_segmented_capacity(&seg));
+
+    list_segmented_destroy(&seg);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_segmented_push_and_get_across_chunks);
+    RUN_TEST(test_list_segmented_push_keeps_element_addresses);
+    RUN_TEST(test_list_segmented_set_overwrites_value);
+    RUN_TEST(test_list_segmented_pop_releases_chunks_with_hysteresis);
+    RUN_TEST(test_list_segmented_clear_keeps_chunks);
+    RUN_TEST(test_list_segmented_rejects_invalid_arguments);
+    RUN_TEST(test_list_segmented_accepts_largest_first_chunk);
+
+    return UNITY_END();
+}
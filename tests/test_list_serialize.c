@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "list_serialize.h"
+#include "unity.h"
+
+static list test_list;
+
+void setUp(void) {
+    list_init(&test_list, sizeof(int));
+    for (int i = 0; i < 100; i++) list_push(&test_list, &i);
+}
+
+void tearDown(void) {
+    list_destroy(&test_list);
+}
+
+void test_list_save_and_load_round_trip(void) {
+    unsigned char buffer[LIST_SERIALIZE_HEADER_SIZE + 100 * sizeof(int)];
+    TEST_ASSERT_EQUAL_UINT64(sizeof buffer, list_serialized_size(&test_list));
+
+    size_t written = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_save(&test_list, buffer, sizeof buffer, LIST_SERIALIZE_CHECKSUM, &written));
+    TEST_ASSERT_EQUAL_UINT64(sizeof buffer, written);
+
+    list loaded;
+    TEST_ASSERT_EQUAL(LIST_OK, list_load(&loaded, buffer, sizeof buffer));
+    TEST_ASSERT_EQUAL_UINT64(100, list_size(&loaded));
+    TEST_ASSERT_EQUAL_INT_ARRAY(list_data(&test_list), list_data(&loaded), 100);
+    list_destroy(&loaded);
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_save(&test_list, buffer, sizeof buffer - 1, LIST_SERIALIZE_NONE, nullptr));
+}
+
+void test_list_view_reads_buffer_in_place(void) {
+    unsigned char buffer[LIST_SERIALIZE_HEADER_SIZE + 100 * sizeof(int)];
+    list_save(&test_list, buffer, sizeof buffer, LIST_SERIALIZE_NONE, nullptr);
+
+    list_view view;
+    TEST_ASSERT_EQUAL(LIST_OK, list_view_from_buffer(&view, buffer, sizeof buffer));
+    TEST_ASSERT_EQUAL_UINT64(100, view.size);
+    TEST_ASSERT_EQUAL_PTR(buffer + LIST_SERIALIZE_HEADER_SIZE, view.data);
+    TEST_ASSERT_EQUAL_INT(42, *(const int*) list_view_at(&view, 42));
+    TEST_ASSERT_NULL(list_view_at(&view, 100));
+
+    const list_view live = list_view_of(&test_list);
+    TEST_ASSERT_EQUAL_PTR(list_data(&test_list), live.data);
+    TEST_ASSERT_EQUAL_UINT64(100, live.size);
+}
+
+void test_list_view_rejects_corrupt_buffers(void) {
+    unsigned char buffer[LIST_SERIALIZE_HEADER_SIZE + 100 * sizeof(int)];
+    list_save(&test_list, buffer, sizeof buffer, LIST_SERIALIZE_CHECKSUM, nullptr);
+
+    list_view view;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_view_from_buffer(&view, buffer, sizeof buffer - 4));
+
+    buffer[LIST_SERIALIZE_HEADER_SIZE + 10] ^= 0xff;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_view_from_buffer(&view, buffer, sizeof buffer));
+
+    memset(buffer, 0, LIST_SERIALIZE_HEADER_SIZE);
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_view_from_buffer(&view, buffer, sizeof buffer));
+}
+
+void test_list_write_and_read_fd_round_trip(void) {
+    int fds[2];
+    TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_write_fd(&test_list, fds[1], LIST_SERIALIZE_CHECKSUM));
+    close(fds[1]);
+
+    list received;
+    TEST_ASSERT_EQUAL(LIST_OK, list_read_fd(&received, fds[0]));
+    TEST_ASSERT_EQUAL_UINT64(100, list_size(&received));
+    TEST_ASSERT_EQUAL_INT_ARRAY(list_data(&test_list), list_data(&received), 100);
+    list_destroy(&received);
+
+    // The stream is exhausted, so a second read ends early
+    TEST_ASSERT_EQUAL(LIST_ERR_IO, list_read_fd(&received, fds[0]));
+    close(fds[0]);
+}
+
+void test_list_serialize_empty_list(void) {
+    list empty;
+    list_init(&empty, sizeof(int));
+
+    unsigned char buffer[LIST_SERIALIZE_HEADER_SIZE];
+    TEST_ASSERT_EQUAL(LIST_OK, list_save(&empty, buffer, sizeof buffer, LIST_SERIALIZE_CHECKSUM, nullptr));
+
+    list loaded;
+    TEST_ASSERT_EQUAL(LIST_OK, list_load(&loaded, buffer, sizeof buffer));
+    TEST_ASSERT_EQUAL_UINT64(0, list_size(&loaded));
+    TEST_ASSERT_EQUAL_UINT64(sizeof(int), loaded.elem_size);
+
+    list_destroy(&loaded);
+    list_destroy(&empty);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_save_and_load_round_trip);
+    RUN_TEST(test_list_view_reads_buffer_in_place);
+    RUN_TEST(test_list_view_rejects_corrupt_buffers);
+    RUN_TEST(test_list_write_and_read_fd_round_trip);
+    RUN_TEST(test_list_serialize_empty_list);
+
+    return UNITY_END();
+}
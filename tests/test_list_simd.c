@@ -0,0 +1,189 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list.h"
+#include "unity.h"
+
+static list test_list;
+static list other_list;
+
+static const size_t elem_sizes[] = { 1, 2, 3, 4, 8, 16 };
+
+void setUp(void) {}
+
+void tearDown(void) {
+    list_destroy(&test_list);
+    list_destroy(&other_list);
+}
+
+static void make_value(uint8_t* value, const size_t elem_size, const uint8_t seed) {
+    for (size_t b = 0; b < elem_size; b++) value[b] = (uint8_t) (seed + b * 31);
+}
+
+/**
+ * Fills a list with values that differ from `seed` in exactly one byte, so
+ * that any partial element match would be reported as a false positive.
+ */
+static void fill_near_misses(const size_t elem_size, const size_t count, const uint8_t seed) {
+    uint8_t value[16];
+
+    list_init(&test_list, elem_size);
+    for (size_t i = 0; i < count; i++) {
+        make_value(value, elem_size, seed);
+        value[i % elem_size] ^= 0x80;
+        list_push(&test_list, value);
+    }
+}
+
+void test_list_simd_backend_is_named(void) {
+    const char* backend = list_simd_backend();
+    const char* forced = getenv("LIST_SIMD");
+
+    TEST_ASSERT_NOT_NULL(backend);
+    TEST_ASSERT_TRUE(strcmp(backend, "avx2") == 0 || strcmp(backend, "sse2") == 0
+                     || strcmp(backend, "neon") == 0 || strcmp(backend, "scalar") == 0);
+    if (forced != nullptr && strcmp(forced, "scalar") == 0) TEST_ASSERT_EQUAL_STRING("scalar", backend);
+}
+
+void test_list_find_every_position(void) {
+    uint8_t value[16];
+
+    for (size_t s = 0; s < sizeof elem_sizes / sizeof elem_sizes[0]; s++) {
+        const size_t elem_size = elem_sizes[s];
+        make_value(value, elem_size, 7);
+
+        // Sizes straddle the 16, 32 and 64-byte vector and block boundaries
+        for (size_t count = 0; count <= 150; count += count < 20 ? 1 : 13) {
+            fill_near_misses(elem_size, count, 7);
+            TEST_ASSERT_EQUAL_UINT64(LIST_NOT_FOUND, list_find(&test_list, value));
+            TEST_ASSERT_FALSE(list_contains(&test_list, value));
+
+            // Each match is found, and a second one just after it does not hide it
+            for (size_t pos = 0; pos < count; pos++) {
+                uint8_t original[16];
+                list_get(&test_list, pos, original);
+                list_set(&test_list, pos, value);
+                TEST_ASSERT_EQUAL_UINT64(pos, list_find(&test_list, value));
+
+                if (pos + 1 < count) {
+                    uint8_t next[16];
+                    list_get(&test_list, pos + 1, next);
+                    list_set(&test_list, pos + 1, value);
+                    TEST_ASSERT_EQUAL_UINT64(pos, list_find(&test_list, value));
+                    list_set(&test_list, pos + 1, next);
+                }
+
+                list_set(&test_list, pos, original);
+            }
+            list_destroy(&test_list);
+        }
+    }
+}
+
+void test_list_count_matches_reference(void) {
+    uint8_t value[16];
+
+    for (size_t s = 0; s < sizeof elem_sizes / sizeof elem_sizes[0]; s++) {
+        const size_t elem_size = elem_sizes[s];
+        make_value(value, elem_size, 42);
+
+        list_destroy(&test_list);
+        fill_near_misses(elem_size, 301, 42);
+
+        size_t expected = 0;
+        for (size_t i = 0; i < 301; i++) {
+            if (i % 3 == 0 || i % 7 == 0) {
+                list_set(&test_list, i, value);
+                expected++;
+            }
+        }
+
+        TEST_ASSERT_EQUAL_UINT64(expected, list_count(&test_list, value));
+        TEST_ASSERT_EQUAL_UINT64(0, list_find(&test_list, value));
+    }
+}
+
+void test_list_find_rejects_invalid_arguments(void) {
+    const int value = 1;
+
+    TEST_ASSERT_EQUAL_UINT64(LIST_NOT_FOUND, list_find(nullptr, &value));
+    TEST_ASSERT_EQUAL_UINT64(0, list_count(nullptr, &value));
+    TEST_ASSERT_FALSE(list_contains(nullptr, &value));
+
+    list_init(&test_list, sizeof(int));
+    TEST_ASSERT_EQUAL_UINT64(LIST_NOT_FOUND, list_find(&test_list, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(LIST_NOT_FOUND, list_find(&test_list, &value));
+    TEST_ASSERT_EQUAL_UINT64(0, list_count(&test_list, &value));
+}
+
+void test_list_fill_appends_copies(void) {
+    uint8_t value[16];
+    uint8_t out[16];
+
+    for (size_t s = 0; s < sizeof elem_sizes / sizeof elem_sizes[0]; s++) {
+        const size_t elem_size = elem_sizes[s];
+        make_value(value, elem_size, 99);
+
+        for (size_t count = 0; count <= 150; count += count < 20 ? 1 : 13) {
+            const uint8_t head = 0x5a;
+            uint8_t first[16];
+            memset(first, head, sizeof first);
+
+            list_init(&test_list, elem_size);
+            list_push(&test_list, first);
+            TEST_ASSERT_EQUAL(LIST_OK, list_fill(&test_list, value, count));
+            TEST_ASSERT_EQUAL_UINT64(count + 1, list_size(&test_list));
+
+            list_get(&test_list, 0, out);
+            TEST_ASSERT_EQUAL_MEMORY(first, out, elem_size);
+            for (size_t i = 1; i <= count; i++) {
+                list_get(&test_list, i, out);
+                TEST_ASSERT_EQUAL_MEMORY(value, out, elem_size);
+            }
+            TEST_ASSERT_EQUAL_UINT64(count, list_count(&test_list, value));
+            list_destroy(&test_list);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_fill(nullptr, value, 1));
+    list_init(&test_list, sizeof(int));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_fill(&test_list, nullptr, 1));
+}
+
+void test_list_equal_compares_contents(void) {
+    list_init(&test_list, sizeof(int));
+    list_init(&other_list, sizeof(int));
+    TEST_ASSERT_TRUE(list_equal(&test_list, &other_list));
+
+    for (int i = 0; i < 100; i++) {
+        list_push(&test_list, &i);
+        list_push(&other_list, &i);
+    }
+    TEST_ASSERT_TRUE(list_equal(&test_list, &other_list));
+    TEST_ASSERT_TRUE(list_equal(&test_list, &test_list));
+
+    const int changed = -1;
+    list_set(&other_list, 99, &changed);
+    TEST_ASSERT_FALSE(list_equal(&test_list, &other_list));
+
+    list_pop(&other_list, nullptr);
+    TEST_ASSERT_FALSE(list_equal(&test_list, &other_list));
+
+    list_destroy(&other_list);
+    list_init(&other_list, sizeof(int16_t));
+    TEST_ASSERT_FALSE(list_equal(&test_list, &other_list));
+    TEST_ASSERT_FALSE(list_equal(&test_list, nullptr));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_simd_backend_is_named);
+    RUN_TEST(test_list_find_every_position);
+    RUN_TEST(test_list_count_matches_reference);
+    RUN_TEST(test_list_find_rejects_invalid_arguments);
+    RUN_TEST(test_list_fill_appends_copies);
+    RUN_TEST(test_list_equal_compares_contents);
+
+    return UNITY_END();
+}
@@ -0,0 +1,388 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <threads.h>
+#include "list_snapshot.h"
+#include "list_segmented.h"
+#include "list_sort.h"
+#include "unity.h"
+
+static list test_list;
+
+void setUp(void) {
+    list_init(&test_list, sizeof(int));
+}
+
+void tearDown(void) {
+    list_destroy(&test_list);
+}
+
+static void push_range(list* lst, const int count) {
+    for (int i = 0; i < count; i++) list_push(lst, &i);
+}
+
+static int compare_ints_descending(const void* a, const void* b) {
+    return *(const int*) b - *(const int*) a;
+}
+
+void test_list_snapshot_shares_until_first_write(void) {
+    push_range(&test_list, 100);
+
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &snap));
+    TEST_ASSERT_EQUAL_PTR(list_data(&test_list), list_data(&snap));
+    TEST_ASSERT_TRUE(list_shares_buffer(&test_list));
+    TEST_ASSERT_TRUE(list_shares_buffer(&snap));
+
+    const int value = -1;
+    TEST_ASSERT_EQUAL(LIST_OK, list_set(&test_list, 5, &value));
+    TEST_ASSERT_TRUE(list_data(&test_list) != list_data(&snap));
+    TEST_ASSERT_FALSE(list_shares_buffer(&test_list));
+
+    int out = 0;
+    list_get(&test_list, 5, &out);
+    TEST_ASSERT_EQUAL_INT(-1, out);
+    list_get(&snap, 5, &out);
+    TEST_ASSERT_EQUAL_INT(5, out);
+
+    // The snapshot is the last holder, so writing to it takes the buffer back
+    const void* shared = list_data(&snap);
+    TEST_ASSERT_FALSE(list_shares_buffer(&snap));
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&snap, &value));
+    TEST_ASSERT_EQUAL_PTR(shared, list_data(&snap));
+    TEST_ASSERT_EQUAL_size_t(101, list_size(&snap));
+
+    list_destroy(&snap);
+}
+
+void test_list_snapshot_detaches_on_every_mutation(void) {
+    push_range(&test_list, 64);
+
+    list snaps[4];
+    for (int s = 0; s < 4; s++) TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &snaps[s]));
+
+    int out = 0;
+    TEST_ASSERT_EQUAL(LIST_OK, list_pop(&snaps[0], &out));
+    TEST_ASSERT_EQUAL_INT(63, out);
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&snaps[0], &(int) { 1000 }));
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_at(&snaps[1], 0, nullptr));
+    TEST_ASSERT_EQUAL(LIST_OK, list_sort(&snaps[2], compare_ints_descending));
+    list_clear(&snaps[3]);
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&snaps[3], &(int) { 7 }));
+
+    for (int i = 0; i < 64; i++) {
+        list_get(&test_list, (size_t) i, &out);
+        TEST_ASSERT_EQUAL_INT(i, out);
+    }
+    list_get(&snaps[0], 63, &out);
+    TEST_ASSERT_EQUAL_INT(1000, out);
+    list_get(&snaps[1], 0, &out);
+    TEST_ASSERT_EQUAL_INT(1, out);
+    list_get(&snaps[2], 0, &out);
+    TEST_ASSERT_EQUAL_INT(63, out);
+    TEST_ASSERT_EQUAL_size_t(1, list_size(&snaps[3]));
+
+    for (int s = 0; s < 4; s++) list_destroy(&snaps[s]);
+}
+
+void test_list_snapshot_survives_no_op_reserve_and_resize(void) {
+    push_range(&test_list, 100);
+
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &snap));
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_reserve(&test_list, list_capacity(&test_list)));
+    TEST_ASSERT_EQUAL(LIST_OK, list_reserve(&test_list, 10));
+    TEST_ASSERT_TRUE(list_shares_buffer(&test_list));
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_resize_to(&test_list, list_size(&test_list), nullptr));
+    TEST_ASSERT_TRUE(list_shares_buffer(&test_list));
+    TEST_ASSERT_EQUAL_PTR(list_data(&snap), list_data(&test_list));
+
+    // Growing past the capacity still detaches
+    TEST_ASSERT_EQUAL(LIST_OK, list_reserve(&test_list, list_capacity(&test_list) + 1));
+    TEST_ASSERT_FALSE(list_shares_buffer(&test_list));
+
+    list_destroy(&snap);
+}
+
+void test_list_snapshot_outlives_its_source(void) {
+    push_range(&test_list, 1000);
+
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &snap));
+
+    list second;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&snap, &second));
+    list_destroy(&test_list);
+    list_init(&test_list, sizeof(int));
+
+    TEST_ASSERT_TRUE(list_shares_buffer(&snap));
+    TEST_ASSERT_EQUAL(LIST_OK, list_unshare(&second));
+    TEST_ASSERT_FALSE(list_shares_buffer(&snap));
+
+    int out = 0;
+    list_get(&snap, 999, &out);
+    TEST_ASSERT_EQUAL_INT(999, out);
+    TEST_ASSERT_TRUE(list_equal(&snap, &second));
+
+    list_destroy(&snap);
+    list_destroy(&second);
+}
+
+void test_list_snapshot_survives_moving_its_source(void) {
+    push_range(&test_list, 100);
+
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &snap));
+
+    list moved;
+    TEST_ASSERT_EQUAL(LIST_OK, list_move(&moved, &test_list));
+    TEST_ASSERT_FALSE(list_shares_buffer(&test_list));
+    TEST_ASSERT_TRUE(list_shares_buffer(&moved));
+
+    // The emptied source still works and no longer holds the shared block
+    constexpr int value = 7;
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&test_list, &value));
+    list_destroy(&test_list);
+    list_init(&test_list, sizeof(int));
+
+    TEST_ASSERT_TRUE(list_equal(&moved, &snap));
+    list_destroy(&moved);
+    TEST_ASSERT_FALSE(list_shares_buffer(&snap));
+
+    int out = 0;
+    list_get(&snap, 99, &out);
+    TEST_ASSERT_EQUAL_INT(99, out);
+    list_destroy(&snap);
+}
+
+void test_list_snapshot_of_empty_and_small_lists(void) {
+    list empty;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &empty));
+    TEST_ASSERT_FALSE(list_shares_buffer(&empty));
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&empty, &(int) { 1 }));
+    TEST_ASSERT_EQUAL_size_t(0, list_size(&test_list));
+    list_destroy(&empty);
+
+    // Few enough elements to live in the inline storage, if it is enabled
+    push_range(&test_list, 2);
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &snap));
+    TEST_ASSERT_EQUAL_PTR(list_data(&test_list), list_data(&snap));
+    TEST_ASSERT_EQUAL(LIST_OK, list_set(&snap, 0, &(int) { 9 }));
+
+    int out = 0;
+    list_get(&test_list, 0, &out);
+    TEST_ASSERT_EQUAL_INT(0, out);
+    list_get(&snap, 0, &out);
+    TEST_ASSERT_EQUAL_INT(9, out);
+
+    list_clear_and_release(&snap);
+    TEST_ASSERT_EQUAL_size_t(0, list_capacity(&snap));
+    list_destroy(&snap);
+}
+
+void test_list_snapshot_of_small_list_grows_after_detaching(void) {
+    list small;
+    TEST_ASSERT_EQUAL(LIST_OK, list_init_with_capacity(&small, 2, sizeof(int)));
+    push_range(&small, 2);
+
+    // Both holders end up with a private two-element buffer that then grows,
+    // back into the inline storage if it is enabled
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&small, &snap));
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&snap, &(int) { 2 }));
+    TEST_ASSERT_EQUAL(LIST_OK, list_push(&small, &(int) { -2 }));
+
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(i, *(const int*) list_at(&snap, (size_t) i));
+        TEST_ASSERT_EQUAL_INT(i, *(const int*) list_at(&small, (size_t) i));
+    }
+    TEST_ASSERT_EQUAL_INT(2, *(const int*) list_at(&snap, 2));
+    TEST_ASSERT_EQUAL_INT(-2, *(const int*) list_at(&small, 2));
+
+    list_destroy(&snap);
+    list_destroy(&small);
+}
+
+static void* toggled_alloc(void* ctx, const size_t size) {
+    return *(const bool*) ctx ? nullptr : malloc(size);
+}
+
+static void* toggled_realloc(void* ctx, void* ptr, [[maybe_unused]] const size_t old_size, const size_t new_size) {
+    return *(const bool*) ctx ? nullptr : realloc(ptr, new_size);
+}
+
+static void toggled_free([[maybe_unused]] void* ctx, void* ptr, [[maybe_unused]] const size_t size) {
+    free(ptr);
+}
+
+static bool is_odd(const void* elem, [[maybe_unused]] void* ctx) {
+    return *(const int*) elem % 2 != 0;
+}
+
+void test_list_snapshot_erase_if_reports_failed_detach(void) {
+    bool fail = false;
+    const list_allocator allocator = {
+        .alloc   = toggled_alloc,
+        .realloc = toggled_realloc,
+        .free    = toggled_free,
+        .ctx     = &fail,
+    };
+
+    list lst;
+    list_init_with_allocator(&lst, 0, sizeof(int), &allocator);
+    push_range(&lst, 10);
+
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&lst, &snap));
+
+    // The private copy cannot be made, so nothing is removed
+    fail = true;
+    size_t removed = 99;
+    TEST_ASSERT_EQUAL(LIST_ERR_ALLOC, list_erase_if(&lst, is_odd, nullptr, &removed));
+    TEST_ASSERT_EQUAL_UINT64(0, removed);
+    TEST_ASSERT_EQUAL_size_t(10, list_size(&lst));
+    TEST_ASSERT_TRUE(list_shares_buffer(&lst));
+
+    fail = false;
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_if(&lst, is_odd, nullptr, &removed));
+    TEST_ASSERT_EQUAL_UINT64(5, removed);
+    TEST_ASSERT_EQUAL_size_t(10, list_size(&snap));
+
+    list_destroy(&snap);
+    list_destroy(&lst);
+}
+
+void test_list_snapshot_erase_at_leaves_output_untouched_on_failed_detach(void) {
+    bool fail = false;
+    const list_allocator allocator = {
+        .alloc   = toggled_alloc,
+        .realloc = toggled_realloc,
+        .free    = toggled_free,
+        .ctx     = &fail,
+    };
+
+    list lst;
+    list_init_with_allocator(&lst, 0, sizeof(int), &allocator);
+    push_range(&lst, 10);
+
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&lst, &snap));
+
+    fail = true;
+    int value = -1;
+    TEST_ASSERT_EQUAL(LIST_ERR_ALLOC, list_erase_at(&lst, 3, &value));
+    TEST_ASSERT_EQUAL_INT(-1, value);
+    TEST_ASSERT_EQUAL_size_t(10, list_size(&lst));
+
+    fail = false;
+    TEST_ASSERT_EQUAL(LIST_OK, list_erase_at(&lst, 3, &value));
+    TEST_ASSERT_EQUAL_INT(3, value);
+    TEST_ASSERT_EQUAL_size_t(10, list_size(&snap));
+
+    list_destroy(&snap);
+    list_destroy(&lst);
+}
+
+void test_list_snapshot_rejects_invalid_arguments(void) {
+    list snap;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_snapshot(nullptr, &snap));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_snapshot(&test_list, nullptr));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_snapshot(&test_list, &test_list));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_unshare(nullptr));
+    TEST_ASSERT_FALSE(list_shares_buffer(nullptr));
+}
+
+enum { reader_count = 4, reader_elems = 20000 };
+
+static int sum_snapshot(void* arg) {
+    list* snap = arg;
+    int64_t sum = 0;
+    for (size_t i = 0; i < list_size(snap); i++) sum += *(const int*) list_at(snap, i);
+
+    // Writing detaches the reader from the writer and from the other readers
+    list_set(snap, 0, &(int) { -1 });
+    list_destroy(snap);
+
+    return sum == (int64_t) reader_elems * (reader_elems - 1) / 2;
+}
+
+void test_list_snapshot_crosses_threads(void) {
+    push_range(&test_list, reader_elems);
+
+    list snaps[reader_count];
+    thrd_t threads[reader_count];
+    for (int t = 0; t < reader_count; t++) {
+        TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&test_list, &snaps[t]));
+        TEST_ASSERT_EQUAL(thrd_success, thrd_create(&threads[t], sum_snapshot, &snaps[t]));
+    }
+
+    // Writing while the readers run must not disturb them
+    for (int i = 0; i < reader_elems; i++) list_set(&test_list, (size_t) i, &(int) { 0 });
+
+    for (int t = 0; t < reader_count; t++) {
+        int result = 0;
+        thrd_join(threads[t], &result);
+        TEST_ASSERT_EQUAL_INT(1, result);
+    }
+}
+
+void test_list_segmented_snapshot_copies_only_the_touched_chunk(void) {
+    list_segmented seg;
+    list_segmented_init_with_capacity(&seg, 4, sizeof(int));
+    for (int i = 0; i < 61; i++) list_segmented_push(&seg, &i);
+
+    list_segmented snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_segmented_snapshot(&seg, &snap));
+    TEST_ASSERT_EQUAL_PTR(list_segmented_at(&seg, 0), list_segmented_at(&snap, 0));
+
+    // Element 30 lives in the fourth chunk (28 to 59); the others stay shared
+    TEST_ASSERT_EQUAL(LIST_OK, list_segmented_set(&seg, 30, &(int) { -30 }));
+    TEST_ASSERT_TRUE(list_segmented_at(&seg, 30) != list_segmented_at(&snap, 30));
+    TEST_ASSERT_TRUE(list_segmented_at(&seg, 59) != list_segmented_at(&snap, 59));
+    TEST_ASSERT_EQUAL_PTR(list_segmented_at(&seg, 27), list_segmented_at(&snap, 27));
+    TEST_ASSERT_EQUAL_PTR(list_segmented_at(&seg, 60), list_segmented_at(&snap, 60));
+
+    int out = 0;
+    list_segmented_get(&seg, 30, &out);
+    TEST_ASSERT_EQUAL_INT(-30, out);
+    list_segmented_get(&snap, 30, &out);
+    TEST_ASSERT_EQUAL_INT(30, out);
+    list_segmented_get(&seg, 29, &out);
+    TEST_ASSERT_EQUAL_INT(29, out);
+
+    // Popping back into the shared first chunk and pushing again copies it
+    for (int i = 0; i < 59; i++) list_segmented_pop(&snap, nullptr);
+    TEST_ASSERT_EQUAL(LIST_OK, list_segmented_push(&snap, &(int) { 500 }));
+    TEST_ASSERT_TRUE(list_segmented_at(&seg, 0) != list_segmented_at(&snap, 0));
+    list_segmented_get(&seg, 2, &out);
+    TEST_ASSERT_EQUAL_INT(2, out);
+    list_segmented_get(&snap, 2, &out);
+    TEST_ASSERT_EQUAL_INT(500, out);
+
+    list_segmented_destroy(&seg);
+    list_segmented_get(&snap, 1, &out);
+    TEST_ASSERT_EQUAL_INT(1, out);
+    TEST_ASSERT_EQUAL(LIST_OK, list_segmented_unshare(&snap));
+    list_segmented_destroy(&snap);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_snapshot_shares_until_first_write);
+    RUN_TEST(test_list_snapshot_detaches_on_every_mutation);
+    RUN_TEST(test_list_snapshot_survives_no_op_reserve_and_resize);
+    RUN_TEST(test_list_snapshot_outlives_its_source);
+    RUN_TEST(test_list_snapshot_survives_moving_its_source);
+    RUN_TEST(test_list_snapshot_of_empty_and_small_lists);
+    RUN_TEST(test_list_snapshot_of_small_list_grows_after_detaching);
+    RUN_TEST(test_list_snapshot_erase_if_reports_failed_detach);
+    RUN_TEST(test_list_snapshot_erase_at_leaves_output_untouched_on_failed_detach);
+    RUN_TEST(test_list_snapshot_rejects_invalid_arguments);
+    RUN_TEST(test_list_snapshot_crosses_threads);
+    RUN_TEST(test_list_segmented_snapshot_copies_only_the_touched_chunk);
+
+    return UNITY_END();
+}
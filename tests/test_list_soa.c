@@ -0,0 +1,160 @@
+#include <stdint.h>
+#include <string.h>
+#include "list_soa.h"
+#include "unity.h"
+
+typedef struct sample {
+    uint64_t id;
+    uint64_t timestamp;
+    double   value;
+    uint32_t flags;
+    uint8_t  kind;
+} sample;
+
+static const list_soa_field sample_schema[] = {
+    LIST_SOA_FIELD(sample, id),
+    LIST_SOA_FIELD(sample, timestamp),
+    LIST_SOA_FIELD(sample, value),
+    LIST_SOA_FIELD(sample, flags),
+    LIST_SOA_FIELD(sample, kind),
+};
+
+enum { sample_fields = sizeof(sample_schema) / sizeof(sample_schema[0]) };
+
+static list_soa test_soa;
+
+void setUp(void) {
+    list_soa_init(&test_soa, sample_schema, sample_fields);
+}
+
+void tearDown(void) {
+    list_soa_destroy(&test_soa);
+}
+
+static sample make_sample(const uint64_t i) {
+    return (sample) { i, 1000 + i, (double) i * 0.5, (uint32_t) (i * 3), (uint8_t) (i % 7) };
+}
+
+static void push_samples(const uint64_t count) {
+    for (uint64_t i = 0; i < count; i++) {
+        const sample row = make_sample(i);
+        TEST_ASSERT_EQUAL(LIST_OK, list_soa_push(&test_soa, &row));
+    }
+}
+
+static void assert_sample(const uint64_t i, const sample* row) {
+    const sample expected = make_sample(i);
+    TEST_ASSERT_EQUAL_UINT64(expected.id, row->id);
+    TEST_ASSERT_EQUAL_UINT64(expected.timestamp, row->timestamp);
+    TEST_ASSERT_TRUE(expected.value == row->value);
+    TEST_ASSERT_EQUAL_UINT32(expected.flags, row->flags);
+    TEST_ASSERT_EQUAL_UINT8(expected.kind, row->kind);
+}
+
+void test_list_soa_init_rejects_bad_schema(void) {
+    list_soa other;
+    list_soa_field fields[LIST_SOA_MAX_FIELDS + 1];
+    for (size_t f = 0; f <= LIST_SOA_MAX_FIELDS; f++) fields[f] = (list_soa_field) { 1, f };
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_soa_init(nullptr, fields, 1));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_soa_init(&other, nullptr, 1));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_soa_init(&other, fields, 0));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_soa_init(&other, fields, LIST_SOA_MAX_FIELDS + 1));
+
+    fields[3].size = 0;
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_soa_init(&other, fields, 4));
+
+    fields[3].size = 1;
+    TEST_ASSERT_EQUAL(LIST_OK, list_soa_init(&other, fields, LIST_SOA_MAX_FIELDS));
+    list_soa_destroy(&other);
+}
+
+void test_list_soa_push_and_get_round_trip(void) {
+    push_samples(1000);
+    TEST_ASSERT_EQUAL_UINT64(1000, list_soa_size(&test_soa));
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        sample row;
+        memset(&row, 0xff, sizeof(row));
+        TEST_ASSERT_EQUAL(LIST_OK, list_soa_get(&test_soa, i, &row));
+        assert_sample(i, &row);
+    }
+
+    sample row;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_soa_get(&test_soa, 1000, &row));
+}
+
+void test_list_soa_columns_are_contiguous(void) {
+    push_samples(500);
+
+    const double* values = list_soa_column(&test_soa, 2);
+    const uint8_t* kinds = list_soa_column(&test_soa, 4);
+    TEST_ASSERT_NOT_NULL(values);
+    TEST_ASSERT_NOT_NULL(kinds);
+
+    for (size_t i = 0; i < 500; i++) {
+        TEST_ASSERT_TRUE(values[i] == (double) i * 0.5);
+        TEST_ASSERT_EQUAL_UINT8(i % 7, kinds[i]);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(&values[42], list_soa_at(&test_soa, 42, 2));
+    TEST_ASSERT_NULL(list_soa_at(&test_soa, 500, 2));
+    TEST_ASSERT_NULL(list_soa_column(&test_soa, sample_fields));
+
+    // One column can be scanned with the ordinary list functions
+    const list* kind_column = list_soa_column_list(&test_soa, 4);
+    const uint8_t three = 3;
+    TEST_ASSERT_EQUAL_UINT64(sizeof(uint8_t), kind_column->elem_size);
+    TEST_ASSERT_EQUAL_UINT64(3, list_find(kind_column, &three));
+    TEST_ASSERT_EQUAL_UINT64(71, list_count(kind_column, &three));
+}
+
+void test_list_soa_set_and_pop(void) {
+    push_samples(10);
+
+    const sample replacement = make_sample(77);
+    TEST_ASSERT_EQUAL(LIST_OK, list_soa_set(&test_soa, 4, &replacement));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, list_soa_set(&test_soa, 10, &replacement));
+
+    sample row;
+    TEST_ASSERT_EQUAL(LIST_OK, list_soa_get(&test_soa, 4, &row));
+    assert_sample(77, &row);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_soa_pop(&test_soa, &row));
+    assert_sample(9, &row);
+    TEST_ASSERT_EQUAL(LIST_OK, list_soa_pop(&test_soa, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(8, list_soa_size(&test_soa));
+
+    for (size_t f = 0; f < sample_fields; f++) {
+        TEST_ASSERT_EQUAL_UINT64(8, list_size(list_soa_column_list(&test_soa, f)));
+    }
+
+    list_soa_clear(&test_soa);
+    TEST_ASSERT_EQUAL_UINT64(0, list_soa_size(&test_soa));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_soa_pop(&test_soa, &row));
+
+    push_samples(3);
+    TEST_ASSERT_EQUAL(LIST_OK, list_soa_get(&test_soa, 2, &row));
+    assert_sample(2, &row);
+}
+
+void test_list_soa_init_with_capacity(void) {
+    list_soa other;
+    TEST_ASSERT_EQUAL(LIST_OK, list_soa_init_with_capacity(&other, sample_schema, sample_fields, 64));
+
+    for (size_t f = 0; f < sample_fields; f++) {
+        TEST_ASSERT_TRUE(list_capacity(list_soa_column_list(&other, f)) >= 64);
+    }
+
+    list_soa_destroy(&other);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_list_soa_init_rejects_bad_schema);
+    RUN_TEST(test_list_soa_push_and_get_round_trip);
+    RUN_TEST(test_list_soa_columns_are_contiguous);
+    RUN_TEST(test_list_soa_set_and_pop);
+    RUN_TEST(test_list_soa_init_with_capacity);
+    return UNITY_END();
+}
@@ -0,0 +1,145 @@
+#include <math.h>
+#include "list_sort.h"
+#include "unity.h"
+
+static list test_list;
+
+static uint64_t rng_state;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static int compare_i32(const void* a, const void* b) {
+    const int32_t x = *(const int32_t*) a;
+    const int32_t y = *(const int32_t*) b;
+    return (x > y) - (x < y);
+}
+
+static int compare_u64(const void* a, const void* b) {
+    const uint64_t x = *(const uint64_t*) a;
+    const uint64_t y = *(const uint64_t*) b;
+    return (x > y) - (x < y);
+}
+
+void setUp(void) {
+    rng_state = 0x9e3779b97f4a7c15u;
+}
+
+void tearDown(void) {
+    list_destroy(&test_list);
+}
+
+static void fill_i32(const size_t count) {
+    list_init_with_capacity(&test_list, count, sizeof(int32_t));
+    for (size_t i = 0; i < count; i++) {
+        const int32_t value = (int32_t) (uint32_t) next_random();
+        list_push(&test_list, &value);
+    }
+}
+
+void test_list_sort_orders_elements(void) {
+    fill_i32(1000);
+    TEST_ASSERT_EQUAL(LIST_OK, list_sort(&test_list, compare_i32));
+
+    const int32_t* values = list_data(&test_list);
+    for (size_t i = 1; i < 1000; i++) TEST_ASSERT_TRUE(values[i - 1] <= values[i]);
+}
+
+void test_list_sort_keys_matches_comparison_sort(void) {
+    fill_i32(5000);
+    list expected;
+    list_init(&expected, sizeof(int32_t));
+    list_extend(&expected, &test_list);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_sort_keys(&test_list, LIST_KEY_I32));
+    list_sort(&expected, compare_i32);
+
+    TEST_ASSERT_EQUAL_INT32_ARRAY(list_data(&expected), list_data(&test_list), 5000);
+    list_destroy(&expected);
+}
+
+void test_list_sort_keys_orders_floats_with_signs(void) {
+    const double input[] = { 3.5, -0.0, -INFINITY, 2.0, -7.25, 0.0, INFINITY, -1.0 };
+    const double sorted[] = { -INFINITY, -7.25, -1.0, -0.0, 0.0, 2.0, 3.5, INFINITY };
+
+    list_init(&test_list, sizeof(double));
+    list_push_n(&test_list, input, 8);
+    TEST_ASSERT_EQUAL(LIST_OK, list_sort_keys(&test_list, LIST_KEY_F64));
+
+    const double* values = list_data(&test_list);
+    for (size_t i = 0; i < 8; i++) {
+        TEST_ASSERT_TRUE(values[i] == sorted[i]);
+        TEST_ASSERT_TRUE(signbit(values[i]) == signbit(sorted[i]));
+    }
+}
+
+void test_list_sort_keys_rejects_mismatched_element_size(void) {
+    list_init(&test_list, sizeof(int32_t));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_sort_keys(&test_list, LIST_KEY_I64));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_sort_keys(&test_list, (list_key_type) 99));
+}
+
+void test_list_sort_parallel_matches_serial_sort(void) {
+    enum { count = 3 * LIST_SORT_PARALLEL_THRESHOLD + 17 };
+
+    list_init_with_capacity(&test_list, count, sizeof(uint64_t));
+    for (size_t i = 0; i < count; i++) {
+        const uint64_t value = next_random() % 100000;
+        list_push(&test_list, &value);
+    }
+    list expected;
+    list_init(&expected, sizeof(uint64_t));
+    list_extend(&expected, &test_list);
+
+    TEST_ASSERT_EQUAL(LIST_OK, list_sort_parallel(&test_list, compare_u64, 5));
+    list_sort_keys(&expected, LIST_KEY_U64);
+
+    TEST_ASSERT_EQUAL_UINT64_ARRAY(list_data(&expected), list_data(&test_list), count);
+    list_destroy(&expected);
+}
+
+void test_list_lower_bound_and_bsearch(void) {
+    const int32_t values[] = { 1, 3, 3, 3, 7, 9 };
+    list_init(&test_list, sizeof(int32_t));
+    list_push_n(&test_list, values, 6);
+
+    const int32_t three = 3;
+    const int32_t four = 4;
+    const int32_t ten = 10;
+    TEST_ASSERT_EQUAL_UINT64(1, list_lower_bound(&test_list, &three, compare_i32));
+    TEST_ASSERT_EQUAL_UINT64(4, list_lower_bound(&test_list, &four, compare_i32));
+    TEST_ASSERT_EQUAL_UINT64(6, list_lower_bound(&test_list, &ten, compare_i32));
+
+    TEST_ASSERT_EQUAL_PTR(list_at(&test_list, 1), list_bsearch(&test_list, &three, compare_i32));
+    TEST_ASSERT_NULL(list_bsearch(&test_list, &four, compare_i32));
+    TEST_ASSERT_NULL(list_bsearch(&test_list, &ten, compare_i32));
+}
+
+void test_list_bsearch_rejects_null_arguments(void) {
+    const int32_t values[] = { 1, 3, 7 };
+    list_init(&test_list, sizeof(int32_t));
+    list_push_n(&test_list, values, 3);
+
+    const int32_t three = 3;
+    TEST_ASSERT_NULL(list_bsearch(&test_list, &three, nullptr));
+    TEST_ASSERT_NULL(list_bsearch(&test_list, nullptr, compare_i32));
+    TEST_ASSERT_NULL(list_bsearch(nullptr, &three, compare_i32));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_sort_orders_elements);
+    RUN_TEST(test_list_sort_keys_matches_comparison_sort);
+    RUN_TEST(test_list_sort_keys_orders_floats_with_signs);
+    RUN_TEST(test_list_sort_keys_rejects_mismatched_element_size);
+    RUN_TEST(test_list_sort_parallel_matches_serial_sort);
+    RUN_TEST(test_list_lower_bound_and_bsearch);
+    RUN_TEST(test_list_bsearch_rejects_null_arguments);
+
+    return UNITY_END();
+}
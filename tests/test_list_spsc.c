@@ -0,0 +1,120 @@
+#include <threads.h>
+#include "list_spsc.h"
+#include "unity.h"
+
+static constexpr uint64_t transfer_count = 200000;
+
+static list_spsc test_queue;
+
+void setUp(void) {
+    list_spsc_init(&test_queue, 8, sizeof(uint64_t));
+}
+
+void tearDown(void) {
+    list_spsc_destroy(&test_queue);
+}
+
+static int batch_producer(void* arg) {
+    list_spsc* q = arg;
+    uint64_t batch[37];
+    uint64_t next = 0;
+
+    while (next < transfer_count) {
+        const size_t want = next + 37 <= transfer_count ? 37 : (size_t) (transfer_count - next);
+        for (size_t i = 0; i < want; i++) batch[i] = next + i;
+
+        size_t sent = 0;
+        while (sent < want) {
+            const size_t n = list_spsc_push_n(q, batch + sent, want - sent);
+            if (n == 0) thrd_yield();
+            sent += n;
+        }
+        next += want;
+    }
+    return 0;
+}
+
+void test_list_spsc_fifo_order_and_bounds(void) {
+    TEST_ASSERT_EQUAL_UINT64(8, list_spsc_capacity(&test_queue));
+
+    for (uint64_t i = 0; i < 8; i++) TEST_ASSERT_TRUE(list_spsc_try_push(&test_queue, &i));
+    const uint64_t extra = 99;
+    TEST_ASSERT_FALSE(list_spsc_try_push(&test_queue, &extra));
+    TEST_ASSERT_EQUAL_UINT64(8, list_spsc_size(&test_queue));
+
+    for (uint64_t i = 0; i < 8; i++) {
+        uint64_t value = 0;
+        TEST_ASSERT_TRUE(list_spsc_try_pop(&test_queue, &value));
+        TEST_ASSERT_EQUAL_UINT64(i, value);
+    }
+
+    uint64_t value = 0;
+    TEST_ASSERT_FALSE(list_spsc_try_pop(&test_queue, &value));
+    TEST_ASSERT_EQUAL_UINT64(0, list_spsc_size(&test_queue));
+}
+
+void test_list_spsc_batches_wrap_and_truncate(void) {
+    const uint64_t first[5] = { 1, 2, 3, 4, 5 };
+    uint64_t out[8] = { 0 };
+
+    TEST_ASSERT_EQUAL_UINT64(5, list_spsc_push_n(&test_queue, first, 5));
+    TEST_ASSERT_EQUAL_UINT64(3, list_spsc_pop_n(&test_queue, out, 3));
+
+    // Six more fit; the batch wraps past the end of the ring and is cut at the capacity
+    const uint64_t second[7] = { 6, 7, 8, 9, 10, 11, 12 };
+    TEST_ASSERT_EQUAL_UINT64(6, list_spsc_push_n(&test_queue, second, 7));
+    TEST_ASSERT_EQUAL_UINT64(0, list_spsc_push_n(&test_queue, second, 1));
+
+    TEST_ASSERT_EQUAL_UINT64(8, list_spsc_pop_n(&test_queue, out, 8));
+    const uint64_t expected[8] = { 4, 5, 6, 7, 8, 9, 10, 11 };
+    TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, out, 8);
+    TEST_ASSERT_EQUAL_UINT64(0, list_spsc_pop_n(&test_queue, out, 8));
+}
+
+void test_list_spsc_transfers_across_threads_in_order(void) {
+    list_spsc q;
+    TEST_ASSERT_EQUAL(LIST_OK, list_spsc_init(&q, 64, sizeof(uint64_t)));
+
+    thrd_t producer;
+    TEST_ASSERT_EQUAL(thrd_success, thrd_create(&producer, batch_producer, &q));
+
+    uint64_t expected = 0;
+    uint64_t batch[29];
+    while (expected < transfer_count) {
+        const size_t n = list_spsc_pop_n(&q, batch, 29);
+        if (n == 0) thrd_yield();
+        for (size_t i = 0; i < n; i++) {
+            if (batch[i] != expected) TEST_FAIL_MESSAGE("element out of order");
+            expected++;
+        }
+    }
+
+    int result = -1;
+    thrd_join(producer, &result);
+    TEST_ASSERT_EQUAL(0, result);
+    TEST_ASSERT_EQUAL_UINT64(0, list_spsc_size(&q));
+
+    list_spsc_destroy(&q);
+}
+
+void test_list_spsc_rejects_invalid_arguments(void) {
+    list_spsc q;
+    uint64_t value = 0;
+
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_spsc_init(&q, 0, sizeof(uint64_t)));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, list_spsc_init(nullptr, 8, sizeof(uint64_t)));
+    TEST_ASSERT_FALSE(list_spsc_try_push(nullptr, &value));
+    TEST_ASSERT_FALSE(list_spsc_try_pop(&test_queue, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(0, list_spsc_push_n(&test_queue, nullptr, 1));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_list_spsc_fifo_order_and_bounds);
+    RUN_TEST(test_list_spsc_batches_wrap_and_truncate);
+    RUN_TEST(test_list_spsc_transfers_across_threads_in_order);
+    RUN_TEST(test_list_spsc_rejects_invalid_arguments);
+
+    return UNITY_END();
+}
@@ -0,0 +1,156 @@
+#include "list_snapshot.h"
+#include "list_typed.h"
+#include "unity.h"
+
+LIST_DEFINE(int32_t, i32list)
+LIST_DEFINE(double, f64list)
+
+#define LIST_TYPED_REGISTRY(X, op) X(i32list, op) X(f64list, op)
+
+static i32list test_list;
+
+void setUp(void) {
+    i32list_init(&test_list);
+}
+
+void tearDown(void) {
+    i32list_destroy(&test_list);
+}
+
+static void populate_list_with_data(void) {
+    for (int32_t i = 0; i < 10; i++) {
+        i32list_push(&test_list, i * 10);
+    }
+}
+
+void test_typed_list_init_uses_element_size(void) {
+    TEST_ASSERT_EQUAL_UINT64(sizeof(int32_t), test_list.base.elem_size);
+    TEST_ASSERT_EQUAL_UINT64(0, i32list_size(&test_list));
+}
+
+void test_typed_list_push_and_get_value(void) {
+    populate_list_with_data();
+
+    int32_t value = -1;
+    TEST_ASSERT_EQUAL(LIST_OK, i32list_get(&test_list, 7, &value));
+    TEST_ASSERT_EQUAL_INT32(70, value);
+    TEST_ASSERT_EQUAL_UINT64(16, test_list.base.capacity);
+}
+
+void test_typed_list_get_returns_error_when_index_out_of_bounds(void) {
+    populate_list_with_data();
+
+    int32_t value = -1;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, i32list_get(&test_list, 10, &value));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, i32list_set(&test_list, 10, 0));
+}
+
+void test_typed_list_set_overwrites_value(void) {
+    populate_list_with_data();
+
+    TEST_ASSERT_EQUAL(LIST_OK, i32list_set(&test_list, 3, 333));
+    TEST_ASSERT_EQUAL_INT32(333, i32list_data(&test_list)[3]);
+}
+
+void test_typed_list_pop_follows_shrink_policy(void) {
+    populate_list_with_data();
+
+    int32_t value = -1;
+    for (int i = 0; i < 7; i++) i32list_pop(&test_list, &value);
+
+    TEST_ASSERT_EQUAL_INT32(30, value);
+    TEST_ASSERT_EQUAL_UINT64(3, i32list_size(&test_list));
+    TEST_ASSERT_EQUAL_UINT64(8, test_list.base.capacity);
+}
+
+void test_typed_list_mixes_with_untyped_api(void) {
+    populate_list_with_data();
+
+    int32_t value = -1;
+    TEST_ASSERT_EQUAL(LIST_OK, list_get(list_base(&test_list), 9, &value));
+    TEST_ASSERT_EQUAL_INT32(90, value);
+
+    constexpr int32_t pushed = 100;
+    list_push(list_base(&test_list), &pushed);
+    TEST_ASSERT_EQUAL(LIST_OK, i32list_peek(&test_list, &value));
+    TEST_ASSERT_EQUAL_INT32(100, value);
+}
+
+void test_typed_list_generic_front_end_dispatches_by_type(void) {
+    f64list doubles;
+    f64list_init(&doubles);
+
+    list_tpush(&test_list, 5);
+    list_tpush(&doubles, 2.5);
+
+    int32_t i = 0;
+    double d = 0.0;
+    list_tget(&test_list, 0, &i);
+    list_tget(&doubles, 0, &d);
+    TEST_ASSERT_EQUAL_INT32(5, i);
+    TEST_ASSERT_TRUE(d == 2.5);
+
+    list_tset(&doubles, 0, 4.0);
+    TEST_ASSERT_EQUAL(LIST_OK, list_tpop(&doubles, &d));
+    TEST_ASSERT_TRUE(d == 4.0);
+
+    f64list_destroy(&doubles);
+}
+
+void test_typed_list_writes_detach_snapshots(void) {
+    populate_list_with_data();
+    list_reserve(list_base(&test_list), 32);
+
+    i32list snap;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(list_base(&test_list), &snap.base));
+
+    TEST_ASSERT_EQUAL(LIST_OK, i32list_set(&test_list, 0, -1));
+    TEST_ASSERT_EQUAL_INT32(0, i32list_data(&snap)[0]);
+    TEST_ASSERT_EQUAL_INT32(-1, i32list_data(&test_list)[0]);
+
+    // Both holders push into the same slot of what used to be one buffer
+    i32list snap2;
+    TEST_ASSERT_EQUAL(LIST_OK, list_snapshot(&snap.base, &snap2.base));
+    TEST_ASSERT_EQUAL(LIST_OK, i32list_push(&snap, 7));
+    TEST_ASSERT_EQUAL(LIST_OK, i32list_push(&snap2, 9));
+    TEST_ASSERT_EQUAL_INT32(7, i32list_data(&snap)[10]);
+    TEST_ASSERT_EQUAL_INT32(9, i32list_data(&snap2)[10]);
+
+    i32list_destroy(&snap);
+    i32list_destroy(&snap2);
+}
+
+void test_typed_list_errors_reach_failure_statistics(void) {
+    populate_list_with_data();
+    list_stats_reset(nullptr);
+
+    int32_t value = -1;
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, i32list_get(&test_list, 10, &value));
+    TEST_ASSERT_EQUAL(LIST_OUT_OF_BOUNDS, i32list_set(&test_list, 10, 0));
+    TEST_ASSERT_EQUAL(LIST_ERR_INVALID, i32list_push(nullptr, 0));
+
+    list_stats stats;
+    TEST_ASSERT_EQUAL(LIST_OK, list_stats_get(nullptr, &stats));
+#ifdef LIST_ENABLE_STATS
+    TEST_ASSERT_EQUAL_UINT64(2, stats.failures[LIST_OUT_OF_BOUNDS]);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.failures[LIST_ERR_INVALID]);
+#else
+    TEST_ASSERT_EQUAL_UINT64(0, stats.failures[LIST_OUT_OF_BOUNDS]);
+#endif
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_typed_list_init_uses_element_size);
+    RUN_TEST(test_typed_list_push_and_get_value);
+    RUN_TEST(test_typed_list_get_returns_error_when_index_out_of_bounds);
+    RUN_TEST(test_typed_list_set_overwrites_value);
+    RUN_TEST(test_typed_list_pop_follows_shrink_policy);
+    RUN_TEST(test_typed_list_mixes_with_untyped_api);
+    RUN_TEST(test_typed_list_generic_front_end_dispatches_by_type);
+    RUN_TEST(test_typed_list_writes_detach_snapshots);
+    RUN_TEST(test_typed_list_errors_reach_failure_statistics);
+
+    return UNITY_END();
+}